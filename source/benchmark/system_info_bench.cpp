@@ -0,0 +1,390 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief System info and Driver Overrides parser benchmarks
+///
+/// Parses synthetic System Info and Driver Overrides chunks of increasing size and reports
+/// the throughput, the heap allocations per parse and the peak resident set size.
+///
+/// Usage: system_info_bench [filter] [min_seconds]
+///   filter       Only run the benchmarks whose name contains this string.
+///   min_seconds  The minimum time to run each benchmark for, 0.5 by default.
+//=============================================================================
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include "json.hpp"
+
+#include "definitions.h"
+#include "driver_overrides_definitions.h"
+#include "driver_overrides_reader.h"
+#include "system_info_reader.h"
+
+namespace
+{
+    std::atomic<uint64_t> allocation_count(0);  ///< The number of calls to the global operator new.
+}  // namespace
+
+void* operator new(size_t size)
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    void* result = std::malloc((size != 0) ? size : 1);
+    if (result == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return result;
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept
+{
+    std::free(pointer);
+}
+
+namespace
+{
+    constexpr double kDefaultMinSeconds = 0.5;  ///< The default minimum time to run each benchmark for.
+    constexpr int    kMinIterations     = 3;    ///< The minimum number of parses of each benchmark.
+
+    /// @brief Get the peak resident set size of the process.
+    /// @return The peak resident set size in bytes, or 0 if it is not available.
+    uint64_t GetPeakRss()
+    {
+#if defined(_WIN32)
+        PROCESS_MEMORY_COUNTERS counters = {};
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) == 0)
+        {
+            return 0;
+        }
+        return counters.PeakWorkingSetSize;
+#else
+        struct rusage usage = {};
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+        {
+            return 0;
+        }
+#if defined(__APPLE__)
+        return static_cast<uint64_t>(usage.ru_maxrss);
+#else
+        return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+    }
+
+    /// @brief Build a synthetic System Info chunk.
+    /// @param [in] gpu_count The number of GPUs.
+    /// @param [in] process_count The number of processes.
+    /// @return The System Info JSON text.
+    std::string MakeSystemInfoJson(uint32_t gpu_count, uint32_t process_count)
+    {
+        nlohmann::json json;
+
+        nlohmann::json& version   = json[kNodeStringVersion];
+        version[kNodeStringMajor] = 2;
+        version[kNodeStringMinor] = 0;
+        version[kNodeStringPatch] = 0;
+        version[kNodeStringBuild] = 0;
+
+        nlohmann::json& driver                    = json[kNodeStringDriver];
+        driver[kNodeStringName]                   = "AMD Radeon Software";
+        driver[kNodeStringDescription]            = "AMD Software: Adrenalin Edition";
+        driver[kNodeStringDriverPackagingVersion] = "23.40.02.01-231002a-396538C-AMD-Software-Adrenalin-Edition";
+        driver[kNodeStringDriverSoftwareVersion]  = "23.20.23.01";
+        driver[kNodeStringIsClosedSource]         = true;
+
+        nlohmann::json& devdriver                       = json[kNodeStringDevDriver];
+        devdriver[kNodeStringVersion][kNodeStringMajor] = 42;
+        devdriver[kNodeStringTag]                       = "v2024.1.0";
+
+        nlohmann::json& os                               = json[kNodeStringOs];
+        os[kNodeStringName]                              = "Windows 11 Pro";
+        os[kNodeStringDescription]                       = "10.0.22631";
+        os[kNodeStringHostName]                          = "workstation";
+        os[kNodeStringMemory][kNodeStringMemoryPhysical] = 68719476736ull;
+        os[kNodeStringMemory][kNodeStringMemorySwap]     = 4294967296ull;
+        os[kNodeStringMemory][kNodeStringType]           = "DDR5";
+
+        nlohmann::json& cpu                   = json[kNodeStringCpus][0];
+        cpu[kNodeStringName]                  = "AMD Ryzen 9 7950X 16-Core Processor";
+        cpu[kNodeStringArchitecture]          = "x86_64";
+        cpu[kNodeStringCpuId]                 = "AMD64 Family 25 Model 97 Stepping 2";
+        cpu[kNodeStringCpuDeviceId]           = "CPU0";
+        cpu[kNodeStringCpuVendorId]           = "AuthenticAMD";
+        cpu[kNodeStringVirtualization]        = "AMD-V";
+        cpu[kNodeStringCpuPhysicalCoreCount]  = 16;
+        cpu[kNodeStringCpuLogicalCoreCount]   = 32;
+        cpu[kNodeStringSpeed][kNodeStringMax] = 4501;
+        cpu[kNodeStringCpuTimeClockFreq]      = 10000000;
+
+        nlohmann::json& gpus = json[kNodeStringGpus];
+        for (uint32_t i = 0; i < gpu_count; ++i)
+        {
+            nlohmann::json& gpu                         = gpus[i];
+            gpu[kNodeStringName]                        = "AMD Radeon RX 7900 XTX";
+            gpu[kNodeStringPci][kNodeStringPciBus]      = 3 + i;
+            gpu[kNodeStringPci][kNodeStringDevice]      = 0;
+            gpu[kNodeStringPci][kNodeStringPciFunction] = 0;
+
+            nlohmann::json& asic                                  = gpu[kNodeStringAsic];
+            asic[kNodeStringAsicGpuIndex]                         = i;
+            asic[kNodeStringAsicGpuCounterFrequency]              = 100000000;
+            asic[kNodeStringAsicEngineClockSpeed][kNodeStringMin] = 500000000;
+            asic[kNodeStringAsicEngineClockSpeed][kNodeStringMax] = 2500000000ull;
+            asic[kNodeStringAsicNumSe]                            = 6;
+            asic[kNodeStringAsicNumSaPerSe]                       = 2;
+            asic[kNodeStringAsicCuMask]                           = nlohmann::json::array();
+            for (uint32_t engine = 0; engine < 6; ++engine)
+            {
+                asic[kNodeStringAsicCuMask].push_back({255, 255});
+            }
+            asic[kNodeStringAsicNumCus] = 96;
+
+            char luid[17] = {};
+            snprintf(luid, sizeof(luid), "%08x00000000", 0xa1b2c300 + i);
+
+            nlohmann::json& ids           = asic[kNodeStringAsicIds];
+            ids[kNodeStringAsicGfxEngine] = 1100;
+            ids[kNodeStringAsicFamily]    = 145;
+            ids[kNodeStringAsicERev]      = 1;
+            ids[kNodeStringAsicRevision]  = 200;
+            ids[kNodeStringDevice]        = 29772;
+            ids[kNodeStringAsicSubsystem] = 1234;
+            ids[kNodeStringAsicVendor]    = 4098;
+            ids[kNodeStringAsicLuid]      = luid;
+
+            nlohmann::json& memory                              = gpu[kNodeStringMemory];
+            memory[kNodeStringType]                             = "GDDR6";
+            memory[kNodeStringMemoryOpsPerClock]                = 16;
+            memory[kNodeStringMemoryBusBitWidth]                = 384;
+            memory[kNodeStringMemoryBandwith]                   = 960000000000ull;
+            memory[kNodeStringMemoryClockSpeed][kNodeStringMin] = 96000000;
+            memory[kNodeStringMemoryClockSpeed][kNodeStringMax] = 2500000000ull;
+
+            nlohmann::json& heaps                                   = memory[kNodeStringHeaps];
+            heaps[kNodeStringLocal][kNodeStringPhysicalAddress]     = 0;
+            heaps[kNodeStringLocal][kNodeStringSize]                = 268435456;
+            heaps[kNodeStringInvisible][kNodeStringPhysicalAddress] = 268435456;
+            heaps[kNodeStringInvisible][kNodeStringSize]            = 25501368320ull;
+
+            memory[kNodeStringExcludedVaRanges] = {{{kNodeStringBase, 0}, {kNodeStringSize, 65536}}};
+
+            gpu[kNodeStringBigSw][kNodeStringMajor] = 1;
+            gpu[kNodeStringBigSw][kNodeStringMinor] = 2;
+            gpu[kNodeStringBigSw][kNodeStringMisc]  = 3;
+        }
+
+        nlohmann::json& processes = json[kNodeStringProcesses];
+        processes                 = nlohmann::json::array();
+        for (uint32_t i = 0; i < process_count; ++i)
+        {
+            const std::string name = "process_" + std::to_string(i) + ".exe";
+            processes.push_back({{kNodeStringProcessId, 1000 + i * 4}, {kNodeStringName, name}, {kNodeStringPath, "C:\\Program Files\\Vendor\\" + name}});
+        }
+
+        return json.dump();
+    }
+
+    /// @brief Build a synthetic Driver Overrides chunk.
+    ///
+    /// The settings are spread over 4 components with 8 structures each, and one setting in 10 is modified by the user.
+    ///
+    /// @param [in] setting_count The total number of settings.
+    /// @return The Driver Overrides JSON text.
+    std::string MakeDriverOverridesJson(uint32_t setting_count)
+    {
+        static constexpr uint32_t kComponentCount              = 4;
+        static constexpr uint32_t kStructureCount              = 8;
+        static const char*        kComponents[kComponentCount] = {"Dx12", "Vulkan", "OpenGL", "Pal"};
+
+        nlohmann::json json;
+        json[driver_overrides_utils::kNodeStringIsDriverExperiments] = false;
+
+        nlohmann::json& components = json[driver_overrides_utils::kNodeStringComponents];
+        components                 = nlohmann::json::array();
+        for (uint32_t component = 0; component < kComponentCount; ++component)
+        {
+            nlohmann::json component_json;
+            component_json[driver_overrides_utils::kNodeStringComponent] = kComponents[component];
+
+            nlohmann::json& structures = component_json[driver_overrides_utils::kNodeStringStructures];
+            structures                 = nlohmann::json::object();
+            for (uint32_t structure = 0; structure < kStructureCount; ++structure)
+            {
+                structures["Structure" + std::to_string(structure)] = nlohmann::json::array();
+            }
+
+            components.push_back(std::move(component_json));
+        }
+
+        for (uint32_t i = 0; i < setting_count; ++i)
+        {
+            const uint32_t component = i % kComponentCount;
+            const uint32_t structure = (i / kComponentCount) % kStructureCount;
+            const bool     modified  = (i % 10) == 0;
+
+            nlohmann::json setting;
+            setting[driver_overrides_utils::kNodeStringSettingName]  = "Setting" + std::to_string(i);
+            setting[driver_overrides_utils::kNodeStringDescription]  = "Controls the behavior of feature " + std::to_string(i) + ".";
+            setting[driver_overrides_utils::kNodeStringCurrent]      = i;
+            setting[driver_overrides_utils::kNodeStringUserOverride] = modified ? i + 1 : i;
+            setting[driver_overrides_utils::kNodeStringSupported]    = true;
+
+            components[component][driver_overrides_utils::kNodeStringStructures]["Structure" + std::to_string(structure)].push_back(std::move(setting));
+        }
+
+        return json.dump();
+    }
+
+    /// @brief Runs the benchmarks and prints a line per benchmark.
+    class BenchmarkRunner
+    {
+    public:
+        /// @brief Constructor.
+        /// @param [in] filter Only benchmarks whose name contains the filter are run.
+        /// @param [in] min_seconds The minimum time to run each benchmark for.
+        BenchmarkRunner(std::string filter, double min_seconds)
+            : filter_(std::move(filter))
+            , min_seconds_(min_seconds)
+            , failed_(false)
+        {
+            printf("%-60s %10s %10s %12s %10s %14s %14s\n", "benchmark", "iterations", "size KiB", "us/parse", "MB/s", "allocs/parse", "peak RSS MiB");
+        }
+
+        /// @brief Run a benchmark.
+        /// @param [in] name The benchmark name.
+        /// @param [in] size The size of the parsed text in bytes.
+        /// @param [in] parse Parses the text once, returning true on success.
+        void Run(const std::string& name, size_t size, const std::function<bool()>& parse)
+        {
+            if (name.find(filter_) == std::string::npos)
+            {
+                return;
+            }
+
+            if (!parse())
+            {
+                printf("%-60s failed to parse\n", name.c_str());
+                failed_ = true;
+                return;
+            }
+
+            using Clock = std::chrono::steady_clock;
+
+            const uint64_t          allocations_before = allocation_count.load(std::memory_order_relaxed);
+            const Clock::time_point start              = Clock::now();
+            double                  seconds            = 0.0;
+            int                     iterations         = 0;
+            while ((iterations < kMinIterations) || (seconds < min_seconds_))
+            {
+                parse();
+                ++iterations;
+                seconds = std::chrono::duration<double>(Clock::now() - start).count();
+            }
+            const uint64_t allocations = allocation_count.load(std::memory_order_relaxed) - allocations_before;
+
+            printf("%-60s %10d %10.1f %12.1f %10.1f %14.1f %14.1f\n",
+                   name.c_str(),
+                   iterations,
+                   static_cast<double>(size) / 1024.0,
+                   seconds * 1e6 / iterations,
+                   static_cast<double>(size) * iterations / seconds / 1e6,
+                   static_cast<double>(allocations) / iterations,
+                   static_cast<double>(GetPeakRss()) / (1024.0 * 1024.0));
+            fflush(stdout);
+        }
+
+        /// @brief Check if any benchmark failed to parse its input.
+        bool HasFailed() const
+        {
+            return failed_;
+        }
+
+    private:
+        std::string filter_;       ///< Only benchmarks whose name contains the filter are run.
+        double      min_seconds_;  ///< The minimum time to run each benchmark for.
+        bool        failed_;       ///< True if a benchmark failed to parse its input.
+    };
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    const std::string filter      = (argc > 1) ? argv[1] : "";
+    const double      min_seconds = (argc > 2) ? atof(argv[2]) : kDefaultMinSeconds;
+
+    BenchmarkRunner runner(filter, min_seconds);
+
+    for (uint32_t gpu_count : {1, 4, 16})
+    {
+        for (uint32_t process_count : {10, 100, 1000, 10000})
+        {
+            const std::string json   = MakeSystemInfoJson(gpu_count, process_count);
+            const std::string suffix = "/gpus:" + std::to_string(gpu_count) + "/processes:" + std::to_string(process_count);
+
+            runner.Run("SystemInfoReader::Parse(string)" + suffix, json.size(), [&json]() {
+                system_info_utils::SystemInfo system_info;
+                return system_info_utils::SystemInfoReader::Parse(json, system_info);
+            });
+
+            runner.Run("SystemInfoReader::Parse(text, size)" + suffix, json.size(), [&json]() {
+                system_info_utils::SystemInfo system_info;
+                return system_info_utils::SystemInfoReader::Parse(json.data(), json.size(), system_info);
+            });
+        }
+    }
+
+    for (uint32_t setting_count : {100, 1000, 10000, 50000})
+    {
+        const std::string json   = MakeDriverOverridesJson(setting_count);
+        const std::string suffix = "/settings:" + std::to_string(setting_count);
+
+        runner.Run("DriverOverridesReader::Parse(json)" + suffix, json.size(), [&json]() {
+            std::string processed_json;
+            return driver_overrides_utils::DriverOverridesReader::Parse(
+                json.data(), json.size(), driver_overrides_utils::kDriverOverridesChunkVersion, processed_json);
+        });
+
+        runner.Run("DriverOverridesReader::Parse(structured)" + suffix, json.size(), [&json]() {
+            driver_overrides_utils::DriverOverrides driver_overrides;
+            return driver_overrides_utils::DriverOverridesReader::Parse(
+                json.data(), json.size(), driver_overrides_utils::kDriverOverridesChunkVersion, driver_overrides);
+        });
+    }
+
+    return runner.HasFailed() ? EXIT_FAILURE : EXIT_SUCCESS;
+}
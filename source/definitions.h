@@ -43,6 +43,9 @@ static constexpr const char* kSystemInfoChunkIdentifier = "SystemInfo";
 static constexpr uint32_t    kSystemInfoChunkVersion    = 1;                        ///< Current system info chunk version
 static constexpr uint32_t    kSystemInfoChunkVersionMax = kSystemInfoChunkVersion;  ///< Maximum supported chunk version
 
+static constexpr uint32_t kSystemInfoCacheMagic   = 0x46434953;  ///< Identifies a system info cache file ("SICF")
+static constexpr uint32_t kSystemInfoCacheVersion = 1;           ///< Current system info cache format version
+
 static constexpr const char* kNodeStringDriver                  = "driver";
 static constexpr const char* kNodeStringSystem                  = "system";
 static constexpr const char* kNodeStringName                    = "name";
@@ -0,0 +1,92 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Diff element matcher definition
+//=============================================================================
+
+#ifndef SYSTEM_INFO_UTILS_SOURCE_DIFF_MATCHER_H_
+#define SYSTEM_INFO_UTILS_SOURCE_DIFF_MATCHER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace system_info_utils
+{
+    /// @brief Pairs the elements of two lists that have equal keys, using a hash index of the old list.
+    ///
+    /// Elements with the same key are paired in the order they appear in each list, so
+    /// identical devices without a unique identifier are still matched one to one.
+    /// A matcher may be reused for any number of lists, keeping its allocations.
+    template <typename Key, typename Hash = std::hash<Key>>
+    class DiffMatcher
+    {
+    public:
+        static constexpr size_t kNone = SIZE_MAX;  ///< Returned by Match when no element has the key.
+
+        /// @brief Index the elements of the old list.
+        /// @param [in] count The number of elements in the old list.
+        /// @param [in] key_of A function returning the key of the element at an index.
+        template <typename KeyOf>
+        void Index(size_t count, KeyOf key_of)
+        {
+            chains_.clear();
+            next_.assign(count, kNone);
+            matched_.assign(count, false);
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                auto result = chains_.try_emplace(key_of(i), Chain{i, i});
+                if (!result.second)
+                {
+                    Chain& chain      = result.first->second;
+                    next_[chain.last] = i;
+                    chain.last        = i;
+                }
+            }
+        }
+
+        /// @brief Find the first unmatched element of the old list with a key, and mark it as matched.
+        /// @param [in] key The key of an element of the new list.
+        /// @return The index of the old element, or kNone if there is no unmatched element with the key.
+        size_t Match(const Key& key)
+        {
+            auto iter = chains_.find(key);
+            if ((iter == chains_.end()) || (iter->second.first == kNone))
+            {
+                return kNone;
+            }
+
+            const size_t index = iter->second.first;
+            iter->second.first = next_[index];
+            matched_[index]    = true;
+
+            return index;
+        }
+
+        /// @brief Check if an element of the old list was matched.
+        /// @param [in] index The index of the old element.
+        /// @return true if the element was returned by Match, false otherwise.
+        bool IsMatched(size_t index) const
+        {
+            return matched_[index];
+        }
+
+    private:
+        /// @brief The unmatched old elements with the same key, linked through next_.
+        struct Chain
+        {
+            size_t first;  ///< The first unmatched element, or kNone.
+            size_t last;   ///< The last element.
+        };
+
+        std::unordered_map<Key, Chain, Hash> chains_;   ///< The elements of the old list by key.
+        std::vector<size_t>                  next_;     ///< The next old element with the same key, for each old element.
+        std::vector<bool>                    matched_;  ///< True for each old element that was matched.
+    };
+}  // namespace system_info_utils
+
+#endif
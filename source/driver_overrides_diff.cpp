@@ -0,0 +1,125 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Driver Overrides diff implementation
+//=============================================================================
+
+#include "driver_overrides_diff.h"
+
+#include <functional>
+
+#include "diff_matcher.h"
+
+namespace
+{
+    using driver_overrides_utils::DriverOverridesChange;
+    using driver_overrides_utils::DriverOverridesChangeType;
+    using driver_overrides_utils::DriverOverridesSetting;
+
+    /// @brief The key settings are matched by.
+    struct SettingKey
+    {
+        std::string_view component_name;  ///< The name of the component containing the setting.
+        std::string_view structure_name;  ///< The name of the structure containing the setting.
+        std::string_view setting_name;    ///< The setting name.
+
+        bool operator==(const SettingKey& other) const
+        {
+            return (setting_name == other.setting_name) && (structure_name == other.structure_name) && (component_name == other.component_name);
+        }
+    };
+
+    /// @brief Hash function for setting keys.
+    struct SettingKeyHash
+    {
+        size_t operator()(const SettingKey& key) const
+        {
+            const std::hash<std::string_view> hash;
+
+            size_t result = hash(key.component_name);
+            result        = (result * 31) ^ hash(key.structure_name);
+            result        = (result * 31) ^ hash(key.setting_name);
+            return result;
+        }
+    };
+
+    /// @brief A setting with the names of the component and structure containing it.
+    struct SettingEntry
+    {
+        SettingKey                    key;      ///< The key the setting is matched by.
+        const DriverOverridesSetting* setting;  ///< The setting.
+    };
+
+    /// @brief Flatten the settings of a Driver Overrides tree, in order.
+    /// @param [in] driver_overrides The Driver Overrides.
+    /// @param [in, out] out_entries The settings. Its previous contents are replaced.
+    void FlattenSettings(const driver_overrides_utils::DriverOverrides& driver_overrides, std::vector<SettingEntry>& out_entries)
+    {
+        out_entries.clear();
+
+        for (const driver_overrides_utils::DriverOverridesComponent& component : driver_overrides.components)
+        {
+            for (const driver_overrides_utils::DriverOverridesStructure& structure : component.structures)
+            {
+                for (const DriverOverridesSetting& setting : structure.settings)
+                {
+                    out_entries.push_back({{component.name, structure.name, setting.setting_name}, &setting});
+                }
+            }
+        }
+    }
+
+    /// @brief Check if two matched settings differ.
+    /// @param [in] old_setting The old setting.
+    /// @param [in] new_setting The new setting.
+    /// @return true if the value, value type or description differ, false otherwise.
+    bool IsModified(const DriverOverridesSetting& old_setting, const DriverOverridesSetting& new_setting)
+    {
+        return (old_setting.value_type != new_setting.value_type) || (old_setting.value != new_setting.value) ||
+               (old_setting.description != new_setting.description);
+    }
+}  // namespace
+
+namespace driver_overrides_utils
+{
+    void DriverOverridesDiff::Diff(const DriverOverrides& old_overrides, const DriverOverrides& new_overrides, std::vector<DriverOverridesChange>& out_changes)
+    {
+        out_changes.clear();
+
+        std::vector<SettingEntry> old_entries;
+        std::vector<SettingEntry> new_entries;
+        FlattenSettings(old_overrides, old_entries);
+        FlattenSettings(new_overrides, new_entries);
+
+        system_info_utils::DiffMatcher<SettingKey, SettingKeyHash> matcher;
+        matcher.Index(old_entries.size(), [&](size_t i) { return old_entries[i].key; });
+
+        for (const SettingEntry& new_entry : new_entries)
+        {
+            const size_t old_index = matcher.Match(new_entry.key);
+
+            if (old_index == system_info_utils::DiffMatcher<SettingKey, SettingKeyHash>::kNone)
+            {
+                out_changes.push_back({DriverOverridesChangeType::kAdded, new_entry.key.component_name, new_entry.key.structure_name, nullptr, new_entry.setting});
+            }
+            else if (IsModified(*old_entries[old_index].setting, *new_entry.setting))
+            {
+                out_changes.push_back({DriverOverridesChangeType::kModified,
+                                       new_entry.key.component_name,
+                                       new_entry.key.structure_name,
+                                       old_entries[old_index].setting,
+                                       new_entry.setting});
+            }
+        }
+
+        for (size_t i = 0; i < old_entries.size(); ++i)
+        {
+            if (!matcher.IsMatched(i))
+            {
+                const SettingEntry& old_entry = old_entries[i];
+                out_changes.push_back({DriverOverridesChangeType::kRemoved, old_entry.key.component_name, old_entry.key.structure_name, old_entry.setting, nullptr});
+            }
+        }
+    }
+}  // namespace driver_overrides_utils
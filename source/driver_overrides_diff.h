@@ -0,0 +1,64 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Driver Overrides diff definition
+//=============================================================================
+
+#ifndef SYSTEM_INFO_UTILS_SOURCE_DRIVER_OVERRIDES_DIFF_H_
+#define SYSTEM_INFO_UTILS_SOURCE_DRIVER_OVERRIDES_DIFF_H_
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "driver_overrides_reader.h"
+
+namespace driver_overrides_utils
+{
+    /// @brief The kind of a change between two Driver Overrides chunks.
+    enum class DriverOverridesChangeType : uint8_t
+    {
+        kAdded,    ///< The setting is only modified in the new chunk.
+        kRemoved,  ///< The setting is only modified in the old chunk.
+        kModified  ///< The setting has a different value, value type or description in each chunk.
+    };
+
+    /// @brief A change between two Driver Overrides chunks.
+    ///
+    /// The change refers to the compared structures instead of copying their strings,
+    /// so it is only valid while both of them are.
+    struct DriverOverridesChange
+    {
+        DriverOverridesChangeType     type;            ///< The kind of change.
+        std::string_view              component_name;  ///< The name of the component containing the setting.
+        std::string_view              structure_name;  ///< The name of the structure containing the setting.
+        const DriverOverridesSetting* old_setting;     ///< The setting in the old chunk, or nullptr if it was added.
+        const DriverOverridesSetting* new_setting;     ///< The setting in the new chunk, or nullptr if it was removed.
+    };
+
+    /// @brief Compares Driver Overrides chunks.
+    class DriverOverridesDiff
+    {
+    public:
+        /// @brief Default constructor
+        DriverOverridesDiff() = delete;
+
+        /// @brief Default destructor
+        ~DriverOverridesDiff() = delete;
+
+        /// @brief Lists the settings that differ between two chunks.
+        ///
+        /// Settings are matched by their component, structure and setting name, so
+        /// reordered settings are not reported. The is_driver_experiments flags are
+        /// not compared.
+        ///
+        /// @param [in] old_overrides The old Driver Overrides, e.g. from before a driver update.
+        /// @param [in] new_overrides The new Driver Overrides.
+        /// @param [in, out] out_changes The changes, in the order of the settings in the new chunk, followed by the removed settings.
+        /// Its previous contents are replaced.
+        static void Diff(const DriverOverrides& old_overrides, const DriverOverrides& new_overrides, std::vector<DriverOverridesChange>& out_changes);
+    };
+}  // namespace driver_overrides_utils
+
+#endif
@@ -7,10 +7,14 @@
 
 #include "driver_overrides_reader.h"
 
+#include <array>
+#include <utility>
+
 #include "json.hpp"
 
 #include "definitions.h"
 #include "driver_overrides_definitions.h"
+#include "driver_overrides_sax_parser.h"
 
 namespace driver_overrides_utils
 {
@@ -31,54 +35,159 @@ namespace driver_overrides_utils
         return result;
     }
 
-    /// @brief The interface for parses that process the Driver Override JSON chunk.
-    class IDriverOverridesParser
+    /// @brief Output that builds the processed Driver Overrides JSON tree.
+    class DriverOverridesJsonOutput
     {
     public:
-        /// @brief Constructor.
-        IDriverOverridesParser() = default;
+        /// @brief Set the "IsDriverExperiments" flag.
+        /// @param [in] is_driver_experiments The flag indicating the settings are Driver Experiments.
+        void SetIsDriverExperiments(bool is_driver_experiments)
+        {
+            is_driver_experiments_                          = is_driver_experiments;
+            processed_json_[kNodeStringIsDriverExperiments] = is_driver_experiments_;
 
-        /// @brief Destructor.
-        virtual ~IDriverOverridesParser()
+            // The settings are grouped differently, so the cached node no longer applies.
+            current_settings_json_ = nullptr;
+        }
+
+        /// @brief Add a setting that the user has modified.
+        /// @param [in] component_name The name of the component containing the setting.
+        /// @param [in] structure_name The name of the structure containing the setting.
+        /// @param [in] setting_json The JSON node of the setting.
+        void AddSetting(const std::string& component_name, const std::string& structure_name, const nlohmann::json& setting_json)
         {
+            nlohmann::json& settings_json = GetSettingsNode(component_name, structure_name);
+
+            settings_json.push_back(nlohmann::json::object());
+            nlohmann::json& json_settings_node = settings_json.back();
+
+            json_settings_node[kNodeStringValue]       = setting_json[kNodeStringUserOverride];
+            json_settings_node[kNodeStringSettingName] = setting_json[kNodeStringSettingName];
+            json_settings_node[kNodeStringDescription] = setting_json[kNodeStringDescription];
         }
 
-        /// @brief Process the Driver Overrides JSON node.
-        /// @param [in] driver_overrides_json The parent JSON node containing Driver Override fields.
-        /// @param [in, out] out_processed_json_text The processed JSON text.
-        /// @return True if parsing was successful, false if it failed.
-        virtual bool Process(const nlohmann::json& driver_overrides_json, std::string& out_processed_json_text)
+        /// @brief Serialize the processed JSON tree.
+        /// @param [in, out] out_processed_json_text The processed JSON text, empty if nothing was added.
+        void Dump(std::string& out_processed_json_text) const
+        {
+            if (!processed_json_.is_null())
+            {
+                out_processed_json_text = processed_json_.dump();
+            }
+            else
+            {
+                out_processed_json_text.clear();
+            }
+        }
+
+    private:
+        /// @brief Find the settings array of a structure, adding it and its component if they don't exist yet.
+        /// Settings are grouped in the chunk, so the array of the previous setting is cached.  Object members are never
+        /// moved by insertions, so the cached node stays valid while other components and structures are added.
+        /// @param [in] component_name The name of the component.
+        /// @param [in] structure_name The name of the structure.
+        /// @return The settings array of the structure.
+        nlohmann::json& GetSettingsNode(const std::string& component_name, const std::string& structure_name)
         {
-            SYSTEM_INFO_UNUSED(driver_overrides_json);
-            SYSTEM_INFO_UNUSED(out_processed_json_text);
+            if ((current_settings_json_ == nullptr) || (current_component_name_ != component_name) || (current_structure_name_ != structure_name))
+            {
+                if (is_driver_experiments_)
+                {
+                    current_settings_json_ = &processed_json_[kNodeStringStructures][structure_name];
+                }
+                else
+                {
+                    current_settings_json_ = &processed_json_[kNodeStringComponents][component_name][kNodeStringStructures][structure_name];
+                }
+
+                current_component_name_ = component_name;
+                current_structure_name_ = structure_name;
+            }
 
-            return false;
+            return *current_settings_json_;
         }
+
+        bool            is_driver_experiments_ = false;
+        nlohmann::json  processed_json_;
+        nlohmann::json* current_settings_json_ = nullptr;  ///< The settings array of the last added setting.
+        std::string     current_component_name_;           ///< The component of the last added setting.
+        std::string     current_structure_name_;           ///< The structure of the last added setting.
     };
 
-    /// @brief JSON parser V1 for Driver Overrides.
-    class DriverOverridesParserV1 : public IDriverOverridesParser
+    /// @brief Output that fills a DriverOverrides structure.
+    class DriverOverridesStructuredOutput
     {
     public:
         /// @brief Constructor.
-        DriverOverridesParserV1() = default;
+        /// @param [in, out] out_driver_overrides The structure to fill. Any previous content is removed.
+        explicit DriverOverridesStructuredOutput(DriverOverrides& out_driver_overrides)
+            : builder_(out_driver_overrides)
+        {
+        }
 
-        /// @brief Destructor.
-        virtual ~DriverOverridesParserV1() = default;
+        /// @brief Set the "IsDriverExperiments" flag.
+        /// @param [in] is_driver_experiments The flag indicating the settings are Driver Experiments.
+        void SetIsDriverExperiments(bool is_driver_experiments)
+        {
+            builder_.SetIsDriverExperiments(is_driver_experiments);
+        }
+
+        /// @brief Add a setting that the user has modified.
+        /// @param [in] component_name The name of the component containing the setting.
+        /// @param [in] structure_name The name of the structure containing the setting.
+        /// @param [in] setting_json The JSON node of the setting.
+        void AddSetting(const std::string& component_name, const std::string& structure_name, const nlohmann::json& setting_json)
+        {
+            DriverOverridesSetting& setting = builder_.AddSetting(component_name, structure_name);
 
+            GetText(setting_json, kNodeStringSettingName, setting.setting_name);
+            GetText(setting_json, kNodeStringDescription, setting.description);
+            DriverOverridesBuilder::SetValue(setting_json[kNodeStringUserOverride], setting);
+        }
+
+    private:
+        /// @brief Read a text field of a setting.
+        /// @param [in] setting_json The JSON node of the setting.
+        /// @param [in] name The name of the field.
+        /// @param [in, out] out_text The field text. Non-string values are stored as JSON text, and missing fields as an empty string.
+        static void GetText(const nlohmann::json& setting_json, const char* name, std::string& out_text)
+        {
+            auto node_iter = setting_json.find(name);
+            if (node_iter == setting_json.end())
+            {
+                out_text.clear();
+            }
+            else
+            {
+                DriverOverridesBuilder::SetText(*node_iter, out_text);
+            }
+        }
+
+        DriverOverridesBuilder builder_;
+    };
+
+    /// @brief Processes the Driver Overrides JSON node of the chunk versions using the component, structure and setting schema.
+    ///
+    /// The parse steps are bound at compile time through Derived, so the parser of a chunk version that changes part of the
+    /// schema only replaces the affected step, and the whole parse is inlined for each output type.
+    /// @tparam Derived The parser of the chunk version.
+    template <typename Derived>
+    class DriverOverridesParserBase
+    {
+    public:
         /// @brief Process the Driver Overrides JSON node.
         /// The output will contain only Driver Settings/Experiments that the user has modified.
         /// @param [in] driver_overrides_json The parent JSON node containing Driver Override fields.
-        /// @param [in, out] out_processed_json_text The JSON text for the filtered Driver Overrides.
+        /// @param [in, out] out_output The output the filtered Driver Overrides are added to.
         /// @return True if parsing was successful, false if it failed.
-        virtual bool Process(const nlohmann::json& driver_overrides_json, std::string& out_processed_json_text)
+        template <typename Output>
+        bool Process(const nlohmann::json& driver_overrides_json, Output& out_output)
         {
-            bool           result = false;
-            nlohmann::json processed_json;
+            bool result = false;
 
             if (DoesNodeExist(driver_overrides_json, kNodeStringIsDriverExperiments))
             {
-                ParseIsDriverExperiments(driver_overrides_json[kNodeStringIsDriverExperiments], processed_json);
+                GetDerived().ParseIsDriverExperiments(driver_overrides_json[kNodeStringIsDriverExperiments], out_output);
             }
             else
             {
@@ -87,41 +196,40 @@ namespace driver_overrides_utils
 
             if (DoesNodeExist(driver_overrides_json, kNodeStringComponents))
             {
-                result = ParseComponents(driver_overrides_json[kNodeStringComponents], processed_json);
-            }
-
-            if (!processed_json.is_null())
-            {
-                out_processed_json_text = processed_json.dump();
-            }
-            else
-            {
-                out_processed_json_text.clear();
+                result = GetDerived().ParseComponents(driver_overrides_json[kNodeStringComponents], out_output);
             }
 
             return result;
         }
 
     protected:
+        /// @brief Get the parser of the chunk version.
+        Derived& GetDerived()
+        {
+            return static_cast<Derived&>(*this);
+        }
+
         /// @brief Parse the "IsDriverExperiments" node.
         /// @param [in] driver_overrides_json The JSON node containing the "IsDriverExperiments" field.
-        /// @param [in, out] out_processed_json The processed Driver Overrides JSON data to include the "IsDriverExperiments" field.
+        /// @param [in, out] out_output The output to include the "IsDriverExperiments" field.
         /// @return True if parsing was successful, false if it failed.
-        bool ParseIsDriverExperiments(const nlohmann::json& driver_overrides_json, nlohmann::json& out_processed_json)
+        template <typename Output>
+        bool ParseIsDriverExperiments(const nlohmann::json& driver_overrides_json, Output& out_output)
         {
             bool result = false;
 
-            is_driver_experiments_                             = driver_overrides_json;
-            out_processed_json[kNodeStringIsDriverExperiments] = is_driver_experiments_;
+            is_driver_experiments_ = driver_overrides_json;
+            out_output.SetIsDriverExperiments(is_driver_experiments_);
 
             return result;
         }
 
         /// @brief Parse the "Components" node.
         /// @param [in] driver_overrides_json The JSON node containing the "Components" array.
-        /// @param [in, out] out_processed_json The processed Driver Overrides JSON data that includes filtered components.
+        /// @param [in, out] out_output The output to include filtered components.
         /// @return True if parsing was successful, false if it failed.
-        bool ParseComponents(const nlohmann::json& driver_overrides_json, nlohmann::json& out_processed_json)
+        template <typename Output>
+        bool ParseComponents(const nlohmann::json& driver_overrides_json, Output& out_output)
         {
             bool result = false;
 
@@ -136,7 +244,7 @@ namespace driver_overrides_utils
                 {
                     if (DoesNodeExist(components_iterator.value(), kNodeStringComponent))
                     {
-                        result = ParseComponent(components_iterator.value()[kNodeStringComponent]);
+                        result = GetDerived().ParseComponent(components_iterator.value()[kNodeStringComponent]);
                         if (!result)
                         {
                             break;
@@ -144,7 +252,7 @@ namespace driver_overrides_utils
 
                         if (DoesNodeExist(components_iterator.value(), kNodeStringStructures))
                         {
-                            result = ParseStructures(components_iterator.value()[kNodeStringStructures], out_processed_json);
+                            result = GetDerived().ParseStructures(components_iterator.value()[kNodeStringStructures], out_output);
                             if (!result)
                             {
                                 break;
@@ -172,9 +280,10 @@ namespace driver_overrides_utils
 
         /// @brief Parse the "Structures" node.
         /// @param [in] driver_overrides_json The JSON node containing the "Structures" array.
-        /// @param [in, out] out_processed_json The processed Driver Overrides JSON data to include filtered structures.
+        /// @param [in, out] out_output The output to include filtered structures.
         /// @return True if parsing was successful, false if it failed.
-        bool ParseStructures(const nlohmann::json& driver_overrides_json, nlohmann::json& out_processed_json)
+        template <typename Output>
+        bool ParseStructures(const nlohmann::json& driver_overrides_json, Output& out_output)
         {
             bool result = false;
 
@@ -187,7 +296,7 @@ namespace driver_overrides_utils
                     current_structure_name_ = kDriverOverridesmiscellaneousStructure;
                 }
 
-                result = ParseStructure(structures_iterator.value(), out_processed_json);
+                result = GetDerived().ParseStructure(structures_iterator.value(), out_output);
                 if (!result)
                 {
                     break;
@@ -199,15 +308,16 @@ namespace driver_overrides_utils
 
         /// @brief Parse the "Structure" node.
         /// @param [in] driver_overrides_json The JSON node containing the "Structure" array.  The name is cached for use later.
-        /// @param [in, out] out_processed_json The processed Driver Overrides JSON data to include filtered structures.
+        /// @param [in, out] out_output The output to include filtered structures.
         /// @return True if parsing was successful, false if it failed.
-        bool ParseStructure(const nlohmann::json& driver_overrides_json, nlohmann::json& out_processed_json)
+        template <typename Output>
+        bool ParseStructure(const nlohmann::json& driver_overrides_json, Output& out_output)
         {
             bool result = true;
             for (nlohmann::json::const_iterator structures_iterator = driver_overrides_json.begin(); structures_iterator != driver_overrides_json.end();
                  ++structures_iterator)
             {
-                result = ParseSetting(structures_iterator.value(), out_processed_json);
+                result = GetDerived().ParseSetting(structures_iterator.value(), out_output);
                 if (!result)
                 {
                     break;
@@ -219,9 +329,10 @@ namespace driver_overrides_utils
 
         /// @brief Parse the "Setting" node.
         /// @param [in] driver_overrides_json The JSON node containing the "Setting" array.
-        /// @param [in, out] out_processed_json The processed Driver Overrides JSON data to include filtered settings.
+        /// @param [in, out] out_output The output to include filtered settings.
         /// @return True if parsing was successful, false if it failed.
-        virtual bool ParseSetting(const nlohmann::json& driver_overrides_json, nlohmann::json& out_processed_json)
+        template <typename Output>
+        bool ParseSetting(const nlohmann::json& driver_overrides_json, Output& out_output)
         {
             bool result = true;
 
@@ -235,21 +346,7 @@ namespace driver_overrides_utils
             {
                 if (driver_overrides_json[kNodeStringUserOverride] == driver_overrides_json[kNodeStringCurrent])
                 {
-                    nlohmann::json json_settings_node;
-                    json_settings_node[kNodeStringValue]       = driver_overrides_json[kNodeStringUserOverride];
-                    json_settings_node[kNodeStringSettingName] = driver_overrides_json[kNodeStringSettingName];
-                    json_settings_node[kNodeStringDescription] = driver_overrides_json[kNodeStringDescription];
-
-                    if (is_driver_experiments_)
-                    {
-                        out_processed_json[kNodeStringStructures][current_structure_name_].push_back(json_settings_node);
-                    }
-                    else
-                    {
-                        nlohmann::json json_component_node;
-                        out_processed_json[kNodeStringComponents][current_component_name_][kNodeStringStructures][current_structure_name_].push_back(
-                            json_settings_node);
-                    }
+                    out_output.AddSetting(current_component_name_, current_structure_name_, driver_overrides_json);
                 }
             }
             else
@@ -260,51 +357,75 @@ namespace driver_overrides_utils
             return result;
         }
 
-    protected:
         bool        is_driver_experiments_ = false;
         std::string current_component_name_;
         std::string current_structure_name_;
     };
 
-    /// @brief Create a parser to parse a versioned chunk of Driver Overrides JSON data.
-    /// @param [in] version_number The version number of the parser instance to create.
-    /// @return A Driver Overrides JSON parser.
-    static std::shared_ptr<IDriverOverridesParser> CreateDriverOverridesParser(const uint32_t version_number)
+    /// @brief The parser of a Driver Overrides chunk version.
+    ///
+    /// A chunk version that doesn't change the schema uses the parser of the previous version. A version that does is
+    /// added as a specialization deriving from DriverOverridesParserBase, replacing the parse steps that changed.
+    /// @tparam Version The chunk version.
+    template <uint32_t Version>
+    class DriverOverridesParser : public DriverOverridesParser<Version - 1>
     {
-        std::shared_ptr<IDriverOverridesParser> result = nullptr;
+    };
 
-        switch (version_number)
-        {
-        case 1:
-            // NOTE: Version 1 not supported.
-            break;
+    /// @brief JSON parser for version 2 Driver Overrides chunks. Version 1 is not supported.
+    template <>
+    class DriverOverridesParser<2> : public DriverOverridesParserBase<DriverOverridesParser<2>>
+    {
+    };
 
-        case 2:
-        case 3:
-            result = std::make_shared<DriverOverridesParserV1>();
-            break;
+    /// @brief A function processing the Driver Overrides JSON node of one chunk version.
+    template <typename Output>
+    using ProcessDriverOverridesFunction = bool (*)(const nlohmann::json& driver_overrides_node, Output& out_output);
 
-        default:
-            return nullptr;
-            break;
-        }
+    /// @brief Process the Driver Overrides JSON node with the parser of a chunk version.
+    /// @param [in] driver_overrides_node The parent JSON node containing Driver Overrides data.
+    /// @param [in, out] out_output The output the processed Driver Overrides are added to.
+    /// @return True if parsing was successful, and false if it failed.
+    template <uint32_t Version, typename Output>
+    static bool ProcessDriverOverridesVersion(const nlohmann::json& driver_overrides_node, Output& out_output)
+    {
+        DriverOverridesParser<Version> parser;
+        return parser.Process(driver_overrides_node, out_output);
+    }
 
-        return result;
+    /// @brief Make the table of the functions processing each supported chunk version.
+    /// @return The functions, indexed by the chunk version minus kDriverOverridesChunkVersionMin.
+    template <typename Output, uint32_t... Offsets>
+    static constexpr std::array<ProcessDriverOverridesFunction<Output>, sizeof...(Offsets)> MakeProcessDriverOverridesTable(
+        std::integer_sequence<uint32_t, Offsets...>)
+    {
+        return {{&ProcessDriverOverridesVersion<kDriverOverridesChunkVersionMin + Offsets, Output>...}};
     }
 
+    /// @brief The functions processing each supported chunk version, selected without allocating a parser.
+    template <typename Output>
+    static constexpr auto kProcessDriverOverridesTable = MakeProcessDriverOverridesTable<Output>(
+        std::make_integer_sequence<uint32_t, kDriverOverridesChunkVersionMax - kDriverOverridesChunkVersionMin + 1>());
+
     /// @brief Process the Driver Overrides JSON node (the root node).
     /// @param [in] driver_overrides_node The parent JSON node containing Driver Overrides data.
     /// @param [in] version The version of the Driver Overrides JSON data.
-    /// @param [in, out] out_processed_json_text The json string after processing the Driver Overrides data.
+    /// @param [in, out] out_output The output the processed Driver Overrides are added to.
     /// @return True if parsing was successful, and false if it failed.
-    static bool ProcessDriverOverridesNode(const nlohmann::json& driver_overrides_node, std::uint32_t version, std::string& out_processed_json_text)
+    template <typename Output>
+    static bool ProcessDriverOverridesNode(const nlohmann::json& driver_overrides_node, std::uint32_t version, Output& out_output)
     {
-        bool                                    result = false;
-        std::shared_ptr<IDriverOverridesParser> parser = CreateDriverOverridesParser(version);
-        assert(parser != nullptr);
-        if (parser != nullptr)
+        bool                                   result  = false;
+        ProcessDriverOverridesFunction<Output> process = nullptr;
+        if ((version >= kDriverOverridesChunkVersionMin) && (version <= kDriverOverridesChunkVersionMax))
         {
-            result = parser->Process(driver_overrides_node, out_processed_json_text);
+            process = kProcessDriverOverridesTable<Output>[version - kDriverOverridesChunkVersionMin];
+        }
+
+        assert(process != nullptr);
+        if (process != nullptr)
+        {
+            result = process(driver_overrides_node, out_output);
         }
 
         return result;
@@ -312,14 +433,62 @@ namespace driver_overrides_utils
 
     /// @brief Implementation of the Driver Overrides Reader class.
     bool DriverOverridesReader::Parse(const std::string& driver_overrides_json_text, std::uint32_t version, std::string& out_processed_json_text)
+    {
+        return Parse(driver_overrides_json_text.data(), driver_overrides_json_text.size(), version, out_processed_json_text);
+    }
+
+    bool DriverOverridesReader::Parse(const char* driver_overrides_json_text, size_t size, std::uint32_t version, std::string& out_processed_json_text)
     {
         bool result = true;
         SYSTEM_INFO_TRY
         {
-            nlohmann::json driver_overrides_json = nlohmann::json::parse(driver_overrides_json_text);
+            nlohmann::json driver_overrides_json = nlohmann::json::parse(driver_overrides_json_text, driver_overrides_json_text + size);
 
             // Process a Driver Overrides chunk of JSON. Presumably from an RDF file.
-            result = ProcessDriverOverridesNode(driver_overrides_json, version, out_processed_json_text);
+            DriverOverridesJsonOutput output;
+            result = ProcessDriverOverridesNode(driver_overrides_json, version, output);
+            output.Dump(out_processed_json_text);
+        }
+        SYSTEM_INFO_CATCH(...)
+        {
+            // There was a failure in parsing the Driver Overrides.
+            result = false;
+        }
+
+        return result;
+    }
+
+    bool DriverOverridesReader::Parse(const std::string& driver_overrides_json_string, std::uint32_t version, DriverOverrides& out_driver_overrides)
+    {
+        return Parse(driver_overrides_json_string.data(), driver_overrides_json_string.size(), version, out_driver_overrides);
+    }
+
+    bool DriverOverridesReader::Parse(const char* driver_overrides_json_text, size_t size, std::uint32_t version, DriverOverrides& out_driver_overrides)
+    {
+        bool result = true;
+        SYSTEM_INFO_TRY
+        {
+            DriverOverridesSaxResult sax_result = DriverOverridesSaxResult::kUnsupported;
+
+            // The versions handled by DriverOverridesParser<Version> are filtered while streaming through the text, so only modified settings are allocated.
+            if ((version >= kDriverOverridesChunkVersionMin) && (version <= kDriverOverridesChunkVersionMax))
+            {
+                DriverOverridesSaxParser parser;
+                sax_result = parser.Parse(driver_overrides_json_text, size, out_driver_overrides);
+            }
+
+            if (sax_result == DriverOverridesSaxResult::kUnsupported)
+            {
+                nlohmann::json driver_overrides_json = nlohmann::json::parse(driver_overrides_json_text, driver_overrides_json_text + size);
+
+                // The settings are added to the structure directly, no processed JSON tree is built.
+                DriverOverridesStructuredOutput output(out_driver_overrides);
+                result = ProcessDriverOverridesNode(driver_overrides_json, version, output);
+            }
+            else
+            {
+                result = (sax_result == DriverOverridesSaxResult::kSucceeded);
+            }
         }
         SYSTEM_INFO_CATCH(...)
         {
@@ -331,7 +500,55 @@ namespace driver_overrides_utils
     }
 
 #ifdef DRIVER_OVERRIDES_ENABLE_RDF
+    /// @brief Resize the buffer used to read a chunk into.
+    /// @param [in, out] buffer The buffer to resize. Its capacity is kept between chunks.
+    /// @param [in] chunk_size The size of the chunk data in bytes.
+    /// @return True if the buffer holds chunk_size bytes, and false if the allocation failed.
+    static bool ResizeChunkBuffer(std::vector<char>& buffer, int64_t chunk_size)
+    {
+        bool result = false;
+
+        SYSTEM_INFO_TRY
+        {
+            buffer.resize(static_cast<size_t>(chunk_size));
+            result = true;
+        }
+        SYSTEM_INFO_CATCH(...)
+        {
+            // Out of memory.
+            result = false;
+        }
+
+        return result;
+    }
+
 #ifdef RDF_CXX_BINDINGS
+    /// @brief Read the Driver Overrides chunk data, if its version is supported.
+    /// @param [in] file The RDF file containing the chunk.
+    /// @param [in, out] buffer The buffer the chunk data is read into.
+    /// @param [out] out_version The version of the chunk.
+    /// @return True if the chunk data was read, and false if the version isn't supported or the allocation failed.
+    static bool ReadChunk(rdf::ChunkFile& file, std::vector<char>& buffer, std::uint32_t& out_version)
+    {
+        bool result = false;
+
+        // Check if the version is supported.
+        out_version = file.GetChunkVersion(kDriverOverridesChunkIdentifier);
+        if ((out_version >= kDriverOverridesChunkVersionMin) && (out_version <= kDriverOverridesChunkVersionMax))
+        {
+            // Get the size of the chunk.
+            auto chunk_size = file.GetChunkDataSize(kDriverOverridesChunkIdentifier);
+
+            if (ResizeChunkBuffer(buffer, chunk_size))
+            {
+                file.ReadChunkDataToBuffer(kDriverOverridesChunkIdentifier, buffer.data());
+                result = true;
+            }
+        }
+
+        return result;
+    }
+
     bool DriverOverridesReader::IsChunkPresent(rdf::ChunkFile& file)
     {
         bool result = false;
@@ -345,29 +562,53 @@ namespace driver_overrides_utils
     }
 
     bool DriverOverridesReader::Parse(rdf::ChunkFile& file, std::string& out_processed_json_text)
+    {
+        std::vector<char> buffer;
+        return Parse(file, out_processed_json_text, buffer);
+    }
+
+    bool DriverOverridesReader::Parse(rdf::ChunkFile& file, std::string& out_processed_json_text, std::vector<char>& buffer)
     {
         bool result = false;
         out_processed_json_text.clear();
 
         if (IsChunkPresent(file))
         {
-            // Check if the version is supported.
-            auto version = file.GetChunkVersion(kDriverOverridesChunkIdentifier);
-            if ((version >= kDriverOverridesChunkVersionMin) && (version <= kDriverOverridesChunkVersionMax))
+            std::uint32_t version{};
+            if (ReadChunk(file, buffer, version))
             {
-                // Get the size of the chunk.
-                auto chunk_size = file.GetChunkDataSize(kDriverOverridesChunkIdentifier);
+                // Parse the JSON text in place.
+                result = Parse(buffer.data(), buffer.size(), version, out_processed_json_text);
+            }
+        }
+        else
+        {
+            // This chunk is optional, so no error is returned if it's not present.
+            result = true;
+        }
 
-                char* buffer = new (std::nothrow) char[chunk_size + 1];
-                if (buffer != nullptr)
-                {
-                    file.ReadChunkDataToBuffer(kDriverOverridesChunkIdentifier, buffer);
-                    buffer[chunk_size] = '\0';
+        return result;
+    }
 
-                    // Parse the JSON text.
-                    result = Parse(buffer, version, out_processed_json_text);
-                    delete[] buffer;
-                }
+    bool DriverOverridesReader::Parse(rdf::ChunkFile& file, DriverOverrides& out_driver_overrides)
+    {
+        std::vector<char> buffer;
+        return Parse(file, out_driver_overrides, buffer);
+    }
+
+    bool DriverOverridesReader::Parse(rdf::ChunkFile& file, DriverOverrides& out_driver_overrides, std::vector<char>& buffer)
+    {
+        bool result = false;
+        out_driver_overrides.is_driver_experiments = false;
+        out_driver_overrides.components.clear();
+
+        if (IsChunkPresent(file))
+        {
+            std::uint32_t version{};
+            if (ReadChunk(file, buffer, version))
+            {
+                // Parse the JSON text in place.
+                result = Parse(buffer.data(), buffer.size(), version, out_driver_overrides);
             }
         }
         else
@@ -379,6 +620,34 @@ namespace driver_overrides_utils
         return result;
     }
 #endif  // RDF_CXX_BINDINGS
+    /// @brief Read the Driver Overrides chunk data, if its version is supported.
+    /// @param [in] file The RDF file containing the chunk.
+    /// @param [in, out] buffer The buffer the chunk data is read into.
+    /// @param [out] out_version The version of the chunk.
+    /// @return True if the chunk data was read, and false if the version isn't supported or the allocation failed.
+    static bool ReadChunk(rdfChunkFile* file, std::vector<char>& buffer, std::uint32_t& out_version)
+    {
+        bool result = false;
+
+        // Check if the version is supported.
+        out_version = 0;
+        rdfChunkFileGetChunkVersion(file, kDriverOverridesChunkIdentifier, 0, &out_version);
+        if ((out_version >= kDriverOverridesChunkVersionMin) && (out_version <= kDriverOverridesChunkVersionMax))
+        {
+            // Get the size of the chunk.
+            int64_t chunk_size{};
+            rdfChunkFileGetChunkDataSize(file, kDriverOverridesChunkIdentifier, 0, &chunk_size);
+
+            if (ResizeChunkBuffer(buffer, chunk_size))
+            {
+                rdfChunkFileReadChunkData(file, kDriverOverridesChunkIdentifier, 0, buffer.data());
+                result = true;
+            }
+        }
+
+        return result;
+    }
+
     bool DriverOverridesReader::IsChunkPresent(rdfChunkFile* file)
     {
         bool result = false;
@@ -397,6 +666,12 @@ namespace driver_overrides_utils
     }
 
     bool DriverOverridesReader::Parse(rdfChunkFile* file, std::string& out_processed_json_text)
+    {
+        std::vector<char> buffer;
+        return Parse(file, out_processed_json_text, buffer);
+    }
+
+    bool DriverOverridesReader::Parse(rdfChunkFile* file, std::string& out_processed_json_text, std::vector<char>& buffer)
     {
         assert(file != nullptr);
 
@@ -405,25 +680,43 @@ namespace driver_overrides_utils
 
         if (IsChunkPresent(file))
         {
-            // Check if the version is supported.
-            uint32_t version{};
-            rdfChunkFileGetChunkVersion(file, kDriverOverridesChunkIdentifier, 0, &version);
-            if ((version >= kDriverOverridesChunkVersionMin) && (version <= kDriverOverridesChunkVersionMax))
+            std::uint32_t version{};
+            if (ReadChunk(file, buffer, version))
             {
-                // Get the size of the chunk.
-                int64_t chunk_size{};
-                rdfChunkFileGetChunkDataSize(file, kDriverOverridesChunkIdentifier, 0, &chunk_size);
+                // Parse the JSON text in place.
+                result = Parse(buffer.data(), buffer.size(), version, out_processed_json_text);
+            }
+        }
+        else
+        {
+            // This chunk is optional, so no error is returned if it's not present.
+            result = true;
+        }
 
-                char* buffer = new (std::nothrow) char[chunk_size + 1];
-                if (buffer != nullptr)
-                {
-                    rdfChunkFileReadChunkData(file, kDriverOverridesChunkIdentifier, 0, buffer);
-                    buffer[chunk_size] = '\0';
+        return result;
+    }
 
-                    // Parse the JSON text.
-                    result = Parse(buffer, version, out_processed_json_text);
-                    delete[] buffer;
-                }
+    bool DriverOverridesReader::Parse(rdfChunkFile* file, DriverOverrides& out_driver_overrides)
+    {
+        std::vector<char> buffer;
+        return Parse(file, out_driver_overrides, buffer);
+    }
+
+    bool DriverOverridesReader::Parse(rdfChunkFile* file, DriverOverrides& out_driver_overrides, std::vector<char>& buffer)
+    {
+        assert(file != nullptr);
+
+        bool result = false;
+        out_driver_overrides.is_driver_experiments = false;
+        out_driver_overrides.components.clear();
+
+        if (IsChunkPresent(file))
+        {
+            std::uint32_t version{};
+            if (ReadChunk(file, buffer, version))
+            {
+                // Parse the JSON text in place.
+                result = Parse(buffer.data(), buffer.size(), version, out_driver_overrides);
             }
         }
         else
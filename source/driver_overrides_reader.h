@@ -11,7 +11,9 @@
 #ifndef SYSTEM_INFO_UTILS_SOURCE_DRIVER_OVERRIDES_READER_H_
 #define SYSTEM_INFO_UTILS_SOURCE_DRIVER_OVERRIDES_READER_H_
 
+#include <cstdint>
 #include <string>
+#include <vector>
 
 #ifdef DRIVER_OVERRIDES_ENABLE_RDF
 #include <amdrdf.h>
@@ -19,7 +21,52 @@
 
 namespace driver_overrides_utils
 {
+    /// @brief The JSON type of a Driver Overrides setting value.
+    enum class DriverOverridesValueType : uint8_t
+    {
+        kNull,       ///< The value is null.
+        kBool,       ///< The value is true or false.
+        kNumber,     ///< The value is an integer or floating point number.
+        kString,     ///< The value is a string.
+        kStructured  ///< The value is a JSON array or object.
+    };
+
+    /// @brief Structure containing a setting that the user has modified.
+    struct DriverOverridesSetting
+    {
+        std::string              setting_name;  ///< The setting name.
+        std::string              value;         ///< The user override value. Strings are stored as is, other types as JSON text ("1", "true").
+        DriverOverridesValueType value_type;    ///< The JSON type of the user override value.
+        std::string              description;   ///< The setting description.
+    };
+
+    /// @brief Structure containing the modified settings of a structure.
+    struct DriverOverridesStructure
+    {
+        std::string                         name;      ///< The structure name, "Misc." for unnamed structures.
+        std::vector<DriverOverridesSetting> settings;  ///< The modified settings, in chunk order.
+    };
+
+    /// @brief Structure containing the structures of a component that have modified settings.
+    struct DriverOverridesComponent
+    {
+        std::string                           name;        ///< The component name.
+        std::vector<DriverOverridesStructure> structures;  ///< The structures, in order of first appearance.
+    };
+
+    /// @brief Structure containing the Driver Overrides that the user has modified.
+    ///
+    /// Only components and structures with at least one modified setting are included.
+    /// Unlike the JSON text output, Driver Experiments keep their component level.
+    struct DriverOverrides
+    {
+        bool                                  is_driver_experiments;  ///< The flag indicating the settings are Driver Experiments.
+        std::vector<DriverOverridesComponent> components;             ///< The components, in order of first appearance.
+    };
+
     /// @brief Parses Driver Overrides RDF chunk.
+    ///
+    /// Each call uses its own parser, so the reader may be used from several threads at once.
     class DriverOverridesReader
     {
     public:
@@ -48,6 +95,30 @@ namespace driver_overrides_utils
         /// @return true if successfully parsed, false otherwise
         static bool Parse(const std::string& out_processed_json_text, std::uint32_t version, std::string& out_processed_json_string);
 
+        /// @brief Parses the Driver Overrides JSON representation in place.
+        /// @param [in] driver_overrides_json_text The Driver Overrides chunk JSON text. Does not need to be null terminated.
+        /// @param [in] size The size of the Driver Overrides chunk JSON text in bytes.
+        /// @param [in] version The version of the Driver Overrides chunk.
+        /// @param [in, out] out_processed_json_text The processed JSON string for the Driver Overrides tree.
+        /// @return true if successfully parsed, false otherwise
+        static bool Parse(const char* driver_overrides_json_text, size_t size, std::uint32_t version, std::string& out_processed_json_text);
+
+        /// @brief Parses the Driver Overrides JSON representation into a structure, without building the JSON text.
+        /// @param [in] driver_overrides_json_string The Driver Overrides chunk JSON string.
+        /// @param [in] version The version of the Driver Overrides chunk.
+        /// @param [in, out] out_driver_overrides The Driver Overrides that the user has modified.
+        /// @return true if successfully parsed, false otherwise
+        static bool Parse(const std::string& driver_overrides_json_string, std::uint32_t version, DriverOverrides& out_driver_overrides);
+
+        /// @brief Parses the Driver Overrides JSON representation in place into a structure, without building the JSON text.
+        /// The settings are filtered while streaming through the text, so only the modified settings are allocated.
+        /// @param [in] driver_overrides_json_text The Driver Overrides chunk JSON text. Does not need to be null terminated.
+        /// @param [in] size The size of the Driver Overrides chunk JSON text in bytes.
+        /// @param [in] version The version of the Driver Overrides chunk.
+        /// @param [in, out] out_driver_overrides The Driver Overrides that the user has modified.
+        /// @return true if successfully parsed, false otherwise
+        static bool Parse(const char* driver_overrides_json_text, size_t size, std::uint32_t version, DriverOverrides& out_driver_overrides);
+
 #ifdef DRIVER_OVERRIDES_ENABLE_RDF
 #ifdef RDF_CXX_BINDINGS
         /// @brief Parses driver Overrides chunk from RDF file.
@@ -60,6 +131,26 @@ namespace driver_overrides_utils
         /// @param [in, out] out_processed_json_text The processed JSON string for the Driver Overrides tree.
         /// @return true on successful parse, false otherwise
         static bool Parse(rdf::ChunkFile& file, std::string& out_processed_json_text);
+
+        /// @brief Parses driver Overrides chunk from RDF file.
+        /// @param [in] file The RDF file
+        /// @param [in, out] out_processed_json_text The processed JSON string for the Driver Overrides tree.
+        /// @param [in, out] buffer The buffer the chunk data is read into. Reusing it avoids an allocation per chunk.
+        /// @return true on successful parse, false otherwise
+        static bool Parse(rdf::ChunkFile& file, std::string& out_processed_json_text, std::vector<char>& buffer);
+
+        /// @brief Parses driver Overrides chunk from RDF file into a structure.
+        /// @param [in] file The RDF file
+        /// @param [in, out] out_driver_overrides The Driver Overrides that the user has modified.
+        /// @return true on successful parse, false otherwise
+        static bool Parse(rdf::ChunkFile& file, DriverOverrides& out_driver_overrides);
+
+        /// @brief Parses driver Overrides chunk from RDF file into a structure.
+        /// @param [in] file The RDF file
+        /// @param [in, out] out_driver_overrides The Driver Overrides that the user has modified.
+        /// @param [in, out] buffer The buffer the chunk data is read into. Reusing it avoids an allocation per chunk.
+        /// @return true on successful parse, false otherwise
+        static bool Parse(rdf::ChunkFile& file, DriverOverrides& out_driver_overrides, std::vector<char>& buffer);
 #endif
         /// @brief Parses driver Overrides chunk from RDF file.
         /// @param [in] file The RDF file
@@ -71,6 +162,26 @@ namespace driver_overrides_utils
         /// @param [in, out] out_processed_json_text The processed JSON string for the Driver Overrides tree.
         /// @return true on successful parse, false otherwise
         static bool Parse(rdfChunkFile* file, std::string& out_processed_json_text);
+
+        /// @brief Parses driver Overrides chunk from RDF file.
+        /// @param [in] file The RDF file
+        /// @param [in, out] out_processed_json_text The processed JSON string for the Driver Overrides tree.
+        /// @param [in, out] buffer The buffer the chunk data is read into. Reusing it avoids an allocation per chunk.
+        /// @return true on successful parse, false otherwise
+        static bool Parse(rdfChunkFile* file, std::string& out_processed_json_text, std::vector<char>& buffer);
+
+        /// @brief Parses driver Overrides chunk from RDF file into a structure.
+        /// @param [in] file The RDF file
+        /// @param [in, out] out_driver_overrides The Driver Overrides that the user has modified.
+        /// @return true on successful parse, false otherwise
+        static bool Parse(rdfChunkFile* file, DriverOverrides& out_driver_overrides);
+
+        /// @brief Parses driver Overrides chunk from RDF file into a structure.
+        /// @param [in] file The RDF file
+        /// @param [in, out] out_driver_overrides The Driver Overrides that the user has modified.
+        /// @param [in, out] buffer The buffer the chunk data is read into. Reusing it avoids an allocation per chunk.
+        /// @return true on successful parse, false otherwise
+        static bool Parse(rdfChunkFile* file, DriverOverrides& out_driver_overrides, std::vector<char>& buffer);
 #endif
     };
 }  // namespace driver_overrides_utils
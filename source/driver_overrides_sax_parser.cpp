@@ -0,0 +1,804 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Driver Overrides SAX parser implementation
+//=============================================================================
+
+#include "driver_overrides_sax_parser.h"
+
+#include <algorithm>
+#include <string_view>
+#include <utility>
+
+#include "definitions.h"
+#include "driver_overrides_definitions.h"
+#include "static_key_table.h"
+
+namespace
+{
+    using driver_overrides_utils::DriverOverridesSaxKey;
+
+    /// @brief The JSON object keys used by the parser and their key identifiers.
+    constexpr system_info_utils::StaticKeyEntry<DriverOverridesSaxKey> kKeyEntries[] = {
+        {driver_overrides_utils::kNodeStringIsDriverExperiments, DriverOverridesSaxKey::kIsDriverExperiments},
+        {driver_overrides_utils::kNodeStringComponents, DriverOverridesSaxKey::kComponents},
+        {driver_overrides_utils::kNodeStringComponent, DriverOverridesSaxKey::kComponent},
+        {driver_overrides_utils::kNodeStringStructures, DriverOverridesSaxKey::kStructures},
+        {driver_overrides_utils::kNodeStringSettingName, DriverOverridesSaxKey::kSettingName},
+        {driver_overrides_utils::kNodeStringUserOverride, DriverOverridesSaxKey::kUserOverride},
+        {driver_overrides_utils::kNodeStringCurrent, DriverOverridesSaxKey::kCurrent},
+        {driver_overrides_utils::kNodeStringDescription, DriverOverridesSaxKey::kDescription},
+        {driver_overrides_utils::kNodeStringSupported, DriverOverridesSaxKey::kSupported},
+    };
+
+    /// @brief The perfect hash table of the JSON object keys, built at compile time.
+    constexpr auto kKeys = system_info_utils::MakeStaticKeyTable(kKeyEntries, DriverOverridesSaxKey::kUnknown);
+    static_assert(kKeys.IsValid(), "The JSON object keys must be unique");
+
+    /// @brief Look up the key identifier for a JSON object key.
+    /// @param [in] name The JSON object key.
+    /// @return The key identifier, or DriverOverridesSaxKey::kUnknown if the key is not used by the parser.
+    DriverOverridesSaxKey LookupKey(std::string_view name)
+    {
+        return kKeys.Find(name);
+    }
+
+    /// @brief Find an element by name, adding it to the end if it doesn't exist.
+    /// @param [in, out] elements The elements to search.
+    /// @param [in] name The name of the element.
+    /// @return The index of the element.
+    template <typename T>
+    size_t FindOrAdd(std::vector<T>& elements, const std::string& name)
+    {
+        for (size_t i = 0; i < elements.size(); ++i)
+        {
+            if (elements[i].name == name)
+            {
+                return i;
+            }
+        }
+
+        elements.emplace_back();
+        elements.back().name = name;
+
+        return elements.size() - 1;
+    }
+
+}  // namespace
+
+namespace driver_overrides_utils
+{
+    DriverOverridesBuilder::DriverOverridesBuilder(DriverOverrides& driver_overrides)
+        : driver_overrides_(driver_overrides)
+        , current_component_(SIZE_MAX)
+        , current_structure_(SIZE_MAX)
+    {
+        driver_overrides_.is_driver_experiments = false;
+        driver_overrides_.components.clear();
+    }
+
+    void DriverOverridesBuilder::SetIsDriverExperiments(bool is_driver_experiments)
+    {
+        driver_overrides_.is_driver_experiments = is_driver_experiments;
+    }
+
+    void DriverOverridesBuilder::ClearComponents()
+    {
+        driver_overrides_.components.clear();
+        current_component_ = SIZE_MAX;
+        current_structure_ = SIZE_MAX;
+    }
+
+    DriverOverridesSetting& DriverOverridesBuilder::AddSetting(const std::string& component_name, const std::string& structure_name)
+    {
+        std::vector<DriverOverridesComponent>& components = driver_overrides_.components;
+
+        // Settings are grouped in the chunk, so the component and structure of the previous setting are checked first.
+        if ((current_component_ >= components.size()) || (components[current_component_].name != component_name))
+        {
+            current_component_ = FindOrAdd(components, component_name);
+            current_structure_ = SIZE_MAX;
+        }
+
+        std::vector<DriverOverridesStructure>& structures = components[current_component_].structures;
+
+        if ((current_structure_ >= structures.size()) || (structures[current_structure_].name != structure_name))
+        {
+            current_structure_ = FindOrAdd(structures, structure_name);
+        }
+
+        std::vector<DriverOverridesSetting>& settings = structures[current_structure_].settings;
+        settings.emplace_back();
+
+        return settings.back();
+    }
+
+    void DriverOverridesBuilder::SetValue(const nlohmann::json& value, DriverOverridesSetting& out_setting)
+    {
+        switch (value.type())
+        {
+        case nlohmann::json::value_t::string:
+            out_setting.value      = value.get<std::string>();
+            out_setting.value_type = DriverOverridesValueType::kString;
+            break;
+        case nlohmann::json::value_t::boolean:
+            out_setting.value      = value.dump();
+            out_setting.value_type = DriverOverridesValueType::kBool;
+            break;
+        case nlohmann::json::value_t::number_integer:
+        case nlohmann::json::value_t::number_unsigned:
+        case nlohmann::json::value_t::number_float:
+            out_setting.value      = value.dump();
+            out_setting.value_type = DriverOverridesValueType::kNumber;
+            break;
+        case nlohmann::json::value_t::object:
+        case nlohmann::json::value_t::array:
+        case nlohmann::json::value_t::binary:
+            out_setting.value      = value.dump();
+            out_setting.value_type = DriverOverridesValueType::kStructured;
+            break;
+        default:
+            out_setting.value.clear();
+            out_setting.value_type = DriverOverridesValueType::kNull;
+            break;
+        }
+    }
+
+    void DriverOverridesBuilder::SetText(const nlohmann::json& value, std::string& out_text)
+    {
+        if (value.is_string())
+        {
+            out_text = value.get<std::string>();
+        }
+        else
+        {
+            out_text = value.dump();
+        }
+    }
+
+    DriverOverridesSaxParser::DriverOverridesSaxParser()
+        : builder_(nullptr)
+        , pending_count_(0)
+        , component_has_name_(false)
+        , component_has_structures_(false)
+        , setting_name_()
+        , description_()
+        , user_override_()
+        , current_()
+        , supported_()
+        , components_empty_(false)
+        , stopped_(false)
+        , result_(false)
+        , unsupported_(false)
+    {
+        // Deep enough for the Driver Overrides schema, so parsing never grows the stack.
+        frames_.reserve(16);
+    }
+
+    DriverOverridesSaxResult DriverOverridesSaxParser::Parse(const char* data, size_t size, DriverOverrides& out_driver_overrides)
+    {
+        DriverOverridesBuilder builder(out_driver_overrides);
+
+        builder_                  = &builder;
+        pending_count_            = 0;
+        component_has_name_       = false;
+        component_has_structures_ = false;
+        components_empty_         = false;
+        stopped_                  = false;
+        result_                   = false;
+        unsupported_              = false;
+        frames_.clear();
+
+        const bool parsed = nlohmann::json::sax_parse(data, data + size, this);
+
+        builder_ = nullptr;
+
+        if (unsupported_)
+        {
+            return DriverOverridesSaxResult::kUnsupported;
+        }
+
+        // The result is only set once a "Components" node has been found.
+        return (parsed && result_) ? DriverOverridesSaxResult::kSucceeded : DriverOverridesSaxResult::kFailed;
+    }
+
+    bool DriverOverridesSaxParser::null()
+    {
+        DriverOverridesSaxValue value = {};
+        value.type                    = nlohmann::json::value_t::null;
+        return OnValue(value);
+    }
+
+    bool DriverOverridesSaxParser::boolean(bool val)
+    {
+        DriverOverridesSaxValue value = {};
+        value.type                    = nlohmann::json::value_t::boolean;
+        value.boolean                 = val;
+        return OnValue(value);
+    }
+
+    bool DriverOverridesSaxParser::number_integer(nlohmann::json::number_integer_t val)
+    {
+        DriverOverridesSaxValue value = {};
+        value.type                    = nlohmann::json::value_t::number_integer;
+        value.number_integer          = val;
+        return OnValue(value);
+    }
+
+    bool DriverOverridesSaxParser::number_unsigned(nlohmann::json::number_unsigned_t val)
+    {
+        DriverOverridesSaxValue value = {};
+        value.type                    = nlohmann::json::value_t::number_unsigned;
+        value.number_unsigned         = val;
+        return OnValue(value);
+    }
+
+    bool DriverOverridesSaxParser::number_float(nlohmann::json::number_float_t val, const nlohmann::json::string_t& text)
+    {
+        SYSTEM_INFO_UNUSED(text);
+
+        DriverOverridesSaxValue value = {};
+        value.type                    = nlohmann::json::value_t::number_float;
+        value.number_float            = val;
+        return OnValue(value);
+    }
+
+    bool DriverOverridesSaxParser::string(nlohmann::json::string_t& val)
+    {
+        DriverOverridesSaxValue value = {};
+        value.type                    = nlohmann::json::value_t::string;
+        value.string                  = &val;
+        return OnValue(value);
+    }
+
+    bool DriverOverridesSaxParser::binary(nlohmann::json::binary_t& val)
+    {
+        SYSTEM_INFO_UNUSED(val);
+
+        // Binary values only exist in binary formats, which are never used for Driver Overrides.
+        return false;
+    }
+
+    bool DriverOverridesSaxParser::start_object(std::size_t element_count)
+    {
+        SYSTEM_INFO_UNUSED(element_count);
+
+        return OnStartContainer(false);
+    }
+
+    bool DriverOverridesSaxParser::key(nlohmann::json::string_t& val)
+    {
+        Frame& frame = frames_.back();
+
+        switch (frame.node)
+        {
+        case DriverOverridesSaxNode::kSkip:
+            break;
+
+        case DriverOverridesSaxNode::kStructureMap:
+            // Structures are keyed by the structure name.
+            StartStructure(val);
+            break;
+
+        default:
+            frame.key = LookupKey(val);
+            break;
+        }
+
+        return true;
+    }
+
+    bool DriverOverridesSaxParser::end_object()
+    {
+        return OnEndContainer();
+    }
+
+    bool DriverOverridesSaxParser::start_array(std::size_t element_count)
+    {
+        SYSTEM_INFO_UNUSED(element_count);
+
+        return OnStartContainer(true);
+    }
+
+    bool DriverOverridesSaxParser::end_array()
+    {
+        return OnEndContainer();
+    }
+
+    bool DriverOverridesSaxParser::parse_error(std::size_t position, const std::string& last_token, const nlohmann::json::exception& exception)
+    {
+        SYSTEM_INFO_UNUSED(position);
+        SYSTEM_INFO_UNUSED(last_token);
+        SYSTEM_INFO_UNUSED(exception);
+
+        // Invalid JSON text fails in the same way as the DOM based parser.
+        return false;
+    }
+
+    bool DriverOverridesSaxParser::OnValue(const DriverOverridesSaxValue& value)
+    {
+        if (frames_.empty())
+        {
+            // The root node is not an object.
+            return Unsupported();
+        }
+
+        const Frame& frame = frames_.back();
+
+        switch (frame.node)
+        {
+        case DriverOverridesSaxNode::kRoot:
+            if (frame.key == DriverOverridesSaxKey::kIsDriverExperiments)
+            {
+                if (value.type != nlohmann::json::value_t::boolean)
+                {
+                    return Unsupported();
+                }
+
+                builder_->SetIsDriverExperiments(value.boolean);
+            }
+            else if (frame.key == DriverOverridesSaxKey::kComponents)
+            {
+                // A null list has no components. Any other scalar is a single element without a "Component" field.
+                StartComponents();
+                result_ = (value.type == nlohmann::json::value_t::null);
+            }
+            break;
+
+        case DriverOverridesSaxNode::kComponentList:
+            // Elements that are not objects have no "Component" field, so they are ignored.
+            components_empty_ = false;
+            break;
+
+        case DriverOverridesSaxNode::kComponent:
+            if (frame.key == DriverOverridesSaxKey::kComponent)
+            {
+                if (value.type != nlohmann::json::value_t::string)
+                {
+                    return Unsupported();
+                }
+
+                component_name_     = *value.string;
+                component_has_name_ = true;
+            }
+            else if (frame.key == DriverOverridesSaxKey::kStructures)
+            {
+                // A null node has no structures, which fails like an empty object.
+                if (value.type != nlohmann::json::value_t::null)
+                {
+                    return Unsupported();
+                }
+
+                component_has_structures_ = true;
+                pending_count_            = 0;
+            }
+            break;
+
+        case DriverOverridesSaxNode::kStructureMap:
+            // A null structure has no settings. Any other scalar is a single setting without an override value.
+            if (value.type != nlohmann::json::value_t::null)
+            {
+                pending_structures_[pending_count_ - 1].valid = false;
+            }
+            break;
+
+        case DriverOverridesSaxNode::kSettingList:
+            // A setting that is not an object has no override value.
+            pending_structures_[pending_count_ - 1].valid = false;
+            break;
+
+        case DriverOverridesSaxNode::kSetting:
+            switch (frame.key)
+            {
+            case DriverOverridesSaxKey::kSupported:
+                if (value.type != nlohmann::json::value_t::boolean)
+                {
+                    return Unsupported();
+                }
+
+                SetField(value, supported_);
+                break;
+            case DriverOverridesSaxKey::kUserOverride:
+                SetField(value, user_override_);
+                break;
+            case DriverOverridesSaxKey::kCurrent:
+                SetField(value, current_);
+                break;
+            case DriverOverridesSaxKey::kSettingName:
+                SetField(value, setting_name_);
+                break;
+            case DriverOverridesSaxKey::kDescription:
+                SetField(value, description_);
+                break;
+            default:
+                break;
+            }
+            break;
+
+        default:
+            break;
+        }
+
+        return true;
+    }
+
+    bool DriverOverridesSaxParser::OnStartContainer(bool is_array)
+    {
+        if (frames_.empty())
+        {
+            if (is_array)
+            {
+                return Unsupported();
+            }
+
+            frames_.push_back({DriverOverridesSaxNode::kRoot, DriverOverridesSaxKey::kUnknown, false});
+            return true;
+        }
+
+        const Frame&           frame = frames_.back();
+        DriverOverridesSaxNode child = DriverOverridesSaxNode::kSkip;
+
+        switch (frame.node)
+        {
+        case DriverOverridesSaxNode::kRoot:
+            if (frame.key == DriverOverridesSaxKey::kComponents)
+            {
+                if (!is_array)
+                {
+                    return Unsupported();
+                }
+
+                StartComponents();
+                child = DriverOverridesSaxNode::kComponentList;
+            }
+            else if (frame.key == DriverOverridesSaxKey::kIsDriverExperiments)
+            {
+                return Unsupported();
+            }
+            break;
+
+        case DriverOverridesSaxNode::kComponentList:
+            components_empty_ = false;
+
+            // Once a component has failed, the remaining components are not processed.
+            if (!is_array && !stopped_)
+            {
+                component_has_name_       = false;
+                component_has_structures_ = false;
+                pending_count_            = 0;
+                child                     = DriverOverridesSaxNode::kComponent;
+            }
+            break;
+
+        case DriverOverridesSaxNode::kComponent:
+            if (frame.key == DriverOverridesSaxKey::kComponent)
+            {
+                return Unsupported();
+            }
+
+            if (frame.key == DriverOverridesSaxKey::kStructures)
+            {
+                if (is_array)
+                {
+                    return Unsupported();
+                }
+
+                component_has_structures_ = true;
+                pending_count_            = 0;
+                child                     = DriverOverridesSaxNode::kStructureMap;
+            }
+            break;
+
+        case DriverOverridesSaxNode::kStructureMap:
+            if (!is_array)
+            {
+                return Unsupported();
+            }
+
+            child = DriverOverridesSaxNode::kSettingList;
+            break;
+
+        case DriverOverridesSaxNode::kSettingList:
+        {
+            PendingStructure& structure = pending_structures_[pending_count_ - 1];
+            if (is_array)
+            {
+                // A setting that is not an object has no override value.
+                structure.valid = false;
+            }
+            else if (structure.valid)
+            {
+                setting_name_.found  = false;
+                description_.found   = false;
+                user_override_.found = false;
+                current_.found       = false;
+                supported_.found     = false;
+                child                = DriverOverridesSaxNode::kSetting;
+            }
+
+            // The settings after an invalid setting are not processed.
+            break;
+        }
+
+        case DriverOverridesSaxNode::kSetting:
+            switch (frame.key)
+            {
+            case DriverOverridesSaxKey::kSupported:
+            case DriverOverridesSaxKey::kUserOverride:
+            case DriverOverridesSaxKey::kCurrent:
+            case DriverOverridesSaxKey::kSettingName:
+            case DriverOverridesSaxKey::kDescription:
+                return Unsupported();
+            default:
+                break;
+            }
+            break;
+
+        default:
+            break;
+        }
+
+        frames_.push_back({child, DriverOverridesSaxKey::kUnknown, is_array});
+
+        return true;
+    }
+
+    bool DriverOverridesSaxParser::OnEndContainer()
+    {
+        const DriverOverridesSaxNode node = frames_.back().node;
+        frames_.pop_back();
+
+        switch (node)
+        {
+        case DriverOverridesSaxNode::kComponentList:
+            if (components_empty_)
+            {
+                result_ = true;
+            }
+            break;
+
+        case DriverOverridesSaxNode::kComponent:
+            FinishComponent();
+            break;
+
+        case DriverOverridesSaxNode::kSetting:
+            FinishSetting();
+            break;
+
+        default:
+            break;
+        }
+
+        return true;
+    }
+
+    bool DriverOverridesSaxParser::Unsupported()
+    {
+        unsupported_ = true;
+        return false;
+    }
+
+    void DriverOverridesSaxParser::StartComponents()
+    {
+        // The last "Components" node replaces any previous one.
+        builder_->ClearComponents();
+        components_empty_ = true;
+        stopped_          = false;
+        result_           = false;
+    }
+
+    void DriverOverridesSaxParser::StartStructure(const std::string& key)
+    {
+        // The last structure with a key replaces any previous one, so it is moved to the end and reused.
+        for (size_t i = 0; i < pending_count_; ++i)
+        {
+            if (pending_structures_[i].key == key)
+            {
+                std::swap(pending_structures_[i], pending_structures_[pending_count_ - 1]);
+                --pending_count_;
+                break;
+            }
+        }
+
+        if (pending_count_ == pending_structures_.size())
+        {
+            pending_structures_.emplace_back();
+        }
+
+        PendingStructure& structure = pending_structures_[pending_count_++];
+        structure.key               = key;
+        structure.valid             = true;
+        structure.settings.clear();
+    }
+
+    void DriverOverridesSaxParser::FinishSetting()
+    {
+        if (supported_.found && !supported_.boolean)
+        {
+            // Skip this setting if it's not supported.
+            return;
+        }
+
+        PendingStructure& structure = pending_structures_[pending_count_ - 1];
+
+        if (!user_override_.found || !current_.found)
+        {
+            structure.valid = false;
+            return;
+        }
+
+        if (IsOverrideCurrent())
+        {
+            structure.settings.emplace_back();
+            DriverOverridesSetting& setting = structure.settings.back();
+
+            GetText(setting_name_, setting.setting_name);
+            GetText(description_, setting.description);
+
+            if (user_override_.type == nlohmann::json::value_t::string)
+            {
+                setting.value      = user_override_.string;
+                setting.value_type = DriverOverridesValueType::kString;
+            }
+            else
+            {
+                DriverOverridesBuilder::SetValue(ToJson(user_override_), setting);
+            }
+        }
+    }
+
+    void DriverOverridesSaxParser::FinishComponent()
+    {
+        if (!component_has_name_)
+        {
+            // Components without a name are ignored.
+            return;
+        }
+
+        result_ = !component_name_.empty();
+
+        if (result_ && component_has_structures_)
+        {
+            // An empty "Structures" node fails.
+            result_ = (pending_count_ > 0);
+
+            // The DOM based parser visits the structures in key order.
+            std::sort(pending_structures_.begin(),
+                      pending_structures_.begin() + pending_count_,
+                      [](const PendingStructure& a, const PendingStructure& b) { return a.key < b.key; });
+
+            for (size_t i = 0; result_ && (i < pending_count_); ++i)
+            {
+                PendingStructure& structure = pending_structures_[i];
+                if (structure.key.empty())
+                {
+                    structure.key = kDriverOverridesmiscellaneousStructure;
+                }
+
+                for (DriverOverridesSetting& setting : structure.settings)
+                {
+                    builder_->AddSetting(component_name_, structure.key) = std::move(setting);
+                }
+
+                result_ = structure.valid;
+            }
+        }
+
+        // Once a component has failed, the remaining components are not processed.
+        stopped_ = !result_;
+    }
+
+    bool DriverOverridesSaxParser::IsOverrideCurrent() const
+    {
+        using value_t = nlohmann::json::value_t;
+
+        const ScalarField& lhs = user_override_;
+        const ScalarField& rhs = current_;
+
+        if (lhs.type == rhs.type)
+        {
+            switch (lhs.type)
+            {
+            case value_t::null:
+                return true;
+            case value_t::boolean:
+                return lhs.boolean == rhs.boolean;
+            case value_t::number_integer:
+                return lhs.number_integer == rhs.number_integer;
+            case value_t::number_unsigned:
+                return lhs.number_unsigned == rhs.number_unsigned;
+            case value_t::number_float:
+                return lhs.number_float == rhs.number_float;
+            case value_t::string:
+                return lhs.string == rhs.string;
+            default:
+                return false;
+            }
+        }
+
+        // Numbers of different types are compared in the same way as nlohmann::json::operator==.
+        if ((lhs.type == value_t::number_integer) && (rhs.type == value_t::number_float))
+        {
+            return static_cast<nlohmann::json::number_float_t>(lhs.number_integer) == rhs.number_float;
+        }
+
+        if ((lhs.type == value_t::number_float) && (rhs.type == value_t::number_integer))
+        {
+            return lhs.number_float == static_cast<nlohmann::json::number_float_t>(rhs.number_integer);
+        }
+
+        if ((lhs.type == value_t::number_unsigned) && (rhs.type == value_t::number_float))
+        {
+            return static_cast<nlohmann::json::number_float_t>(lhs.number_unsigned) == rhs.number_float;
+        }
+
+        if ((lhs.type == value_t::number_float) && (rhs.type == value_t::number_unsigned))
+        {
+            return lhs.number_float == static_cast<nlohmann::json::number_float_t>(rhs.number_unsigned);
+        }
+
+        if ((lhs.type == value_t::number_unsigned) && (rhs.type == value_t::number_integer))
+        {
+            return static_cast<nlohmann::json::number_integer_t>(lhs.number_unsigned) == rhs.number_integer;
+        }
+
+        if ((lhs.type == value_t::number_integer) && (rhs.type == value_t::number_unsigned))
+        {
+            return lhs.number_integer == static_cast<nlohmann::json::number_integer_t>(rhs.number_unsigned);
+        }
+
+        return false;
+    }
+
+    void DriverOverridesSaxParser::SetField(const DriverOverridesSaxValue& value, ScalarField& out_field)
+    {
+        out_field.found           = true;
+        out_field.type            = value.type;
+        out_field.boolean         = value.boolean;
+        out_field.number_integer  = value.number_integer;
+        out_field.number_unsigned = value.number_unsigned;
+        out_field.number_float    = value.number_float;
+
+        if (value.type == nlohmann::json::value_t::string)
+        {
+            // Reuses the buffer of the previous setting.
+            out_field.string = *value.string;
+        }
+    }
+
+    void DriverOverridesSaxParser::GetText(const ScalarField& field, std::string& out_text)
+    {
+        if (!field.found)
+        {
+            out_text.clear();
+        }
+        else if (field.type == nlohmann::json::value_t::string)
+        {
+            out_text = field.string;
+        }
+        else
+        {
+            out_text = ToJson(field).dump();
+        }
+    }
+
+    nlohmann::json DriverOverridesSaxParser::ToJson(const ScalarField& field)
+    {
+        switch (field.type)
+        {
+        case nlohmann::json::value_t::boolean:
+            return nlohmann::json(field.boolean);
+        case nlohmann::json::value_t::number_integer:
+            return nlohmann::json(field.number_integer);
+        case nlohmann::json::value_t::number_unsigned:
+            return nlohmann::json(field.number_unsigned);
+        case nlohmann::json::value_t::number_float:
+            return nlohmann::json(field.number_float);
+        case nlohmann::json::value_t::string:
+            return nlohmann::json(field.string);
+        default:
+            return nlohmann::json();
+        }
+    }
+}  // namespace driver_overrides_utils
@@ -0,0 +1,273 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Driver Overrides SAX parser definition
+///
+/// The SAX parser filters the Driver Overrides JSON token stream, keeping only
+/// the settings that the user has modified, without building an nlohmann::json DOM.
+//=============================================================================
+
+#ifndef DRIVER_OVERRIDES_UTILS_SOURCE_DRIVER_OVERRIDES_SAX_PARSER_H_
+#define DRIVER_OVERRIDES_UTILS_SOURCE_DRIVER_OVERRIDES_SAX_PARSER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "json.hpp"
+
+#include "driver_overrides_reader.h"
+
+namespace driver_overrides_utils
+{
+    /// @brief Appends modified settings to a DriverOverrides structure.
+    ///
+    /// Components and structures with the same name are merged, in order of first appearance.
+    class DriverOverridesBuilder
+    {
+    public:
+        /// @brief Constructor.
+        /// @param [in, out] driver_overrides The structure to fill. Any previous content is removed.
+        explicit DriverOverridesBuilder(DriverOverrides& driver_overrides);
+
+        /// @brief Set the "IsDriverExperiments" flag.
+        /// @param [in] is_driver_experiments The flag indicating the settings are Driver Experiments.
+        void SetIsDriverExperiments(bool is_driver_experiments);
+
+        /// @brief Remove all components.
+        void ClearComponents();
+
+        /// @brief Add a default initialized setting.
+        /// @param [in] component_name The name of the component containing the setting.
+        /// @param [in] structure_name The name of the structure containing the setting.
+        /// @return The new setting.
+        DriverOverridesSetting& AddSetting(const std::string& component_name, const std::string& structure_name);
+
+        /// @brief Set the value of a setting from a JSON value.
+        /// @param [in] value The user override value.
+        /// @param [in, out] out_setting The setting to update.
+        static void SetValue(const nlohmann::json& value, DriverOverridesSetting& out_setting);
+
+        /// @brief Convert a JSON value to text.
+        /// @param [in] value The JSON value.
+        /// @param [in, out] out_text The string itself for strings, the JSON text for other types.
+        static void SetText(const nlohmann::json& value, std::string& out_text);
+
+    private:
+        DriverOverrides& driver_overrides_;   ///< The structure being filled.
+        size_t           current_component_;  ///< The index of the component of the last setting.
+        size_t           current_structure_;  ///< The index of the structure of the last setting.
+    };
+
+    /// @brief The JSON object keys recognized by the SAX parser.
+    enum class DriverOverridesSaxKey : uint8_t
+    {
+        kUnknown,
+        kIsDriverExperiments,
+        kComponents,
+        kComponent,
+        kStructures,
+        kSettingName,
+        kUserOverride,
+        kCurrent,
+        kDescription,
+        kSupported
+    };
+
+    /// @brief The JSON nodes the SAX parser can be positioned in.
+    enum class DriverOverridesSaxNode : uint8_t
+    {
+        kSkip,           ///< A node whose contents are ignored.
+        kRoot,           ///< The root object.
+        kComponentList,  ///< The "Components" array.
+        kComponent,      ///< An element of the "Components" array.
+        kStructureMap,   ///< The "Structures" object of a component, keyed by structure name.
+        kSettingList,    ///< The settings array of a structure.
+        kSetting         ///< An element of a settings array.
+    };
+
+    /// @brief The result of parsing a Driver Overrides chunk with the SAX parser.
+    enum class DriverOverridesSaxResult : uint8_t
+    {
+        kSucceeded,   ///< The chunk was parsed.
+        kFailed,      ///< The chunk is invalid.
+        kUnsupported  ///< The chunk has an unusual layout, the DOM based parser must be used to get the same result.
+    };
+
+    /// @brief A scalar JSON value as reported by the SAX interface.
+    struct DriverOverridesSaxValue
+    {
+        nlohmann::json::value_t           type;             ///< The type of the value.
+        bool                              boolean;          ///< The value when type is boolean.
+        nlohmann::json::number_integer_t  number_integer;   ///< The value when type is number_integer.
+        nlohmann::json::number_unsigned_t number_unsigned;  ///< The value when type is number_unsigned.
+        nlohmann::json::number_float_t    number_float;     ///< The value when type is number_float.
+        const nlohmann::json::string_t*   string;           ///< The value when type is string.
+    };
+
+    /// @brief Parses the Driver Overrides JSON representation using the nlohmann::json SAX interface.
+    ///
+    /// Settings are buffered only if they pass the override filter, so memory use is
+    /// proportional to the output rather than the chunk. The output and result match
+    /// the DOM based parser: settings are only compared once all their fields have been
+    /// read, and the structures of a component are added in key order with the last of
+    /// any duplicated keys winning.
+    ///
+    /// A parser instance may be reused for any number of documents, but must not be
+    /// shared between threads.
+    class DriverOverridesSaxParser
+    {
+    public:
+        /// @brief Constructor.
+        DriverOverridesSaxParser();
+
+        /// @brief Destructor.
+        ~DriverOverridesSaxParser() = default;
+
+        /// @brief Parses Driver Overrides JSON text.
+        /// @param [in] data The Driver Overrides JSON text. Does not need to be null terminated.
+        /// @param [in] size The size of the JSON text in bytes.
+        /// @param [in, out] out_driver_overrides The Driver Overrides that the user has modified.
+        /// @return The result of the parse.
+        DriverOverridesSaxResult Parse(const char* data, size_t size, DriverOverrides& out_driver_overrides);
+
+        /// @brief SAX event for a null value.
+        bool null();
+
+        /// @brief SAX event for a boolean value.
+        bool boolean(bool value);
+
+        /// @brief SAX event for a signed integer value.
+        bool number_integer(nlohmann::json::number_integer_t value);
+
+        /// @brief SAX event for an unsigned integer value.
+        bool number_unsigned(nlohmann::json::number_unsigned_t value);
+
+        /// @brief SAX event for a floating point value.
+        bool number_float(nlohmann::json::number_float_t value, const nlohmann::json::string_t& text);
+
+        /// @brief SAX event for a string value.
+        bool string(nlohmann::json::string_t& value);
+
+        /// @brief SAX event for a binary value. Never generated for JSON text.
+        bool binary(nlohmann::json::binary_t& value);
+
+        /// @brief SAX event for the beginning of an object.
+        bool start_object(std::size_t element_count);
+
+        /// @brief SAX event for an object key.
+        bool key(nlohmann::json::string_t& value);
+
+        /// @brief SAX event for the end of an object.
+        bool end_object();
+
+        /// @brief SAX event for the beginning of an array.
+        bool start_array(std::size_t element_count);
+
+        /// @brief SAX event for the end of an array.
+        bool end_array();
+
+        /// @brief SAX event for a syntax error.
+        bool parse_error(std::size_t position, const std::string& last_token, const nlohmann::json::exception& exception);
+
+    private:
+        /// @brief A container currently being parsed.
+        struct Frame
+        {
+            DriverOverridesSaxNode node;      ///< The node describing the container.
+            DriverOverridesSaxKey  key;       ///< The key of the member currently being parsed, for objects.
+            bool                   is_array;  ///< True if the container is an array, false if it is an object.
+        };
+
+        /// @brief A scalar field of the current setting. The string keeps its buffer between settings.
+        struct ScalarField
+        {
+            bool                              found;            ///< True if the setting contains the field.
+            nlohmann::json::value_t           type;             ///< The type of the value.
+            bool                              boolean;          ///< The value when type is boolean.
+            nlohmann::json::number_integer_t  number_integer;   ///< The value when type is number_integer.
+            nlohmann::json::number_unsigned_t number_unsigned;  ///< The value when type is number_unsigned.
+            nlohmann::json::number_float_t    number_float;     ///< The value when type is number_float.
+            std::string                       string;           ///< The value when type is string.
+        };
+
+        /// @brief The structures of the current component, which are added to the output once the component is complete.
+        struct PendingStructure
+        {
+            std::string                         key;       ///< The structure key in the chunk.
+            std::vector<DriverOverridesSetting> settings;  ///< The modified settings.
+            bool                                valid;     ///< False once a setting without an override or current value was found.
+        };
+
+        /// @brief Handle a scalar value.
+        /// @param [in] value The scalar JSON value.
+        /// @return false to stop parsing, true otherwise.
+        bool OnValue(const DriverOverridesSaxValue& value);
+
+        /// @brief Handle the beginning of an object or array.
+        /// @param [in] is_array True if the container is an array, false if it is an object.
+        /// @return false to stop parsing, true otherwise.
+        bool OnStartContainer(bool is_array);
+
+        /// @brief Handle the end of an object or array.
+        /// @return false to stop parsing, true otherwise.
+        bool OnEndContainer();
+
+        /// @brief Stop parsing because the DOM based parser is needed for this chunk.
+        /// @return false, to stop parsing.
+        bool Unsupported();
+
+        /// @brief Start a "Components" node, replacing the components of any previous one.
+        void StartComponents();
+
+        /// @brief Start a structure of the current component, replacing any previous one with the same key.
+        /// @param [in] key The structure key in the chunk.
+        void StartStructure(const std::string& key);
+
+        /// @brief Apply the override filter to the current setting once all its fields have been read.
+        void FinishSetting();
+
+        /// @brief Add the structures of the current component to the output once the component is complete.
+        void FinishComponent();
+
+        /// @brief Check if the override value of the current setting equals its current value, using the nlohmann::json comparison rules.
+        /// @return true if the values are equal, false otherwise.
+        bool IsOverrideCurrent() const;
+
+        /// @brief Copy a scalar value into a setting field.
+        /// @param [in] value The scalar JSON value.
+        /// @param [in, out] out_field The setting field.
+        static void SetField(const DriverOverridesSaxValue& value, ScalarField& out_field);
+
+        /// @brief Convert a text field of a setting.
+        /// @param [in] field The scalar field.
+        /// @param [in, out] out_text The field text. Non-string values are stored as JSON text, and missing fields as an empty string.
+        static void GetText(const ScalarField& field, std::string& out_text);
+
+        /// @brief Convert a scalar field to a JSON value.
+        /// @param [in] field The scalar field.
+        /// @return The JSON value.
+        static nlohmann::json ToJson(const ScalarField& field);
+
+        DriverOverridesBuilder*       builder_;                   ///< The output being filled.
+        std::vector<Frame>            frames_;                    ///< The stack of containers currently being parsed.
+        std::vector<PendingStructure> pending_structures_;        ///< The structures of the current component, buffers are reused between components.
+        size_t                        pending_count_;             ///< The number of pending structures in use.
+        std::string                   component_name_;            ///< The name of the current component.
+        bool                          component_has_name_;        ///< True if the current component contains a "Component" field.
+        bool                          component_has_structures_;  ///< True if the current component contains a "Structures" field.
+        ScalarField                   setting_name_;              ///< The "SettingName" field of the current setting.
+        ScalarField                   description_;               ///< The "Description" field of the current setting.
+        ScalarField                   user_override_;             ///< The "UserOverride" field of the current setting.
+        ScalarField                   current_;                   ///< The "Current" field of the current setting.
+        ScalarField                   supported_;                 ///< The "Supported" field of the current setting.
+        bool                          components_empty_;          ///< True if the "Components" array has no elements so far.
+        bool                          stopped_;                   ///< True once the DOM based parser would have stopped processing components.
+        bool                          result_;                    ///< The result the DOM based parser would return for the components so far.
+        bool                          unsupported_;               ///< True if the chunk needs the DOM based parser.
+    };
+}  // namespace driver_overrides_utils
+
+#endif  // DRIVER_OVERRIDES_UTILS_SOURCE_DRIVER_OVERRIDES_SAX_PARSER_H_
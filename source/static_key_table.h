@@ -0,0 +1,143 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Compile time perfect hash key table definition
+//=============================================================================
+
+#ifndef SYSTEM_INFO_UTILS_SOURCE_STATIC_KEY_TABLE_H_
+#define SYSTEM_INFO_UTILS_SOURCE_STATIC_KEY_TABLE_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace system_info_utils
+{
+    /// @brief A key of a StaticKeyTable and the value it maps to.
+    template <typename Value>
+    struct StaticKeyEntry
+    {
+        std::string_view key   = {};  ///< The key.
+        Value            value = {};  ///< The value the key maps to.
+    };
+
+    /// @brief Maps a fixed set of string keys to values through a perfect hash built at compile time.
+    ///
+    /// The hash seed is searched for when the table is constructed, so a constexpr table has no
+    /// runtime initialization and a lookup is a single hash, a table read and one key comparison.
+    /// The slot array is sparse, with at least 8 slots per key, which keeps the seed search short.
+    template <typename Value, size_t Count>
+    class StaticKeyTable
+    {
+    public:
+        static_assert(Count < 255, "The slot array stores the entry index in a byte");
+
+        /// @brief Constructor.
+        /// @param [in] entries The keys and their values. The keys must be unique.
+        /// @param [in] missing The value returned for keys that are not in the table.
+        constexpr StaticKeyTable(const StaticKeyEntry<Value> (&entries)[Count], Value missing)
+            : entries_()
+            , slots_()
+            , seed_(0)
+            , missing_(missing)
+            , valid_(false)
+        {
+            for (size_t i = 0; i < Count; ++i)
+            {
+                entries_[i] = entries[i];
+            }
+
+            for (uint32_t seed = 0; (seed < kMaxSeed) && !valid_; ++seed)
+            {
+                for (size_t i = 0; i < kSlotCount; ++i)
+                {
+                    slots_[i] = kEmptySlot;
+                }
+
+                valid_ = true;
+                for (size_t i = 0; (i < Count) && valid_; ++i)
+                {
+                    const size_t slot = Hash(entries_[i].key, seed) & (kSlotCount - 1);
+                    if (slots_[slot] != kEmptySlot)
+                    {
+                        valid_ = false;
+                    }
+                    slots_[slot] = static_cast<uint8_t>(i);
+                }
+                seed_ = seed;
+            }
+        }
+
+        /// @brief Check if a perfect hash was found for the keys.
+        /// @return true if the table can be used, false if the keys are not unique.
+        constexpr bool IsValid() const
+        {
+            return valid_;
+        }
+
+        /// @brief Look up the value of a key.
+        /// @param [in] key The key.
+        /// @return The value of the key, or the missing value if the key is not in the table.
+        constexpr Value Find(std::string_view key) const
+        {
+            const uint8_t index = slots_[Hash(key, seed_) & (kSlotCount - 1)];
+            if ((index != kEmptySlot) && (entries_[index].key == key))
+            {
+                return entries_[index].value;
+            }
+
+            return missing_;
+        }
+
+    private:
+        /// @brief Get the smallest power of two that is not less than a value.
+        static constexpr size_t CeilPowerOfTwo(size_t value)
+        {
+            size_t result = 1;
+            while (result < value)
+            {
+                result *= 2;
+            }
+            return result;
+        }
+
+        /// @brief Hash a key with the 32 bit FNV-1a hash, starting from a seeded offset basis.
+        /// @param [in] key The key.
+        /// @param [in] seed The seed.
+        /// @return The hash of the key.
+        static constexpr uint32_t Hash(std::string_view key, uint32_t seed)
+        {
+            uint32_t hash = 2166136261u ^ (seed * 0x9e3779b9u);
+            for (char c : key)
+            {
+                hash ^= static_cast<uint8_t>(c);
+                hash *= 16777619u;
+            }
+            return hash ^ (hash >> 15);
+        }
+
+        static constexpr size_t   kSlotCount = CeilPowerOfTwo(Count * 8);  ///< The number of slots.
+        static constexpr uint8_t  kEmptySlot = 0xff;                       ///< The slot value of slots without an entry.
+        static constexpr uint32_t kMaxSeed   = 4096;                       ///< The number of seeds tried before giving up.
+
+        std::array<StaticKeyEntry<Value>, Count> entries_;  ///< The keys and their values.
+        std::array<uint8_t, kSlotCount>          slots_;    ///< The index of the entry in each slot, or kEmptySlot.
+        uint32_t                                 seed_;     ///< The seed of the perfect hash.
+        Value                                    missing_;  ///< The value returned for keys that are not in the table.
+        bool                                     valid_;    ///< True if the seed gives a perfect hash.
+    };
+
+    /// @brief Build a StaticKeyTable, deducing the number of keys.
+    /// @param [in] entries The keys and their values. The keys must be unique.
+    /// @param [in] missing The value returned for keys that are not in the table.
+    /// @return The table.
+    template <typename Value, size_t Count>
+    constexpr StaticKeyTable<Value, Count> MakeStaticKeyTable(const StaticKeyEntry<Value> (&entries)[Count], Value missing)
+    {
+        return StaticKeyTable<Value, Count>(entries, missing);
+    }
+}  // namespace system_info_utils
+
+#endif
@@ -0,0 +1,301 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief System info batch reader implementation
+//=============================================================================
+
+#include "system_info_batch_reader.h"
+
+#ifdef SYSTEM_INFO_ENABLE_RDF
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <thread>
+
+#include "definitions.h"
+
+#ifdef DRIVER_OVERRIDES_ENABLE_RDF
+#include "driver_overrides_definitions.h"
+#include "driver_overrides_reader.h"
+#endif
+
+namespace
+{
+    /// @brief Run a worker on the calling thread and on up to worker_count - 1 more threads.
+    /// @param [in] worker_count The number of threads to run the worker on. Zero uses one thread per hardware thread.
+    /// @param [in] job_count The number of jobs the workers share. No more threads than jobs are started.
+    /// @param [in] worker The worker, claiming jobs until none are left.
+    template <typename Worker>
+    void RunWorkers(uint32_t worker_count, size_t job_count, const Worker& worker)
+    {
+        if (worker_count == 0)
+        {
+            worker_count = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+
+        const size_t thread_count = std::min(static_cast<size_t>(worker_count), job_count);
+
+        // The calling thread is one of the workers.
+        std::vector<std::thread> threads;
+        for (size_t i = 1; i < thread_count; ++i)
+        {
+            SYSTEM_INFO_TRY
+            {
+                threads.emplace_back(worker);
+            }
+            SYSTEM_INFO_CATCH(...)
+            {
+                // Out of threads; the ones already started and the calling thread parse the rest.
+                break;
+            }
+        }
+
+        worker();
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    /// @brief The location of the data of one chunk in the shared chunk buffer.
+    struct ChunkJob
+    {
+        bool   is_system_info;  ///< True for a System Info chunk, false for a Driver Overrides chunk.
+        size_t entry;           ///< The index of the chunk's entry in the timeline.
+        size_t offset;          ///< The byte offset of the chunk data in the buffer.
+        size_t size;            ///< The size of the chunk data in bytes.
+    };
+
+    /// @brief Get the size of the data of a chunk.
+    /// @param [in] file The RDF file.
+    /// @param [in] identifier The chunk identifier.
+    /// @param [in] index The chunk index.
+    /// @param [out] out_size The size of the chunk data in bytes.
+    /// @return True if the size was queried, false otherwise.
+    bool GetChunkSize(rdfChunkFile* file, const char* identifier, int index, size_t& out_size)
+    {
+        int64_t chunk_size{};
+        if ((rdfChunkFileGetChunkDataSize(file, identifier, index, &chunk_size) != rdfResultOk) || (chunk_size < 0))
+        {
+            return false;
+        }
+
+        out_size = static_cast<size_t>(chunk_size);
+        return true;
+    }
+
+    /// @brief Get the number of chunks with an identifier.
+    /// @param [in] file The RDF file.
+    /// @param [in] identifier The chunk identifier.
+    /// @param [out] out_count The number of chunks, or 0 if it could not be queried.
+    /// @return True if the count was queried, false otherwise.
+    bool GetChunkCount(rdfChunkFile* file, const char* identifier, int& out_count)
+    {
+        int64_t count{};
+        out_count = 0;
+        if ((rdfChunkFileGetChunkCount(file, identifier, &count) != rdfResultOk) || (count < 0))
+        {
+            return false;
+        }
+
+        out_count = static_cast<int>(std::min<int64_t>(count, std::numeric_limits<int>::max()));
+        return true;
+    }
+}  // namespace
+
+namespace system_info_utils
+{
+    std::vector<BatchReadResult> SystemInfoBatchReader::Parse(const std::vector<rdfChunkFile*>& files, uint32_t worker_count)
+    {
+        std::vector<BatchReadResult> results(files.size());
+        std::atomic<size_t>          next_file{0};
+
+        // Each worker claims the next unparsed file until none are left, so results are
+        // written to their input position regardless of which thread parsed them.
+        auto worker = [&files, &results, &next_file]() {
+            SystemInfoParseContext context;
+            std::vector<char>      driver_overrides_buffer;
+
+            for (size_t index = next_file.fetch_add(1); index < files.size(); index = next_file.fetch_add(1))
+            {
+                rdfChunkFile*    file   = files[index];
+                BatchReadResult& result = results[index];
+
+                if (file == nullptr)
+                {
+                    continue;
+                }
+
+                result.system_info_parsed = context.Parse(file, result.system_info);
+#ifdef DRIVER_OVERRIDES_ENABLE_RDF
+                result.driver_overrides_parsed =
+                    driver_overrides_utils::DriverOverridesReader::Parse(file, result.driver_overrides_json, driver_overrides_buffer);
+#endif
+            }
+        };
+
+        RunWorkers(worker_count, files.size(), worker);
+
+        return results;
+    }
+
+    SystemInfoTimeline SystemInfoBatchReader::ParseAll(rdfChunkFile* file, uint32_t worker_count, uint32_t sections)
+    {
+        std::vector<char> buffer;
+        return ParseAll(file, worker_count, buffer, sections);
+    }
+
+    SystemInfoTimeline SystemInfoBatchReader::ParseAll(rdfChunkFile* file, uint32_t worker_count, std::vector<char>& buffer, uint32_t sections)
+    {
+        SystemInfoTimeline    timeline;
+        std::vector<ChunkJob> jobs;
+        size_t                total_size = 0;
+
+        if (file == nullptr)
+        {
+            return timeline;
+        }
+
+        // Query the version and size of every chunk first, so the data of all of them fits in one allocation.
+        int  system_info_count = 0;
+        bool read              = GetChunkCount(file, kSystemInfoChunkIdentifier, system_info_count);
+        timeline.system_info.resize(static_cast<size_t>(system_info_count));
+        for (int index = 0; index < system_info_count; ++index)
+        {
+            SystemInfoTimelineEntry& entry = timeline.system_info[static_cast<size_t>(index)];
+            entry.chunk_index              = index;
+            entry.result.error             = SystemInfoParseError::kChunkNotFound;
+
+            size_t size{};
+            if (rdfChunkFileGetChunkVersion(file, kSystemInfoChunkIdentifier, index, &entry.version) != rdfResultOk)
+            {
+                read = false;
+                continue;
+            }
+
+            if (entry.version > kSystemInfoChunkVersionMax)
+            {
+                entry.result.error = SystemInfoParseError::kUnsupportedVersion;
+            }
+            else if (GetChunkSize(file, kSystemInfoChunkIdentifier, index, size))
+            {
+                jobs.push_back({true, static_cast<size_t>(index), total_size, size});
+                total_size += size;
+            }
+            else
+            {
+                read = false;
+            }
+        }
+
+#ifdef DRIVER_OVERRIDES_ENABLE_RDF
+        using driver_overrides_utils::kDriverOverridesChunkIdentifier;
+
+        int driver_overrides_count = 0;
+        read                       = GetChunkCount(file, kDriverOverridesChunkIdentifier, driver_overrides_count) && read;
+        timeline.driver_overrides.resize(static_cast<size_t>(driver_overrides_count));
+        for (int index = 0; index < driver_overrides_count; ++index)
+        {
+            DriverOverridesTimelineEntry& entry = timeline.driver_overrides[static_cast<size_t>(index)];
+            entry.chunk_index                   = index;
+
+            size_t size{};
+            if (rdfChunkFileGetChunkVersion(file, kDriverOverridesChunkIdentifier, index, &entry.version) != rdfResultOk)
+            {
+                read = false;
+                continue;
+            }
+
+            if ((entry.version < driver_overrides_utils::kDriverOverridesChunkVersionMin) ||
+                (entry.version > driver_overrides_utils::kDriverOverridesChunkVersionMax))
+            {
+                continue;
+            }
+
+            if (GetChunkSize(file, kDriverOverridesChunkIdentifier, index, size))
+            {
+                jobs.push_back({false, static_cast<size_t>(index), total_size, size});
+                total_size += size;
+            }
+            else
+            {
+                read = false;
+            }
+        }
+#endif
+
+        bool allocated = false;
+        SYSTEM_INFO_TRY
+        {
+            buffer.resize(total_size);
+            allocated = true;
+        }
+        SYSTEM_INFO_CATCH(...)
+        {
+        }
+
+        // The file handle is not safe to read from several threads, so the data is read in order before parsing.
+        for (ChunkJob& job : jobs)
+        {
+            const char* identifier = kSystemInfoChunkIdentifier;
+#ifdef DRIVER_OVERRIDES_ENABLE_RDF
+            if (!job.is_system_info)
+            {
+                identifier = kDriverOverridesChunkIdentifier;
+            }
+#endif
+
+            if (!allocated || (rdfChunkFileReadChunkData(file, identifier, static_cast<int>(job.entry), buffer.data() + job.offset) != rdfResultOk))
+            {
+                if (job.is_system_info)
+                {
+                    timeline.system_info[job.entry].result.error = allocated ? SystemInfoParseError::kChunkNotFound : SystemInfoParseError::kOutOfMemory;
+                }
+
+                // Mark the job as done, leaving the entry failed.
+                job.entry = std::numeric_limits<size_t>::max();
+                read      = false;
+            }
+        }
+
+        timeline.read = read;
+
+        std::atomic<size_t> next_job{0};
+
+        auto worker = [&jobs, &timeline, &buffer, &next_job, sections]() {
+            SystemInfoParseContext context;
+
+            for (size_t index = next_job.fetch_add(1); index < jobs.size(); index = next_job.fetch_add(1))
+            {
+                const ChunkJob& job = jobs[index];
+                if (job.entry == std::numeric_limits<size_t>::max())
+                {
+                    continue;
+                }
+
+                const char* data = buffer.data() + job.offset;
+                if (job.is_system_info)
+                {
+                    SystemInfoTimelineEntry& entry = timeline.system_info[job.entry];
+                    entry.result                   = context.TryParse(data, job.size, entry.system_info, sections);
+                }
+#ifdef DRIVER_OVERRIDES_ENABLE_RDF
+                else
+                {
+                    DriverOverridesTimelineEntry& entry = timeline.driver_overrides[job.entry];
+                    entry.parsed = driver_overrides_utils::DriverOverridesReader::Parse(data, job.size, entry.version, entry.driver_overrides_json);
+                }
+#endif
+            }
+        };
+
+        RunWorkers(worker_count, jobs.size(), worker);
+
+        return timeline;
+    }
+}  // namespace system_info_utils
+
+#endif  // SYSTEM_INFO_ENABLE_RDF
@@ -0,0 +1,111 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief System info batch reader definition
+///
+/// The batch reader parses the System Info and Driver Overrides chunks of many
+/// RDF files, or every instance of them in a single RDF file, concurrently,
+/// using one parse context per worker thread.
+//=============================================================================
+
+#ifndef SYSTEM_INFO_UTILS_SOURCE_SYSTEM_INFO_BATCH_READER_H_
+#define SYSTEM_INFO_UTILS_SOURCE_SYSTEM_INFO_BATCH_READER_H_
+
+#ifdef SYSTEM_INFO_ENABLE_RDF
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <amdrdf.h>
+
+#include "system_info_reader.h"
+
+namespace system_info_utils
+{
+    /// @brief The chunks parsed from a single RDF file by the batch reader.
+    struct BatchReadResult
+    {
+        bool        system_info_parsed      = false;  ///< True if the System Info chunk was successfully parsed.
+        SystemInfo  system_info             = {};     ///< The parsed System Info chunk.
+        bool        driver_overrides_parsed = false;  ///< True if the Driver Overrides chunk was successfully parsed, or is not present.
+        std::string driver_overrides_json;            ///< The processed JSON string for the Driver Overrides tree.
+    };
+
+    /// @brief One instance of the System Info chunk in an RDF file.
+    struct SystemInfoTimelineEntry
+    {
+        int                   chunk_index = 0;   ///< The index of the chunk among the System Info chunks of the file.
+        uint32_t              version     = 0;   ///< The chunk version.
+        SystemInfoParseResult result      = {};  ///< The parse result. kUnsupportedVersion if the chunk version is not supported.
+        SystemInfo            system_info = {};  ///< The parsed System Info chunk.
+    };
+
+    /// @brief One instance of the Driver Overrides chunk in an RDF file.
+    struct DriverOverridesTimelineEntry
+    {
+        int         chunk_index = 0;        ///< The index of the chunk among the Driver Overrides chunks of the file.
+        uint32_t    version     = 0;        ///< The chunk version.
+        bool        parsed      = false;    ///< True if the chunk was successfully parsed.
+        std::string driver_overrides_json;  ///< The processed JSON string for the Driver Overrides tree.
+    };
+
+    /// @brief Every System Info and Driver Overrides chunk of an RDF file, in chunk index order.
+    ///
+    /// Components append a new chunk when the state changes during a capture, such as after a GPU
+    /// was added or the driver settings changed, so the chunk index order is the order of the states.
+    struct SystemInfoTimeline
+    {
+        bool                                      read = false;      ///< True if the chunk counts were queried and the data of every supported chunk was read from the file.
+        std::vector<SystemInfoTimelineEntry>      system_info;       ///< The System Info chunks.
+        std::vector<DriverOverridesTimelineEntry> driver_overrides;  ///< The Driver Overrides chunks. Empty without Driver Overrides RDF support.
+    };
+
+    /// @brief Parses the System Info and Driver Overrides chunks from a list of RDF files concurrently.
+    ///
+    /// Each worker thread owns its parse context and chunk buffer, so no parser state
+    /// is shared between threads. SystemInfoReader, SystemInfoParseContext and
+    /// DriverOverridesReader are safe to use from several threads at once, as long as
+    /// a context or RDF file handle is only used by one thread at a time.
+    class SystemInfoBatchReader
+    {
+    public:
+        /// @brief Default constructor
+        SystemInfoBatchReader() = delete;
+
+        /// @brief Default destructor
+        ~SystemInfoBatchReader() = delete;
+
+        /// @brief Parses the System Info and Driver Overrides chunks from each RDF file.
+        /// @param [in] files The RDF files. Each handle must not be used elsewhere until the call returns.
+        /// @param [in] worker_count The number of threads to parse with, including the calling thread.
+        /// Zero uses one thread per hardware thread.
+        /// @return The parse results, in the same order as the files.
+        static std::vector<BatchReadResult> Parse(const std::vector<rdfChunkFile*>& files, uint32_t worker_count);
+
+        /// @brief Parses every System Info and Driver Overrides chunk of an RDF file.
+        ///
+        /// The sizes of all chunks are queried first and the chunk data is read into one buffer,
+        /// after which the chunks are parsed concurrently.
+        /// @param [in] file The RDF file. The handle must not be used elsewhere until the call returns.
+        /// @param [in] worker_count The number of threads to parse with, including the calling thread.
+        /// Zero uses one thread per hardware thread.
+        /// @param [in] sections The SystemInfoSection flags selecting the System Info sections to parse.
+        /// @return The parsed chunks.
+        static SystemInfoTimeline ParseAll(rdfChunkFile* file, uint32_t worker_count, uint32_t sections = kSystemInfoSectionAll);
+
+        /// @brief Parses every System Info and Driver Overrides chunk of an RDF file.
+        /// @param [in] file The RDF file. The handle must not be used elsewhere until the call returns.
+        /// @param [in] worker_count The number of threads to parse with, including the calling thread.
+        /// Zero uses one thread per hardware thread.
+        /// @param [in, out] buffer The buffer the data of all chunks is read into. Its capacity is kept between files.
+        /// @param [in] sections The SystemInfoSection flags selecting the System Info sections to parse.
+        /// @return The parsed chunks.
+        static SystemInfoTimeline ParseAll(rdfChunkFile* file, uint32_t worker_count, std::vector<char>& buffer, uint32_t sections = kSystemInfoSectionAll);
+    };
+}  // namespace system_info_utils
+
+#endif  // SYSTEM_INFO_ENABLE_RDF
+
+#endif
@@ -0,0 +1,329 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief System info C interface implementation
+//=============================================================================
+
+#include "system_info_c.h"
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "definitions.h"
+#include "system_info_reader.h"
+
+static_assert(SYSINFO_RESULT_SYNTAX_ERROR == static_cast<int>(system_info_utils::SystemInfoParseError::kSyntax), "Result must match the parse error");
+static_assert(SYSINFO_RESULT_INVALID_TYPE == static_cast<int>(system_info_utils::SystemInfoParseError::kInvalidType), "Result must match the parse error");
+static_assert(SYSINFO_RESULT_UNSUPPORTED_VERSION == static_cast<int>(system_info_utils::SystemInfoParseError::kUnsupportedVersion),
+              "Result must match the parse error");
+static_assert(SYSINFO_RESULT_CHUNK_NOT_FOUND == static_cast<int>(system_info_utils::SystemInfoParseError::kChunkNotFound), "Result must match the parse error");
+static_assert(SYSINFO_RESULT_OUT_OF_MEMORY == static_cast<int>(system_info_utils::SystemInfoParseError::kOutOfMemory), "Result must match the parse error");
+
+#if UINTPTR_MAX == UINT64_MAX
+// The layout of the views is part of the ABI, so foreign runtimes can declare them without a C compiler.
+static_assert(sizeof(sysinfo_string) == 16, "The view layout must not change");
+static_assert(sizeof(sysinfo_driver) == 80, "The view layout must not change");
+static_assert(offsetof(sysinfo_asic, id_info) == 40, "The view layout must not change");
+static_assert(offsetof(sysinfo_asic, cu_masks) == 80, "The view layout must not change");
+static_assert(sizeof(sysinfo_asic) == 112, "The view layout must not change");
+static_assert(sizeof(sysinfo_heap) == 32, "The view layout must not change");
+static_assert(sizeof(sysinfo_memory) == 80, "The view layout must not change");
+static_assert(offsetof(sysinfo_gpu, asic) == 40, "The view layout must not change");
+static_assert(sizeof(sysinfo_gpu) == 232, "The view layout must not change");
+static_assert(sizeof(sysinfo_system) == 112, "The view layout must not change");
+#endif
+
+/// @brief The parse context, the parsed system info and the views onto it.
+struct sysinfo_handle
+{
+    system_info_utils::SystemInfoParseContext context;               ///< The parse context, reused between parses.
+    system_info_utils::SystemInfo             system_info;           ///< The parsed system info, owning all strings.
+    system_info_utils::SystemInfoParseResult  result;                ///< The result of the last parse.
+    sysinfo_system                            view;                  ///< The view of the system info.
+    std::vector<sysinfo_gpu>                  gpus;                  ///< The views of the GPUs.
+    std::vector<sysinfo_heap>                 heaps;                 ///< The views of the heaps of all GPUs.
+    std::vector<sysinfo_excluded_range>       excluded_va_ranges;    ///< The excluded ranges of all GPUs.
+    std::vector<uint32_t>                     cu_mask_engine_sizes;  ///< The CU mask shader engine sizes of all GPUs.
+};
+
+namespace
+{
+    /// @brief Make the view of a string.
+    /// @param [in] value The string.
+    /// @return The view, pointing into the string.
+    sysinfo_string MakeString(const std::string& value)
+    {
+        sysinfo_string result = {};
+        if (!value.empty())
+        {
+            result.data = value.data();
+            result.size = value.size();
+        }
+        return result;
+    }
+
+    /// @brief Make the view of a clock.
+    /// @param [in] clock The clock info.
+    /// @return The view.
+    sysinfo_clock MakeClock(const system_info_utils::ClockInfo& clock)
+    {
+        sysinfo_clock result = {};
+        result.min           = clock.min;
+        result.max           = clock.max;
+        return result;
+    }
+
+    /// @brief Make the view of an ASIC, except for the CU mask.
+    /// @param [in] asic The ASIC info.
+    /// @return The view.
+    sysinfo_asic MakeAsic(const system_info_utils::AsicInfo& asic)
+    {
+        sysinfo_asic result                 = {};
+        result.gpu_counter_freq             = asic.gpu_counter_freq;
+        result.engine_clock_hz              = MakeClock(asic.engine_clock_hz);
+        result.gpu_index                    = asic.gpu_index;
+        result.num_shader_engines           = asic.num_shader_engines;
+        result.num_shader_arrays_per_engine = asic.num_shader_arrays_per_engine;
+        result.num_cus                      = asic.num_cus;
+        result.id_info.gfx_engine           = asic.id_info.gfx_engine;
+        result.id_info.family               = asic.id_info.family;
+        result.id_info.e_rev                = asic.id_info.e_rev;
+        result.id_info.revision             = asic.id_info.revision;
+        result.id_info.device               = asic.id_info.device;
+        result.id_info.subsystem            = asic.id_info.subsystem;
+        result.id_info.vendor               = asic.id_info.vendor;
+        std::memcpy(result.id_info.luid, asic.id_info.luid, sizeof(result.id_info.luid));
+        return result;
+    }
+
+    /// @brief Build the views of the parsed system info.
+    /// @param [in, out] handle The handle.
+    void BuildViews(sysinfo_handle& handle)
+    {
+        const system_info_utils::SystemInfo& system_info = handle.system_info;
+
+        // Size the view arrays up front, so the pointers into them stay valid while they are filled.
+        size_t heap_count   = 0;
+        size_t range_count  = 0;
+        size_t engine_count = 0;
+        for (const system_info_utils::GpuInfo& gpu : system_info.gpus)
+        {
+            heap_count   += gpu.memory.heaps.size();
+            range_count  += gpu.memory.excluded_va_ranges.size();
+            engine_count += gpu.asic.cu_mask.size();
+        }
+
+        handle.gpus.reserve(system_info.gpus.size());
+        handle.heaps.reserve(heap_count);
+        handle.excluded_va_ranges.reserve(range_count);
+        handle.cu_mask_engine_sizes.reserve(engine_count);
+
+        for (const system_info_utils::GpuInfo& gpu : system_info.gpus)
+        {
+            sysinfo_gpu view  = {};
+            view.name         = MakeString(gpu.name);
+            view.pci.bus      = gpu.pci.bus;
+            view.pci.device   = gpu.pci.device;
+            view.pci.function = gpu.pci.function;
+            view.big_sw.major = gpu.big_sw.major;
+            view.big_sw.minor = gpu.big_sw.minor;
+            view.big_sw.misc  = gpu.big_sw.misc;
+            view.asic         = MakeAsic(gpu.asic);
+
+            const system_info_utils::CuMask& cu_mask = gpu.asic.cu_mask;
+            if (!cu_mask.empty())
+            {
+                view.asic.cu_masks             = cu_mask.Masks().data();
+                view.asic.cu_mask_count        = cu_mask.Masks().size();
+                view.asic.cu_mask_engine_sizes = handle.cu_mask_engine_sizes.data() + handle.cu_mask_engine_sizes.size();
+                view.asic.cu_mask_engine_count = cu_mask.size();
+                for (const auto& engine : cu_mask)
+                {
+                    handle.cu_mask_engine_sizes.push_back(static_cast<uint32_t>(engine.size()));
+                }
+            }
+
+            const system_info_utils::MemoryInfo& memory = gpu.memory;
+            view.memory.type                            = MakeString(memory.type);
+            view.memory.mem_ops_per_clock               = memory.mem_ops_per_clock;
+            view.memory.bus_bit_width                   = memory.bus_bit_width;
+            view.memory.bandwidth                       = memory.bandwidth;
+            view.memory.mem_clock_hz                    = MakeClock(memory.mem_clock_hz);
+
+            if (!memory.heaps.empty())
+            {
+                view.memory.heaps      = handle.heaps.data() + handle.heaps.size();
+                view.memory.heap_count = memory.heaps.size();
+                for (const system_info_utils::HeapInfo& heap : memory.heaps)
+                {
+                    handle.heaps.push_back(sysinfo_heap{MakeString(heap.heap_type), heap.phys_addr, heap.size});
+                }
+            }
+
+            if (!memory.excluded_va_ranges.empty())
+            {
+                view.memory.excluded_va_ranges      = handle.excluded_va_ranges.data() + handle.excluded_va_ranges.size();
+                view.memory.excluded_va_range_count = memory.excluded_va_ranges.size();
+                for (const system_info_utils::ExcludedRangeInfo& range : memory.excluded_va_ranges)
+                {
+                    handle.excluded_va_ranges.push_back(sysinfo_excluded_range{range.base, range.size});
+                }
+            }
+
+            handle.gpus.push_back(view);
+        }
+
+        sysinfo_system& view                = handle.view;
+        view.version.major                  = system_info.version.major;
+        view.version.minor                  = system_info.version.minor;
+        view.version.patch                  = system_info.version.patch;
+        view.version.build                  = system_info.version.build;
+        view.driver.name                    = MakeString(system_info.driver.name);
+        view.driver.description             = MakeString(system_info.driver.description);
+        view.driver.packaging_version       = MakeString(system_info.driver.packaging_version);
+        view.driver.software_version        = MakeString(system_info.driver.software_version);
+        view.driver.packaging_version_major = system_info.driver.packaging_version_major;
+        view.driver.packaging_version_minor = system_info.driver.packaging_version_minor;
+        view.driver.is_closed_source        = system_info.driver.is_closed_source ? 1 : 0;
+        view.gpus                           = handle.gpus.empty() ? nullptr : handle.gpus.data();
+        view.gpu_count                      = handle.gpus.size();
+    }
+
+    /// @brief Discard the system info and views of a handle before it is parsed into.
+    /// @param [in, out] handle The handle.
+    void ResetHandle(sysinfo_handle& handle)
+    {
+        handle.system_info = system_info_utils::SystemInfo();
+        handle.result      = system_info_utils::SystemInfoParseResult();
+        handle.view        = sysinfo_system();
+        handle.gpus.clear();
+        handle.heaps.clear();
+        handle.excluded_va_ranges.clear();
+        handle.cu_mask_engine_sizes.clear();
+    }
+
+    /// @brief Finish a parse, building the views if it succeeded.
+    /// @param [in, out] handle The handle.
+    /// @return The result of the parse.
+    sysinfo_result FinishParse(sysinfo_handle& handle)
+    {
+        if (handle.result.IsSucceeded())
+        {
+            SYSTEM_INFO_TRY
+            {
+                BuildViews(handle);
+            }
+            SYSTEM_INFO_CATCH(...)
+            {
+                handle.result.error = system_info_utils::SystemInfoParseError::kOutOfMemory;
+            }
+        }
+
+        if (!handle.result.IsSucceeded())
+        {
+            // Keep the error location, but expose an empty system info.
+            system_info_utils::SystemInfoParseResult result = std::move(handle.result);
+            ResetHandle(handle);
+            handle.result = std::move(result);
+        }
+
+        return static_cast<sysinfo_result>(handle.result.error);
+    }
+}  // namespace
+
+extern "C" {
+
+uint32_t sysinfo_abi_version(void)
+{
+    return SYSINFO_ABI_VERSION;
+}
+
+sysinfo_handle* sysinfo_create(void)
+{
+    sysinfo_handle* handle = nullptr;
+
+    SYSTEM_INFO_TRY
+    {
+        handle = new (std::nothrow) sysinfo_handle();
+    }
+    SYSTEM_INFO_CATCH(...)
+    {
+        handle = nullptr;
+    }
+
+    return handle;
+}
+
+void sysinfo_destroy(sysinfo_handle* handle)
+{
+    delete handle;
+}
+
+sysinfo_result sysinfo_parse(sysinfo_handle* handle, const char* json, uint64_t size)
+{
+    if ((handle == nullptr) || ((json == nullptr) && (size != 0)))
+    {
+        return SYSINFO_RESULT_INVALID_ARGUMENT;
+    }
+
+    ResetHandle(*handle);
+    handle->result = handle->context.TryParse(json, static_cast<size_t>(size), handle->system_info);
+
+    return FinishParse(*handle);
+}
+
+#ifdef SYSTEM_INFO_ENABLE_RDF
+sysinfo_result sysinfo_parse_rdf(sysinfo_handle* handle, rdfChunkFile* file)
+{
+    if ((handle == nullptr) || (file == nullptr))
+    {
+        return SYSINFO_RESULT_INVALID_ARGUMENT;
+    }
+
+    ResetHandle(*handle);
+    handle->result = handle->context.TryParse(file, handle->system_info);
+
+    return FinishParse(*handle);
+}
+#endif
+
+uint64_t sysinfo_error_offset(const sysinfo_handle* handle)
+{
+    return (handle != nullptr) ? handle->result.offset : 0;
+}
+
+sysinfo_string sysinfo_error_pointer(const sysinfo_handle* handle)
+{
+    return (handle != nullptr) ? MakeString(handle->result.pointer) : sysinfo_string();
+}
+
+const sysinfo_system* sysinfo_system_info(const sysinfo_handle* handle)
+{
+    return (handle != nullptr) ? &handle->view : nullptr;
+}
+
+const sysinfo_driver* sysinfo_driver_info(const sysinfo_handle* handle)
+{
+    return (handle != nullptr) ? &handle->view.driver : nullptr;
+}
+
+uint64_t sysinfo_gpu_count(const sysinfo_handle* handle)
+{
+    return (handle != nullptr) ? handle->view.gpu_count : 0;
+}
+
+const sysinfo_gpu* sysinfo_gpu_at(const sysinfo_handle* handle, uint64_t index)
+{
+    if ((handle == nullptr) || (index >= handle->view.gpu_count))
+    {
+        return nullptr;
+    }
+
+    return &handle->view.gpus[index];
+}
+
+}  // extern "C"
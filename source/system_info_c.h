@@ -0,0 +1,240 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief System info C interface definition
+///
+/// A C interface to the system info reader for foreign function interfaces,
+/// exposing the parsed structures as flat, fixed-layout views.
+//=============================================================================
+
+#ifndef SYSTEM_INFO_UTILS_SOURCE_SYSTEM_INFO_C_H_
+#define SYSTEM_INFO_UTILS_SOURCE_SYSTEM_INFO_C_H_
+
+#include <stdint.h>
+
+#ifdef SYSTEM_INFO_ENABLE_RDF
+#include <amdrdf.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// @brief The version of the layout of the view structures, incremented whenever it changes.
+#define SYSINFO_ABI_VERSION 1
+
+/// @brief The result of a parse. The errors match system_info_utils::SystemInfoParseError.
+typedef enum sysinfo_result
+{
+    SYSINFO_RESULT_OK                  = 0,  ///< The system info was parsed.
+    SYSINFO_RESULT_SYNTAX_ERROR        = 1,  ///< The text is not valid JSON.
+    SYSINFO_RESULT_INVALID_TYPE        = 2,  ///< A member has a type or value that its field cannot hold.
+    SYSINFO_RESULT_UNSUPPORTED_VERSION = 3,  ///< The chunk version is not supported.
+    SYSINFO_RESULT_CHUNK_NOT_FOUND     = 4,  ///< The RDF file does not contain a System Info chunk of a supported version.
+    SYSINFO_RESULT_OUT_OF_MEMORY       = 5,  ///< The parsed structure could not be allocated.
+    SYSINFO_RESULT_INVALID_ARGUMENT    = 6   ///< A required argument is null.
+} sysinfo_result;
+
+/// @brief A string owned by the handle. Not null terminated.
+typedef struct sysinfo_string
+{
+    const char* data;  ///< The first character, or null if the string is empty.
+    uint64_t    size;  ///< The size of the string in bytes.
+} sysinfo_string;
+
+/// @brief Mirror of system_info_utils::Version.
+typedef struct sysinfo_version
+{
+    uint32_t major;  ///< major version
+    uint32_t minor;  ///< minor version
+    uint32_t patch;  ///< patch version
+    uint32_t build;  ///< build number
+} sysinfo_version;
+
+/// @brief Mirror of system_info_utils::DriverInfo.
+typedef struct sysinfo_driver
+{
+    sysinfo_string name;                     ///< The driver name
+    sysinfo_string description;              ///< The driver description
+    sysinfo_string packaging_version;        ///< The driver packaging version string.
+    sysinfo_string software_version;         ///< The driver software version string. (Windows platform specific)
+    uint32_t       packaging_version_major;  ///< The driver packaging major version
+    uint32_t       packaging_version_minor;  ///< The driver packaging minor version
+    uint32_t       is_closed_source;         ///< 1 if driver is PRO (closed source), 0 otherwise
+    uint32_t       reserved;                 ///< Padding, always 0.
+} sysinfo_driver;
+
+/// @brief Mirror of system_info_utils::ClockInfo.
+typedef struct sysinfo_clock
+{
+    uint64_t min;  ///< The minimum clock value in Hz.
+    uint64_t max;  ///< The maximum clock value in Hz.
+} sysinfo_clock;
+
+/// @brief Mirror of system_info_utils::IdInfo.
+typedef struct sysinfo_ids
+{
+    uint32_t gfx_engine;  ///< The graphics engine id.
+    uint32_t family;      ///< The hardware family ID.
+    uint32_t e_rev;       ///< The hardware revision id.
+    uint32_t revision;    ///< The PCI revision ID.
+    uint32_t device;      ///< The PCI device ID.
+    uint32_t subsystem;   ///< The PCI ID or ACPI ID of the adapter's hardware subsystem.
+    uint32_t vendor;      ///< The PCI ID or ACPI ID of the adapter's hardware vendor.
+    uint8_t  luid[8];     ///< The locally unique identifier for the adapter.
+} sysinfo_ids;
+
+/// @brief Mirror of system_info_utils::AsicInfo.
+///
+/// The CU mask is a single array of shader array masks, ordered by shader engine and then by
+/// shader array, with the number of shader arrays of each shader engine in a second array.
+typedef struct sysinfo_asic
+{
+    uint64_t        gpu_counter_freq;              ///< The GPU counter frequency in ticks.
+    sysinfo_clock   engine_clock_hz;               ///< The GPU engine clock info in Hz.
+    uint32_t        gpu_index;                     ///< The index of the GPU as enumerated by the system.
+    uint32_t        num_shader_engines;            ///< The number of shader engines on the GPU.
+    uint32_t        num_shader_arrays_per_engine;  ///< The number of shader arrays per shader engine on the GPU.
+    uint32_t        num_cus;                       ///< The number of compute units on the GPU.
+    sysinfo_ids     id_info;                       ///< The hardware info, used to uniquely identify a GPU in the system.
+    uint32_t        reserved;                      ///< Padding, always 0.
+    const uint32_t* cu_masks;                      ///< The shader array masks of all shader engines.
+    uint64_t        cu_mask_count;                 ///< The number of shader array masks.
+    const uint32_t* cu_mask_engine_sizes;          ///< The number of shader arrays of each shader engine.
+    uint64_t        cu_mask_engine_count;          ///< The number of shader engines in the CU mask.
+} sysinfo_asic;
+
+/// @brief Mirror of system_info_utils::HeapInfo.
+typedef struct sysinfo_heap
+{
+    sysinfo_string heap_type;  ///< A string indicating the heap type (typically Local or Invisible).
+    uint64_t       phys_addr;  ///< The physical heap location as a byte offset.
+    uint64_t       size;       ///< The physical heap size in bytes.
+} sysinfo_heap;
+
+/// @brief Mirror of system_info_utils::ExcludedRangeInfo.
+typedef struct sysinfo_excluded_range
+{
+    uint64_t base;  ///< The base address identifying the beginning of an excluded memory region.
+    uint64_t size;  ///< The total size in bytes of the excluded memory region.
+} sysinfo_excluded_range;
+
+/// @brief Mirror of system_info_utils::MemoryInfo.
+typedef struct sysinfo_memory
+{
+    sysinfo_string                type;                     ///< A string indicating the type of GPU memory.
+    uint32_t                      mem_ops_per_clock;        ///< The total count of memory operations per clock.
+    uint32_t                      bus_bit_width;            ///< The total width of the memory bus in bits.
+    uint64_t                      bandwidth;                ///< The total computed bandwidth of the memory bus in bytes/second.
+    sysinfo_clock                 mem_clock_hz;             ///< The device memory clock range info in Hz.
+    const sysinfo_heap*           heaps;                    ///< The available memory heaps.
+    uint64_t                      heap_count;               ///< The number of memory heaps.
+    const sysinfo_excluded_range* excluded_va_ranges;       ///< The excluded virtual address ranges.
+    uint64_t                      excluded_va_range_count;  ///< The number of excluded virtual address ranges.
+} sysinfo_memory;
+
+/// @brief Mirror of system_info_utils::PciInfo.
+typedef struct sysinfo_pci
+{
+    uint32_t bus;       ///< The device bus number.
+    uint32_t device;    ///< The device number.
+    uint32_t function;  ///< The device function number.
+} sysinfo_pci;
+
+/// @brief Mirror of system_info_utils::SoftwareVersion.
+typedef struct sysinfo_software_version
+{
+    uint32_t major;  ///< The major version number.
+    uint32_t minor;  ///< The minor version number.
+    uint32_t misc;   ///< The subminor/misc/patch version number.
+} sysinfo_software_version;
+
+/// @brief Mirror of system_info_utils::GpuInfo.
+typedef struct sysinfo_gpu
+{
+    sysinfo_string           name;    ///< The GPU identification name string.
+    sysinfo_pci              pci;     ///< The GPU PCI connection info.
+    sysinfo_software_version big_sw;  ///< The 'Big Software' release version number info.
+    sysinfo_asic             asic;    ///< The hardware's ASIC info.
+    sysinfo_memory           memory;  ///< The hardware's memory info.
+} sysinfo_gpu;
+
+/// @brief Mirror of the version, driver and GPU list of system_info_utils::SystemInfo.
+typedef struct sysinfo_system
+{
+    sysinfo_version    version;    ///< A version number to identify the System Info structure revision number.
+    sysinfo_driver     driver;     ///< A field containing GPU device driver info.
+    const sysinfo_gpu* gpus;       ///< All GPU devices identified in the system.
+    uint64_t           gpu_count;  ///< The number of GPUs.
+} sysinfo_system;
+
+/// @brief A parse context holding the last parsed system info and its views.
+///
+/// All views and strings returned for a handle stay valid until it is parsed into again or
+/// destroyed. A handle must not be shared between threads, but each thread may use its own.
+typedef struct sysinfo_handle sysinfo_handle;
+
+/// @brief Get the layout version of the view structures.
+/// @return SYSINFO_ABI_VERSION of the library.
+uint32_t sysinfo_abi_version(void);
+
+/// @brief Create a handle with an empty system info.
+/// @return The handle, or null if it could not be allocated.
+sysinfo_handle* sysinfo_create(void);
+
+/// @brief Destroy a handle.
+/// @param [in] handle The handle. May be null.
+void sysinfo_destroy(sysinfo_handle* handle);
+
+/// @brief Parse system info JSON text, replacing the system info of the handle.
+/// @param [in] handle The handle.
+/// @param [in] json The system info JSON text. Does not need to be null terminated.
+/// @param [in] size The size of the JSON text in bytes.
+/// @return SYSINFO_RESULT_OK on success. On failure the system info is empty.
+sysinfo_result sysinfo_parse(sysinfo_handle* handle, const char* json, uint64_t size);
+
+#ifdef SYSTEM_INFO_ENABLE_RDF
+/// @brief Parse the system info chunk of an RDF file, replacing the system info of the handle.
+/// @param [in] handle The handle.
+/// @param [in] file The RDF file.
+/// @return SYSINFO_RESULT_OK on success. On failure the system info is empty.
+sysinfo_result sysinfo_parse_rdf(sysinfo_handle* handle, rdfChunkFile* file);
+#endif
+
+/// @brief Get the byte offset of the error of the last failed parse.
+/// @param [in] handle The handle.
+/// @return The byte offset just past the JSON token at which the error was detected, or 0.
+uint64_t sysinfo_error_offset(const sysinfo_handle* handle);
+
+/// @brief Get the JSON pointer of the error of the last failed parse.
+/// @param [in] handle The handle.
+/// @return The JSON pointer of the innermost member being parsed at the error, or an empty string.
+sysinfo_string sysinfo_error_pointer(const sysinfo_handle* handle);
+
+/// @brief Get the view of the parsed system info.
+/// @param [in] handle The handle.
+/// @return The view, or null if the handle is null.
+const sysinfo_system* sysinfo_system_info(const sysinfo_handle* handle);
+
+/// @brief Get the driver info.
+/// @param [in] handle The handle.
+/// @return The driver info, or null if the handle is null.
+const sysinfo_driver* sysinfo_driver_info(const sysinfo_handle* handle);
+
+/// @brief Get the number of GPUs.
+/// @param [in] handle The handle.
+/// @return The number of GPUs, or 0 if the handle is null.
+uint64_t sysinfo_gpu_count(const sysinfo_handle* handle);
+
+/// @brief Get a GPU.
+/// @param [in] handle The handle.
+/// @param [in] index The index of the GPU.
+/// @return The GPU, or null if the handle is null or the index is out of range.
+const sysinfo_gpu* sysinfo_gpu_at(const sysinfo_handle* handle, uint64_t index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,446 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief System info binary cache implementation
+//=============================================================================
+
+#include "system_info_cache.h"
+
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "definitions.h"
+
+namespace system_info_utils
+{
+    // The records are read in place, so their layout is part of the cache format.
+    static_assert(std::is_trivially_copyable<CachedSystemInfo>::value, "Cache records must be trivially copyable");
+    static_assert(sizeof(CachedSystemInfo) == 160, "CachedSystemInfo layout changed; update kSystemInfoCacheVersion");
+    static_assert(sizeof(CachedCpuInfo) == 72, "CachedCpuInfo layout changed; update kSystemInfoCacheVersion");
+    static_assert(sizeof(CachedGpuInfo) == 176, "CachedGpuInfo layout changed; update kSystemInfoCacheVersion");
+    static_assert(sizeof(CachedHeapInfo) == 24, "CachedHeapInfo layout changed; update kSystemInfoCacheVersion");
+    static_assert(sizeof(CachedProcess) == 24, "CachedProcess layout changed; update kSystemInfoCacheVersion");
+    static_assert(sizeof(ExcludedRangeInfo) == 16, "ExcludedRangeInfo layout changed; update kSystemInfoCacheVersion");
+    static_assert(sizeof(CacheHeader) == 24 + 16 * static_cast<uint32_t>(CacheSection::kCount), "CacheHeader layout changed");
+
+    /// @brief Get the size of a single record in a section.
+    /// @param [in] section The section.
+    /// @return The record size in bytes.
+    static size_t GetRecordSize(CacheSection section)
+    {
+        switch (section)
+        {
+        case CacheSection::kSystem:
+            return sizeof(CachedSystemInfo);
+        case CacheSection::kCpus:
+            return sizeof(CachedCpuInfo);
+        case CacheSection::kGpus:
+            return sizeof(CachedGpuInfo);
+        case CacheSection::kHeaps:
+            return sizeof(CachedHeapInfo);
+        case CacheSection::kExcludedVaRanges:
+            return sizeof(ExcludedRangeInfo);
+        case CacheSection::kCuMaskRows:
+            return sizeof(CachedRange);
+        case CacheSection::kCuMaskValues:
+            return sizeof(uint32_t);
+        case CacheSection::kProcesses:
+            return sizeof(CachedProcess);
+        default:
+            return sizeof(char);
+        }
+    }
+
+    /// @brief Convert a cached boolean to a bool.
+    /// @param [in] value The cached value.
+    /// @return true if the value is non-zero.
+    static bool ToBool(uint32_t value)
+    {
+        return value != 0;
+    }
+
+    SystemInfoCache::~SystemInfoCache()
+    {
+        Close();
+    }
+
+    bool SystemInfoCache::Open(const std::string& path)
+    {
+        Close();
+
+#ifdef _WIN32
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER file_size{};
+        if (!GetFileSizeEx(file, &file_size) || (file_size.QuadPart < static_cast<LONGLONG>(sizeof(CacheHeader))))
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping == nullptr)
+        {
+            return false;
+        }
+
+        // The view keeps the mapping alive once it has been created.
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (view == nullptr)
+        {
+            return false;
+        }
+
+        data_ = static_cast<const uint8_t*>(view);
+        size_ = static_cast<size_t>(file_size.QuadPart);
+#else
+        int file = open(path.c_str(), O_RDONLY);
+        if (file < 0)
+        {
+            return false;
+        }
+
+        struct stat file_stat = {};
+        if ((fstat(file, &file_stat) != 0) || (file_stat.st_size < static_cast<off_t>(sizeof(CacheHeader))))
+        {
+            close(file);
+            return false;
+        }
+
+        // The mapping stays valid after the file is closed.
+        void* view = mmap(nullptr, static_cast<size_t>(file_stat.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+        close(file);
+        if (view == MAP_FAILED)
+        {
+            return false;
+        }
+
+        data_ = static_cast<const uint8_t*>(view);
+        size_ = static_cast<size_t>(file_stat.st_size);
+#endif
+        mapped_ = true;
+
+        if (!Validate())
+        {
+            Close();
+            return false;
+        }
+
+        return true;
+    }
+
+    bool SystemInfoCache::Load(const void* data, size_t size)
+    {
+        Close();
+
+        if ((data == nullptr) || (reinterpret_cast<uintptr_t>(data) % alignof(uint64_t) != 0))
+        {
+            return false;
+        }
+
+        data_ = static_cast<const uint8_t*>(data);
+        size_ = size;
+
+        if (!Validate())
+        {
+            Close();
+            return false;
+        }
+
+        return true;
+    }
+
+    void SystemInfoCache::Close()
+    {
+        if (mapped_)
+        {
+#ifdef _WIN32
+            UnmapViewOfFile(data_);
+#else
+            munmap(const_cast<uint8_t*>(data_), size_);
+#endif
+        }
+
+        data_   = nullptr;
+        size_   = 0;
+        mapped_ = false;
+    }
+
+    bool SystemInfoCache::IsOpen() const
+    {
+        return data_ != nullptr;
+    }
+
+    uint64_t SystemInfoCache::GetKey() const
+    {
+        uint64_t result = 0;
+
+        if (IsOpen())
+        {
+            result = reinterpret_cast<const CacheHeader*>(data_)->key;
+        }
+
+        return result;
+    }
+
+    const CachedSystemInfo& SystemInfoCache::GetSystem() const
+    {
+        const CacheHeader* header = reinterpret_cast<const CacheHeader*>(data_);
+        return *reinterpret_cast<const CachedSystemInfo*>(data_ + header->sections[static_cast<uint32_t>(CacheSection::kSystem)].offset);
+    }
+
+    CacheView<CachedCpuInfo> SystemInfoCache::GetCpus() const
+    {
+        return GetRange<CachedCpuInfo>(CacheSection::kCpus, 0, UINT64_MAX);
+    }
+
+    CacheView<CachedGpuInfo> SystemInfoCache::GetGpus() const
+    {
+        return GetRange<CachedGpuInfo>(CacheSection::kGpus, 0, UINT64_MAX);
+    }
+
+    CacheView<CachedProcess> SystemInfoCache::GetProcesses() const
+    {
+        return GetRange<CachedProcess>(CacheSection::kProcesses, 0, UINT64_MAX);
+    }
+
+    CacheView<CachedHeapInfo> SystemInfoCache::GetHeaps(const CachedGpuInfo& gpu) const
+    {
+        return GetRange<CachedHeapInfo>(CacheSection::kHeaps, gpu.heaps.first, gpu.heaps.count);
+    }
+
+    CacheView<ExcludedRangeInfo> SystemInfoCache::GetExcludedVaRanges(const CachedGpuInfo& gpu) const
+    {
+        return GetRange<ExcludedRangeInfo>(CacheSection::kExcludedVaRanges, gpu.excluded_va_ranges.first, gpu.excluded_va_ranges.count);
+    }
+
+    CacheView<CachedRange> SystemInfoCache::GetCuMask(const CachedGpuInfo& gpu) const
+    {
+        return GetRange<CachedRange>(CacheSection::kCuMaskRows, gpu.cu_mask.first, gpu.cu_mask.count);
+    }
+
+    CacheView<uint32_t> SystemInfoCache::GetCuMaskValues(const CachedRange& row) const
+    {
+        return GetRange<uint32_t>(CacheSection::kCuMaskValues, row.first, row.count);
+    }
+
+    std::string_view SystemInfoCache::GetString(const CachedString& string) const
+    {
+        CacheView<char> view = GetRange<char>(CacheSection::kStrings, string.offset, string.size);
+        return std::string_view(view.begin(), view.size());
+    }
+
+    bool SystemInfoCache::ToSystemInfo(SystemInfo& system_info) const
+    {
+        if (!IsOpen())
+        {
+            return false;
+        }
+
+        const CachedSystemInfo& system = GetSystem();
+
+        system_info         = SystemInfo();
+        system_info.version = system.version;
+
+        DriverInfo& driver             = system_info.driver;
+        driver.packaging_version_major = system.driver.packaging_version_major;
+        driver.packaging_version_minor = system.driver.packaging_version_minor;
+        driver.name                    = GetString(system.driver.name);
+        driver.description             = GetString(system.driver.description);
+        driver.packaging_version       = GetString(system.driver.packaging_version);
+        driver.software_version        = GetString(system.driver.software_version);
+        driver.is_closed_source        = ToBool(system.driver.is_closed_source);
+
+        system_info.devdriver.major_version = system.devdriver.major_version;
+        system_info.devdriver.tag           = GetString(system.devdriver.tag);
+
+        OsInfo& os         = system_info.os;
+        os.name            = GetString(system.os.name);
+        os.desc            = GetString(system.os.desc);
+        os.hostname        = GetString(system.os.hostname);
+        os.memory.physical = system.os.memory_physical;
+        os.memory.swap     = system.os.memory_swap;
+        os.memory.type     = GetString(system.os.memory_type);
+
+        os.config.power_dpm_writable                               = ToBool(system.os.power_dpm_writable);
+        os.config.drm_major_version                                = system.os.drm_major_version;
+        os.config.drm_minor_version                                = system.os.drm_minor_version;
+        os.config.etw_support_info.is_supported                    = ToBool(system.os.etw_is_supported);
+        os.config.etw_support_info.has_permission                  = ToBool(system.os.etw_has_permission);
+        os.config.etw_support_info.status_code                     = system.os.etw_status_code;
+        os.config.etw_support_info.needs_rgp_registry_or_usergroup = ToBool(system.os.etw_needs_rgp_registry_or_usergroup);
+
+        CacheView<CachedCpuInfo> cpus = GetCpus();
+        system_info.cpus.reserve(cpus.size());
+        for (const CachedCpuInfo& cached_cpu : cpus)
+        {
+            CpuInfo cpu                   = {};
+            cpu.name                      = GetString(cached_cpu.name);
+            cpu.cpu_id                    = GetString(cached_cpu.cpu_id);
+            cpu.device_id                 = GetString(cached_cpu.device_id);
+            cpu.architecture              = GetString(cached_cpu.architecture);
+            cpu.vendor_id                 = GetString(cached_cpu.vendor_id);
+            cpu.virtualization            = GetString(cached_cpu.virtualization);
+            cpu.num_physical_cores        = cached_cpu.num_physical_cores;
+            cpu.num_logical_cores         = cached_cpu.num_logical_cores;
+            cpu.max_clock_speed           = cached_cpu.max_clock_speed;
+            cpu.timestamp_clock_frequency = cached_cpu.timestamp_clock_frequency;
+            system_info.cpus.push_back(std::move(cpu));
+        }
+
+        CacheView<CachedGpuInfo> gpus = GetGpus();
+        system_info.gpus.reserve(gpus.size());
+        for (const CachedGpuInfo& cached_gpu : gpus)
+        {
+            GpuInfo gpu = {};
+            gpu.name    = GetString(cached_gpu.name);
+            gpu.pci     = cached_gpu.pci;
+            gpu.big_sw  = cached_gpu.big_sw;
+
+            AsicInfo& asic                    = gpu.asic;
+            asic.gpu_index                    = cached_gpu.gpu_index;
+            asic.gpu_counter_freq             = cached_gpu.gpu_counter_freq;
+            asic.engine_clock_hz              = cached_gpu.engine_clock_hz;
+            asic.num_shader_engines           = cached_gpu.num_shader_engines;
+            asic.num_shader_arrays_per_engine = cached_gpu.num_shader_arrays_per_engine;
+            asic.num_cus                      = cached_gpu.num_cus;
+            asic.id_info                      = cached_gpu.id_info;
+
+            for (const CachedRange& row : GetCuMask(cached_gpu))
+            {
+                asic.cu_mask.AddShaderEngine();
+                for (uint32_t mask : GetCuMaskValues(row))
+                {
+                    asic.cu_mask.AddShaderArray(mask);
+                }
+            }
+
+            MemoryInfo& memory       = gpu.memory;
+            memory.type              = GetString(cached_gpu.memory_type);
+            memory.mem_ops_per_clock = cached_gpu.mem_ops_per_clock;
+            memory.bus_bit_width     = cached_gpu.bus_bit_width;
+            memory.bandwidth         = cached_gpu.bandwidth;
+            memory.mem_clock_hz      = cached_gpu.mem_clock_hz;
+
+            for (const CachedHeapInfo& cached_heap : GetHeaps(cached_gpu))
+            {
+                HeapInfo heap  = {};
+                heap.heap_type = GetString(cached_heap.heap_type);
+                heap.phys_addr = cached_heap.phys_addr;
+                heap.size      = cached_heap.size;
+                memory.heaps.push_back(std::move(heap));
+            }
+
+            CacheView<ExcludedRangeInfo> excluded_va_ranges = GetExcludedVaRanges(cached_gpu);
+            memory.excluded_va_ranges.assign(excluded_va_ranges.begin(), excluded_va_ranges.end());
+
+            system_info.gpus.push_back(std::move(gpu));
+        }
+
+        CacheView<CachedProcess> processes = GetProcesses();
+        system_info.processes.reserve(processes.size());
+        for (const CachedProcess& cached_process : processes)
+        {
+            Process process = {};
+            process.name    = GetString(cached_process.name);
+            process.path    = GetString(cached_process.path);
+            process.id      = cached_process.id;
+            system_info.processes.push_back(std::move(process));
+        }
+
+        return true;
+    }
+
+    uint64_t SystemInfoCache::ComputeKey(const void* data, size_t size)
+    {
+        static constexpr uint64_t kFnvOffsetBasis = 14695981039346656037ULL;
+        static constexpr uint64_t kFnvPrime       = 1099511628211ULL;
+
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        uint64_t       hash  = kFnvOffsetBasis;
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            hash ^= bytes[i];
+            hash *= kFnvPrime;
+        }
+
+        return hash;
+    }
+
+    template <typename T>
+    CacheView<T> SystemInfoCache::GetRange(CacheSection section, uint64_t first, uint64_t count) const
+    {
+        if (!IsOpen())
+        {
+            return CacheView<T>();
+        }
+
+        const CacheSectionInfo& info = reinterpret_cast<const CacheHeader*>(data_)->sections[static_cast<uint32_t>(section)];
+
+        // A count of UINT64_MAX selects the whole section.
+        if (count == UINT64_MAX)
+        {
+            count = info.count - first;
+        }
+
+        if ((first > info.count) || (count > info.count - first))
+        {
+            return CacheView<T>();
+        }
+
+        return CacheView<T>(reinterpret_cast<const T*>(data_ + info.offset) + first, static_cast<size_t>(count));
+    }
+
+    bool SystemInfoCache::Validate() const
+    {
+        if (size_ < sizeof(CacheHeader))
+        {
+            return false;
+        }
+
+        const CacheHeader* header = reinterpret_cast<const CacheHeader*>(data_);
+        if ((header->magic != kSystemInfoCacheMagic) || (header->version != kSystemInfoCacheVersion) || (header->size != size_))
+        {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < static_cast<uint32_t>(CacheSection::kCount); ++i)
+        {
+            const CacheSectionInfo& info        = header->sections[i];
+            const size_t            record_size = GetRecordSize(static_cast<CacheSection>(i));
+
+            if ((info.offset % alignof(uint64_t) != 0) || (info.offset > size_) || (info.count > (size_ - info.offset) / record_size))
+            {
+                return false;
+            }
+        }
+
+        if (header->sections[static_cast<uint32_t>(CacheSection::kSystem)].count != 1)
+        {
+            return false;
+        }
+
+        return true;
+    }
+}  // namespace system_info_utils
@@ -0,0 +1,338 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief System info binary cache definition
+///
+/// The binary cache stores a parsed SystemInfo structure so it can be loaded
+/// again without parsing JSON. A cache file starts with a fixed size header
+/// followed by flat arrays of fixed size records and a string table. Records
+/// refer to strings and to ranges of other arrays by index, so the file can be
+/// memory mapped and read in place. The file uses the byte order of the machine
+/// that wrote it.
+//=============================================================================
+
+#ifndef SYSTEM_INFO_UTILS_SOURCE_SYSTEM_INFO_CACHE_H_
+#define SYSTEM_INFO_UTILS_SOURCE_SYSTEM_INFO_CACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "system_info_reader.h"
+
+namespace system_info_utils
+{
+    /// @brief A string stored in the cache string table.
+    struct CachedString
+    {
+        uint32_t offset;  ///< The byte offset of the string in the string table.
+        uint32_t size;    ///< The length of the string in bytes, excluding the null terminator.
+    };
+
+    /// @brief A range of records in one of the cache arrays.
+    struct CachedRange
+    {
+        uint32_t first;  ///< The index of the first record.
+        uint32_t count;  ///< The number of records.
+    };
+
+    /// @brief The cached driver software info.
+    struct CachedDriverInfo
+    {
+        uint32_t     packaging_version_major;  ///< The driver packaging major version
+        uint32_t     packaging_version_minor;  ///< The driver packaging minor version
+        CachedString name;                     ///< The driver name
+        CachedString description;              ///< The driver description
+        CachedString packaging_version;        ///< The driver packaging version string.
+        CachedString software_version;         ///< The driver software version string. (Windows platform specific)
+        uint32_t     is_closed_source;         ///< Non-zero if driver is PRO (closed source)
+        uint32_t     reserved;                 ///< Padding, always zero.
+    };
+
+    /// @brief The cached DevDriver version info.
+    struct CachedDevDriverInfo
+    {
+        uint32_t     major_version;  ///< The interface major version.
+        CachedString tag;            ///< The release tag name string.
+    };
+
+    /// @brief The cached operating system info, including the system memory and configuration info.
+    struct CachedOsInfo
+    {
+        CachedString name;                                 ///< The OS name string.
+        CachedString desc;                                 ///< The OS description string.
+        CachedString hostname;                             ///< The system hostname string.
+        CachedString memory_type;                          ///< The memory type name
+        uint64_t     memory_physical;                      ///< The total physical memory size in bytes.
+        uint64_t     memory_swap;                          ///< The total swap memory size in bytes.
+        uint32_t     power_dpm_writable;                   ///< Non-zero if power management file is writable on Linux.
+        uint32_t     drm_major_version;                    ///< libdrm major version.
+        uint32_t     drm_minor_version;                    ///< libdrm minor version.
+        uint32_t     etw_is_supported;                     ///< Non-zero if ETW is supported.
+        uint32_t     etw_has_permission;                   ///< Non-zero if the account has permission to open an ETW session.
+        uint32_t     etw_status_code;                      ///< The ETW status code received when attempting to open a session.
+        uint32_t     etw_needs_rgp_registry_or_usergroup;  ///< Non-zero if registry or usergroup settings for RGP ETW capture need setting.
+        uint32_t     reserved;                             ///< Padding, always zero.
+    };
+
+    /// @brief The cached top level system info fields.
+    struct CachedSystemInfo
+    {
+        Version             version;    ///< A version number to identify the System Info structure revision number.
+        CachedDriverInfo    driver;     ///< The GPU device driver info.
+        CachedDevDriverInfo devdriver;  ///< The Developer Driver info.
+        uint32_t            reserved;   ///< Padding, always zero.
+        CachedOsInfo        os;         ///< The system's OS info.
+    };
+
+    /// @brief The cached CPU info.
+    struct CachedCpuInfo
+    {
+        CachedString name;                       ///< The CPU name
+        CachedString cpu_id;                     ///< The CPU identifier
+        CachedString device_id;                  ///< The CPU slot identifier
+        CachedString architecture;               ///< The CPU architecture
+        CachedString vendor_id;                  ///< The CPU vendor
+        CachedString virtualization;             ///< The CPU has virtualization firmware enabled state
+        uint32_t     num_physical_cores;         ///< The CPU physical core count
+        uint32_t     num_logical_cores;          ///< The CPU logical core count
+        uint32_t     max_clock_speed;            ///< The maximum CPU clock speed in MHz
+        uint32_t     reserved;                   ///< Padding, always zero.
+        uint64_t     timestamp_clock_frequency;  ///< The CPU timestamp clock frequency in Hz
+    };
+
+    /// @brief The cached GPU info, including the ASIC and memory info.
+    struct CachedGpuInfo
+    {
+        CachedString    name;                          ///< The GPU identification name string.
+        PciInfo         pci;                           ///< The GPU PCI connection info.
+        uint32_t        gpu_index;                     ///< The index of the GPU as enumerated by the system.
+        uint64_t        gpu_counter_freq;              ///< The GPU counter frequency in ticks.
+        ClockInfo       engine_clock_hz;               ///< The GPU engine clock info in Hz.
+        uint32_t        num_shader_engines;            ///< The number of shader engines on the GPU.
+        uint32_t        num_shader_arrays_per_engine;  ///< The number of shader arrays per shader engine on the GPU.
+        uint32_t        num_cus;                       ///< The number of compute units on the GPU.
+        IdInfo          id_info;                       ///< The hardware info, used to uniquely identify a GPU in the system.
+        CachedRange     cu_mask;                       ///< The CU mask rows, one per shader engine.
+        CachedString    memory_type;                   ///< A string indicating the type of GPU memory.
+        uint32_t        mem_ops_per_clock;             ///< The total count of memory operations per clock.
+        uint32_t        bus_bit_width;                 ///< The total width of the memory bus in bits.
+        uint64_t        bandwidth;                     ///< The total computed bandwidth of the memory bus in bytes/second.
+        ClockInfo       mem_clock_hz;                  ///< The device memory clock range info in Hz.
+        CachedRange     heaps;                         ///< The memory heaps.
+        CachedRange     excluded_va_ranges;            ///< The excluded virtual address ranges.
+        SoftwareVersion big_sw;                        ///< The 'Big Software' release version number info.
+        uint32_t        reserved;                      ///< Padding, always zero.
+    };
+
+    /// @brief The cached GPU memory heap info.
+    struct CachedHeapInfo
+    {
+        CachedString heap_type;  ///< A string indicating the heap type (typically Local or Invisible).
+        uint64_t     phys_addr;  ///< The physical heap location as a byte offset.
+        uint64_t     size;       ///< The physical heap size in bytes.
+    };
+
+    /// @brief The cached system process info.
+    struct CachedProcess
+    {
+        CachedString name;      ///< Process name
+        CachedString path;      ///< Process filepath
+        uint32_t     id;        ///< Process ID
+        uint32_t     reserved;  ///< Padding, always zero.
+    };
+
+    /// @brief The arrays stored in a cache file.
+    enum class CacheSection : uint32_t
+    {
+        kSystem,            ///< A single CachedSystemInfo record.
+        kCpus,              ///< CachedCpuInfo records.
+        kGpus,              ///< CachedGpuInfo records.
+        kHeaps,             ///< CachedHeapInfo records, referenced by CachedGpuInfo::heaps.
+        kExcludedVaRanges,  ///< ExcludedRangeInfo records, referenced by CachedGpuInfo::excluded_va_ranges.
+        kCuMaskRows,        ///< CachedRange records into kCuMaskValues, referenced by CachedGpuInfo::cu_mask.
+        kCuMaskValues,      ///< uint32_t CU mask values.
+        kProcesses,         ///< CachedProcess records.
+        kStrings,           ///< The null terminated string bytes.
+        kCount
+    };
+
+    /// @brief The location of an array in a cache file.
+    struct CacheSectionInfo
+    {
+        uint64_t offset;  ///< The byte offset of the array from the start of the file. Always a multiple of 8.
+        uint64_t count;   ///< The number of records in the array.
+    };
+
+    /// @brief The fixed size header at the start of a cache file.
+    struct CacheHeader
+    {
+        uint32_t         magic;                                                  ///< Identifies the file as a system info cache.
+        uint32_t         version;                                                ///< The cache format version.
+        uint64_t         key;                                                    ///< The key of the source the cache was created from.
+        uint64_t         size;                                                   ///< The total size of the file in bytes.
+        CacheSectionInfo sections[static_cast<uint32_t>(CacheSection::kCount)];  ///< The arrays in the file.
+    };
+
+    /// @brief A read-only view of consecutive records in a cache file.
+    template <typename T>
+    class CacheView
+    {
+    public:
+        /// @brief Constructor for an empty view.
+        CacheView() = default;
+
+        /// @brief Constructor.
+        /// @param [in] data The first record.
+        /// @param [in] size The number of records.
+        CacheView(const T* data, size_t size)
+            : data_(data)
+            , size_(size)
+        {
+        }
+
+        /// @brief Get the first record.
+        const T* begin() const
+        {
+            return data_;
+        }
+
+        /// @brief Get the end of the records.
+        const T* end() const
+        {
+            return data_ + size_;
+        }
+
+        /// @brief Get the number of records.
+        size_t size() const
+        {
+            return size_;
+        }
+
+        /// @brief Check if the view has no records.
+        bool empty() const
+        {
+            return size_ == 0;
+        }
+
+        /// @brief Get a record by index.
+        const T& operator[](size_t index) const
+        {
+            return data_[index];
+        }
+
+    private:
+        const T* data_ = nullptr;  ///< The first record.
+        size_t   size_ = 0;        ///< The number of records.
+    };
+
+    /// @brief Loads a system info cache and gives read-only access to its records.
+    ///
+    /// Records are read in place from the cache data, so no memory is allocated
+    /// per field. Views and strings are valid until the cache is closed.
+    class SystemInfoCache
+    {
+    public:
+        /// @brief Constructor
+        SystemInfoCache() = default;
+
+        /// @brief Destructor
+        ~SystemInfoCache();
+
+        /// @brief delete copy constructor
+        SystemInfoCache(const SystemInfoCache&) = delete;
+
+        /// @brief delete assignment operator
+        SystemInfoCache& operator=(const SystemInfoCache&) = delete;
+
+        /// @brief Memory map a cache file.
+        /// @param [in] path The path of the cache file.
+        /// @return true if the file was mapped and is a valid cache, false otherwise
+        bool Open(const std::string& path);
+
+        /// @brief Use cache data already in memory. The data is not copied and must outlive the cache.
+        /// @param [in] data The cache data. Must be aligned to 8 bytes.
+        /// @param [in] size The size of the cache data in bytes.
+        /// @return true if the data is a valid cache, false otherwise
+        bool Load(const void* data, size_t size);
+
+        /// @brief Release the cache data.
+        void Close();
+
+        /// @brief Check if a valid cache is loaded.
+        /// @return true if a cache is loaded, false otherwise
+        bool IsOpen() const;
+
+        /// @brief Get the key of the source the cache was created from.
+        /// @return The key passed to SystemInfoWriter::Serialize, or zero if no cache is loaded.
+        uint64_t GetKey() const;
+
+        /// @brief Get the top level system info fields. A cache must be loaded.
+        /// @return The system info record.
+        const CachedSystemInfo& GetSystem() const;
+
+        /// @brief Get the CPUs.
+        /// @return The CPU records.
+        CacheView<CachedCpuInfo> GetCpus() const;
+
+        /// @brief Get the GPUs.
+        /// @return The GPU records.
+        CacheView<CachedGpuInfo> GetGpus() const;
+
+        /// @brief Get the processes.
+        /// @return The process records.
+        CacheView<CachedProcess> GetProcesses() const;
+
+        /// @brief Get the memory heaps of a GPU.
+        /// @param [in] gpu The GPU record.
+        /// @return The heap records, or an empty view if the range is invalid.
+        CacheView<CachedHeapInfo> GetHeaps(const CachedGpuInfo& gpu) const;
+
+        /// @brief Get the excluded virtual address ranges of a GPU.
+        /// @param [in] gpu The GPU record.
+        /// @return The excluded range records, or an empty view if the range is invalid.
+        CacheView<ExcludedRangeInfo> GetExcludedVaRanges(const CachedGpuInfo& gpu) const;
+
+        /// @brief Get the CU mask rows of a GPU, one per shader engine.
+        /// @param [in] gpu The GPU record.
+        /// @return The CU mask rows, or an empty view if the range is invalid.
+        CacheView<CachedRange> GetCuMask(const CachedGpuInfo& gpu) const;
+
+        /// @brief Get the values of a CU mask row.
+        /// @param [in] row The CU mask row.
+        /// @return The CU mask values, or an empty view if the range is invalid.
+        CacheView<uint32_t> GetCuMaskValues(const CachedRange& row) const;
+
+        /// @brief Get a string from the string table. The string is null terminated.
+        /// @param [in] string The cached string.
+        /// @return The string, or an empty string if it is out of range.
+        std::string_view GetString(const CachedString& string) const;
+
+        /// @brief Copy the whole cache into a system info structure.
+        /// @param [in, out] system_info The system info structure. Its previous contents are replaced.
+        /// @return true if a cache is loaded, false otherwise
+        bool ToSystemInfo(SystemInfo& system_info) const;
+
+        /// @brief Compute the key identifying a cache source, such as the contents of an RDF file.
+        /// @param [in] data The source data.
+        /// @param [in] size The size of the source data in bytes.
+        /// @return The 64-bit FNV-1a hash of the data.
+        static uint64_t ComputeKey(const void* data, size_t size);
+
+    private:
+        /// @brief Get a range of records from a section.
+        template <typename T>
+        CacheView<T> GetRange(CacheSection section, uint64_t first, uint64_t count) const;
+
+        /// @brief Validate the header of the loaded data.
+        bool Validate() const;
+
+        const uint8_t* data_   = nullptr;  ///< The cache data.
+        size_t         size_   = 0;        ///< The size of the cache data in bytes.
+        bool           mapped_ = false;    ///< True if the data is a mapping owned by the cache.
+    };
+}  // namespace system_info_utils
+
+#endif
@@ -0,0 +1,964 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief System info collector implementation
+//=============================================================================
+
+#include "system_info_collector.h"
+
+#ifdef __linux__
+#include <dirent.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <sys/ioctl.h>
+#include <sys/utsname.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string_view>
+#include <utility>
+
+// The kernel UAPI headers describe the DRM ioctls, so libdrm is not needed.
+#if defined(__has_include)
+#if __has_include(<drm/drm.h>) && __has_include(<drm/amdgpu_drm.h>)
+#include <drm/drm.h>
+#include <drm/amdgpu_drm.h>
+#define SYSTEM_INFO_COLLECTOR_AMDGPU_INFO
+#endif
+#endif
+#endif
+
+#include "definitions.h"
+#include "system_info_decoder.h"
+
+#ifdef __linux__
+namespace
+{
+    using system_info_utils::CpuInfo;
+    using system_info_utils::GpuInfo;
+    using system_info_utils::HeapInfo;
+
+    constexpr uint32_t kAmdVendorId             = 0x1002;      ///< The PCI vendor ID of AMD.
+    constexpr uint64_t kTimestampClockFrequency = 1000000000;  ///< CLOCK_MONOTONIC, which Linux tools timestamp with, counts nanoseconds.
+    constexpr size_t   kReadSize                = 4096;        ///< The number of bytes read from a file at a time.
+
+    /// @brief Read the whole contents of an open file.
+    ///
+    /// The file is read from the start with pread, so procfs files can be kept open and read again.
+    ///
+    /// @param [in] fd The file descriptor.
+    /// @param [out] out The file contents. Its capacity is reused.
+    /// @return true if the file was read, false otherwise.
+    bool ReadFd(int fd, std::string& out)
+    {
+        size_t size = 0;
+        for (;;)
+        {
+            if (out.size() < size + kReadSize)
+            {
+                out.resize(size + kReadSize);
+            }
+
+            const ssize_t count = pread(fd, &out[size], out.size() - size, static_cast<off_t>(size));
+            if (count < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                out.clear();
+                return false;
+            }
+
+            if (count == 0)
+            {
+                break;
+            }
+            size += static_cast<size_t>(count);
+        }
+
+        out.resize(size);
+        return true;
+    }
+
+    /// @brief Read the whole contents of a file.
+    /// @param [in] dir_fd The directory the path is relative to.
+    /// @param [in] path The path of the file.
+    /// @param [out] out The file contents. Its capacity is reused.
+    /// @return true if the file was read, false otherwise.
+    bool ReadFile(int dir_fd, const char* path, std::string& out)
+    {
+        const int fd = openat(dir_fd, path, O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            out.clear();
+            return false;
+        }
+
+        const bool result = ReadFd(fd, out);
+        close(fd);
+
+        return result;
+    }
+
+    /// @brief Remove the leading and trailing whitespace of a string.
+    /// @param [in] text The string.
+    /// @return The string without the whitespace.
+    std::string_view Trim(std::string_view text)
+    {
+        static constexpr const char* kWhitespace = " \t\r\n";
+
+        const size_t first = text.find_first_not_of(kWhitespace);
+        if (first == std::string_view::npos)
+        {
+            return std::string_view();
+        }
+
+        return text.substr(first, text.find_last_not_of(kWhitespace) - first + 1);
+    }
+
+    /// @brief Parse a decimal number, or a hex number with a 0x prefix, as written in sysfs.
+    /// @param [in] text The number text. Surrounding whitespace is ignored.
+    /// @param [out] out The number. Not modified if the text is not a number.
+    /// @return true if the number was parsed, false otherwise.
+    template <typename T>
+    bool ParseNumber(std::string_view text, T& out)
+    {
+        text = Trim(text);
+
+        int base = 10;
+        if ((text.size() > 2) && (text[0] == '0') && ((text[1] == 'x') || (text[1] == 'X')))
+        {
+            text.remove_prefix(2);
+            base = 16;
+        }
+
+        T value = 0;
+        if (std::from_chars(text.data(), text.data() + text.size(), value, base).ec != std::errc())
+        {
+            return false;
+        }
+
+        out = value;
+        return true;
+    }
+
+    /// @brief Read a number from a file.
+    /// @param [in] dir_fd The directory the path is relative to.
+    /// @param [in] path The path of the file.
+    /// @param [in, out] buffer The buffer the file is read into.
+    /// @param [out] out The number. Not modified if the file cannot be read or is not a number.
+    /// @return true if the number was read, false otherwise.
+    template <typename T>
+    bool ReadNumber(int dir_fd, const char* path, std::string& buffer, T& out)
+    {
+        return ReadFile(dir_fd, path, buffer) && ParseNumber(buffer, out);
+    }
+
+    /// @brief Call a function for every "key: value" line of a procfs file.
+    /// @param [in] text The file contents.
+    /// @param [in] function Called with the trimmed key and value of each line that contains a colon.
+    template <typename Function>
+    void ForEachField(std::string_view text, Function function)
+    {
+        while (!text.empty())
+        {
+            const size_t           end  = text.find('\n');
+            const std::string_view line = text.substr(0, end);
+            text.remove_prefix((end == std::string_view::npos) ? text.size() : end + 1);
+
+            const size_t colon = line.find(':');
+            if (colon != std::string_view::npos)
+            {
+                function(Trim(line.substr(0, colon)), Trim(line.substr(colon + 1)));
+            }
+        }
+    }
+
+    /// @brief Check if a space separated list contains a word.
+    /// @param [in] list The list, e.g. the flags of /proc/cpuinfo.
+    /// @param [in] word The word.
+    /// @return true if the list contains the word, false otherwise.
+    bool HasWord(std::string_view list, std::string_view word)
+    {
+        for (size_t position = list.find(word); position != std::string_view::npos; position = list.find(word, position + 1))
+        {
+            const size_t end = position + word.size();
+            if (((position == 0) || (list[position - 1] == ' ')) && ((end == list.size()) || (list[end] == ' ')))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /// @brief Get the last component of a path.
+    /// @param [in] path The path.
+    /// @return The text after the last slash.
+    std::string_view GetFileName(std::string_view path)
+    {
+        const size_t slash = path.find_last_of('/');
+        return (slash == std::string_view::npos) ? path : path.substr(slash + 1);
+    }
+
+    /// @brief Read the lowest and highest clock of a pp_dpm_* file of an amdgpu device.
+    ///
+    /// Each line of the file is a power state, e.g. "1: 2500Mhz *".
+    ///
+    /// @param [in] device_fd The PCI device directory.
+    /// @param [in] path The name of the file.
+    /// @param [in, out] buffer The buffer the file is read into.
+    /// @param [out] clock The clock range in Hz. Not modified if the file cannot be read.
+    void ReadDpmClock(int device_fd, const char* path, std::string& buffer, system_info_utils::ClockInfo& clock)
+    {
+        if (!ReadFile(device_fd, path, buffer))
+        {
+            return;
+        }
+
+        uint64_t min = UINT64_MAX;
+        uint64_t max = 0;
+        ForEachField(buffer, [&min, &max](std::string_view, std::string_view value) {
+            uint64_t mhz = 0;
+            if (std::from_chars(value.data(), value.data() + value.size(), mhz).ec == std::errc())
+            {
+                min = std::min(min, mhz);
+                max = std::max(max, mhz);
+            }
+        });
+
+        if (max != 0)
+        {
+            clock.min = min * 1000000;
+            clock.max = max * 1000000;
+        }
+    }
+
+    /// @brief Collect the CPUs from /proc/cpuinfo, one entry per physical package.
+    /// @param [in] proc_fd The /proc directory.
+    /// @param [in] architecture The machine architecture reported by uname.
+    /// @param [in, out] buffer The buffer files are read into.
+    /// @param [out] cpus The CPUs.
+    void CollectCpus(int proc_fd, const std::string& architecture, std::string& buffer, std::vector<CpuInfo>& cpus)
+    {
+        /// @brief The fields of one logical processor.
+        struct LogicalCpu
+        {
+            uint32_t         processor   = 0;
+            uint32_t         physical_id = 0;
+            uint32_t         family      = 0;
+            uint32_t         model       = 0;
+            uint32_t         stepping    = 0;
+            uint32_t         cores       = 0;
+            double           mhz         = 0.0;
+            bool             has_family  = false;
+            std::string_view name;
+            std::string_view vendor_id;
+            std::string_view flags;
+        };
+
+        cpus.clear();
+        if (!ReadFile(proc_fd, "cpuinfo", buffer))
+        {
+            return;
+        }
+
+        std::vector<LogicalCpu> logical_cpus;
+        ForEachField(buffer, [&logical_cpus](std::string_view key, std::string_view value) {
+            if (key == "processor")
+            {
+                logical_cpus.emplace_back();
+                ParseNumber(value, logical_cpus.back().processor);
+            }
+
+            if (logical_cpus.empty())
+            {
+                return;
+            }
+
+            LogicalCpu& cpu = logical_cpus.back();
+            if (key == "physical id")
+            {
+                ParseNumber(value, cpu.physical_id);
+            }
+            else if (key == "model name")
+            {
+                cpu.name = value;
+            }
+            else if (key == "vendor_id")
+            {
+                cpu.vendor_id = value;
+            }
+            else if (key == "cpu family")
+            {
+                cpu.has_family = ParseNumber(value, cpu.family);
+            }
+            else if (key == "model")
+            {
+                ParseNumber(value, cpu.model);
+            }
+            else if (key == "stepping")
+            {
+                ParseNumber(value, cpu.stepping);
+            }
+            else if (key == "cpu cores")
+            {
+                ParseNumber(value, cpu.cores);
+            }
+            else if (key == "cpu MHz")
+            {
+                std::from_chars(value.data(), value.data() + value.size(), cpu.mhz);
+            }
+            else if (key == "flags")
+            {
+                cpu.flags = value;
+            }
+        });
+
+        std::map<uint32_t, size_t> packages;  // The index in cpus of each physical package.
+        for (const LogicalCpu& logical_cpu : logical_cpus)
+        {
+            auto result = packages.try_emplace(logical_cpu.physical_id, cpus.size());
+            if (result.second)
+            {
+                CpuInfo cpu                   = {};
+                cpu.name                      = logical_cpu.name;
+                cpu.vendor_id                 = logical_cpu.vendor_id;
+                cpu.architecture              = architecture;
+                cpu.device_id                 = "CPU" + std::to_string(logical_cpu.physical_id);
+                cpu.num_physical_cores        = logical_cpu.cores;
+                cpu.timestamp_clock_frequency = kTimestampClockFrequency;
+
+                if (logical_cpu.has_family)
+                {
+                    cpu.cpu_id = architecture + " Family " + std::to_string(logical_cpu.family) + " Model " + std::to_string(logical_cpu.model) +
+                                 " Stepping " + std::to_string(logical_cpu.stepping);
+                }
+
+                if (HasWord(logical_cpu.flags, "svm"))
+                {
+                    cpu.virtualization = "AMD-V";
+                }
+                else if (HasWord(logical_cpu.flags, "vmx"))
+                {
+                    cpu.virtualization = "VT-x";
+                }
+
+                // The maximum frequency of the first processor of the package, in kHz.
+                char     path[64] = {};
+                uint32_t max_khz  = 0;
+                snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cpufreq/cpuinfo_max_freq", logical_cpu.processor);
+                std::string frequency;
+                if (ReadNumber(AT_FDCWD, path, frequency, max_khz))
+                {
+                    cpu.max_clock_speed = max_khz / 1000;
+                }
+
+                cpus.push_back(std::move(cpu));
+            }
+
+            CpuInfo& cpu = cpus[result.first->second];
+            ++cpu.num_logical_cores;
+            if (logical_cpu.mhz > cpu.max_clock_speed)
+            {
+                cpu.max_clock_speed = static_cast<uint32_t>(logical_cpu.mhz);
+            }
+        }
+
+        for (CpuInfo& cpu : cpus)
+        {
+            if (cpu.num_physical_cores == 0)
+            {
+                cpu.num_physical_cores = cpu.num_logical_cores;
+            }
+        }
+    }
+
+#ifdef SYSTEM_INFO_COLLECTOR_AMDGPU_INFO
+    /// @brief Open the render node of a DRM device.
+    /// @param [in] device_fd The PCI device directory.
+    /// @return The render node file descriptor, or -1 if it cannot be opened.
+    int OpenRenderNode(int device_fd)
+    {
+        const int drm_fd = openat(device_fd, "drm", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (drm_fd < 0)
+        {
+            return -1;
+        }
+
+        int  result = -1;
+        DIR* dir    = fdopendir(drm_fd);
+        if (dir == nullptr)
+        {
+            close(drm_fd);
+            return -1;
+        }
+
+        while (const dirent* entry = readdir(dir))
+        {
+            if (strncmp(entry->d_name, "renderD", 7) == 0)
+            {
+                const std::string path = std::string("/dev/dri/") + entry->d_name;
+                result                 = open(path.c_str(), O_RDWR | O_CLOEXEC);
+                break;
+            }
+        }
+
+        closedir(dir);
+
+        return result;
+    }
+
+    /// @brief Get the name and the operations per clock of a VRAM type.
+    /// @param [in] vram_type The AMDGPU_VRAM_TYPE_* value.
+    /// @param [out] ops_per_clock The memory operations per clock.
+    /// @return The memory type name, or nullptr if the type is unknown.
+    const char* GetVramType(uint32_t vram_type, uint32_t& ops_per_clock)
+    {
+        switch (vram_type)
+        {
+        case AMDGPU_VRAM_TYPE_GDDR1:
+            ops_per_clock = 2;
+            return "GDDR1";
+        case AMDGPU_VRAM_TYPE_DDR2:
+            ops_per_clock = 2;
+            return "DDR2";
+        case AMDGPU_VRAM_TYPE_GDDR3:
+            ops_per_clock = 2;
+            return "GDDR3";
+        case AMDGPU_VRAM_TYPE_GDDR4:
+            ops_per_clock = 2;
+            return "GDDR4";
+        case AMDGPU_VRAM_TYPE_GDDR5:
+            ops_per_clock = 4;
+            return "GDDR5";
+        case AMDGPU_VRAM_TYPE_HBM:
+            ops_per_clock = 2;
+            return "HBM";
+        case AMDGPU_VRAM_TYPE_DDR3:
+            ops_per_clock = 2;
+            return "DDR3";
+#ifdef AMDGPU_VRAM_TYPE_DDR4
+        case AMDGPU_VRAM_TYPE_DDR4:
+            ops_per_clock = 2;
+            return "DDR4";
+#endif
+#ifdef AMDGPU_VRAM_TYPE_GDDR6
+        case AMDGPU_VRAM_TYPE_GDDR6:
+            ops_per_clock = 16;
+            return "GDDR6";
+#endif
+#ifdef AMDGPU_VRAM_TYPE_DDR5
+        case AMDGPU_VRAM_TYPE_DDR5:
+            ops_per_clock = 4;
+            return "DDR5";
+#endif
+#ifdef AMDGPU_VRAM_TYPE_LPDDR4
+        case AMDGPU_VRAM_TYPE_LPDDR4:
+            ops_per_clock = 2;
+            return "LPDDR4";
+#endif
+#ifdef AMDGPU_VRAM_TYPE_LPDDR5
+        case AMDGPU_VRAM_TYPE_LPDDR5:
+            ops_per_clock = 4;
+            return "LPDDR5";
+#endif
+        default:
+            return nullptr;
+        }
+    }
+
+    /// @brief Fill the GPU fields reported by the amdgpu device info query.
+    /// @param [in] render_fd The render node of the GPU.
+    /// @param [in, out] gpu The GPU.
+    void QueryDeviceInfo(int render_fd, GpuInfo& gpu)
+    {
+        drm_amdgpu_info_device info    = {};
+        drm_amdgpu_info        request = {};
+        request.return_pointer         = reinterpret_cast<uintptr_t>(&info);
+        request.return_size            = sizeof(info);
+        request.query                  = AMDGPU_INFO_DEV_INFO;
+        if (ioctl(render_fd, DRM_IOCTL_AMDGPU_INFO, &request) != 0)
+        {
+            return;
+        }
+
+        system_info_utils::AsicInfo& asic = gpu.asic;
+        asic.id_info.family               = info.family;
+        asic.id_info.e_rev                = info.external_rev;
+        asic.gpu_counter_freq             = static_cast<uint64_t>(info.gpu_counter_freq) * 1000;
+        asic.num_shader_engines           = info.num_shader_engines;
+        asic.num_shader_arrays_per_engine = info.num_shader_arrays_per_engine;
+        asic.num_cus                      = info.cu_active_number;
+
+        // The kernel packs the masks of shader engines 4 and up after those of the first four.
+        asic.cu_mask.Clear();
+        for (uint32_t engine = 0; engine < info.num_shader_engines; ++engine)
+        {
+            asic.cu_mask.AddShaderEngine();
+            for (uint32_t array = 0; array < info.num_shader_arrays_per_engine; ++array)
+            {
+                const uint32_t column = array + (engine / 4) * info.num_shader_arrays_per_engine;
+                asic.cu_mask.AddShaderArray((column < 4) ? info.cu_bitmap[engine % 4][column] : 0);
+            }
+        }
+
+        if (asic.engine_clock_hz.max == 0)
+        {
+            asic.engine_clock_hz.max = static_cast<uint64_t>(info.max_engine_clock) * 1000;
+        }
+
+        system_info_utils::MemoryInfo& memory = gpu.memory;
+        if (memory.mem_clock_hz.max == 0)
+        {
+            memory.mem_clock_hz.max = static_cast<uint64_t>(info.max_memory_clock) * 1000;
+        }
+
+        uint32_t    ops_per_clock = 0;
+        const char* type          = GetVramType(info.vram_type, ops_per_clock);
+        if (type != nullptr)
+        {
+            memory.type              = type;
+            memory.mem_ops_per_clock = ops_per_clock;
+        }
+        memory.bus_bit_width = info.vram_bit_width;
+        memory.bandwidth     = memory.mem_clock_hz.max * memory.mem_ops_per_clock * (memory.bus_bit_width / 8);
+    }
+
+    /// @brief Read the version of the DRM kernel driver.
+    /// @param [in] render_fd The render node of a GPU.
+    /// @param [in, out] config The configuration info.
+    void QueryDrmVersion(int render_fd, system_info_utils::ConfigInfo& config)
+    {
+        // Without name, date and description buffers only the version numbers are returned.
+        drm_version version = {};
+        if (ioctl(render_fd, DRM_IOCTL_VERSION, &version) == 0)
+        {
+            config.drm_major_version = static_cast<uint32_t>(version.version_major);
+            config.drm_minor_version = static_cast<uint32_t>(version.version_minor);
+        }
+    }
+#endif
+
+    /// @brief Collect the AMD GPUs from /sys/class/drm.
+    /// @param [in, out] buffer The buffer files are read into.
+    /// @param [in, out] system_info The system info. The GPU list and the OS configuration are filled.
+    void CollectGpus(std::string& buffer, system_info_utils::SystemInfo& system_info)
+    {
+        system_info.gpus.clear();
+
+        const int drm_fd = open("/sys/class/drm", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (drm_fd < 0)
+        {
+            return;
+        }
+
+        // The primary nodes in the order of their card number. Connectors such as card0-DP-1 are not devices.
+        std::vector<std::pair<uint32_t, std::string>> cards;
+        const int                                     list_fd = dup(drm_fd);
+        DIR*                                          dir     = (list_fd >= 0) ? fdopendir(list_fd) : nullptr;
+        if (dir != nullptr)
+        {
+            while (const dirent* entry = readdir(dir))
+            {
+                const std::string_view name(entry->d_name);
+                uint32_t               number = 0;
+                if ((name.substr(0, 4) == "card") && (name.size() > 4) &&
+                    (std::from_chars(name.data() + 4, name.data() + name.size(), number).ptr == name.data() + name.size()))
+                {
+                    cards.emplace_back(number, name);
+                }
+            }
+            closedir(dir);
+        }
+        else if (list_fd >= 0)
+        {
+            close(list_fd);
+        }
+        std::sort(cards.begin(), cards.end());
+
+#ifdef SYSTEM_INFO_COLLECTOR_AMDGPU_INFO
+        bool drm_version_found = false;
+#endif
+        for (const auto& card : cards)
+        {
+            const int device_fd = openat(drm_fd, (card.second + "/device").c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+            if (device_fd < 0)
+            {
+                continue;
+            }
+
+            uint32_t vendor = 0;
+            if (!ReadNumber(device_fd, "vendor", buffer, vendor) || (vendor != kAmdVendorId))
+            {
+                close(device_fd);
+                continue;
+            }
+
+            GpuInfo gpu             = {};
+            gpu.asic.gpu_index      = static_cast<uint32_t>(system_info.gpus.size());
+            gpu.asic.id_info.vendor = vendor;
+            ReadNumber(device_fd, "device", buffer, gpu.asic.id_info.device);
+            ReadNumber(device_fd, "revision", buffer, gpu.asic.id_info.revision);
+
+            uint32_t subsystem_vendor = 0;
+            uint32_t subsystem_device = 0;
+            ReadNumber(device_fd, "subsystem_vendor", buffer, subsystem_vendor);
+            ReadNumber(device_fd, "subsystem_device", buffer, subsystem_device);
+            gpu.asic.id_info.subsystem = (subsystem_device << 16) | subsystem_vendor;
+
+            if (ReadFile(device_fd, "product_name", buffer))
+            {
+                gpu.name = Trim(buffer);
+            }
+
+            // The device link ends with the PCI address, e.g. "0000:03:00.0".
+            char          link[PATH_MAX] = {};
+            const ssize_t link_size      = readlinkat(drm_fd, (card.second + "/device").c_str(), link, sizeof(link) - 1);
+            if (link_size > 0)
+            {
+                const std::string address(GetFileName(std::string_view(link, static_cast<size_t>(link_size))));
+                uint32_t          domain = 0;
+                sscanf(address.c_str(), "%x:%x:%x.%x", &domain, &gpu.pci.bus, &gpu.pci.device, &gpu.pci.function);
+            }
+
+            ReadDpmClock(device_fd, "pp_dpm_sclk", buffer, gpu.asic.engine_clock_hz);
+            ReadDpmClock(device_fd, "pp_dpm_mclk", buffer, gpu.memory.mem_clock_hz);
+
+            // The CPU visible part of the VRAM comes first, followed by the invisible part.
+            uint64_t vram_size         = 0;
+            uint64_t visible_vram_size = 0;
+            if (ReadNumber(device_fd, "mem_info_vram_total", buffer, vram_size))
+            {
+                ReadNumber(device_fd, "mem_info_vis_vram_total", buffer, visible_vram_size);
+                visible_vram_size = std::min(visible_vram_size, vram_size);
+                gpu.memory.heaps.push_back(HeapInfo{kNodeStringLocal, 0, visible_vram_size});
+                gpu.memory.heaps.push_back(HeapInfo{kNodeStringInvisible, visible_vram_size, vram_size - visible_vram_size});
+            }
+
+            if (faccessat(device_fd, "power_dpm_force_performance_level", W_OK, 0) == 0)
+            {
+                system_info.os.config.power_dpm_writable = true;
+            }
+
+#ifdef SYSTEM_INFO_COLLECTOR_AMDGPU_INFO
+            const int render_fd = OpenRenderNode(device_fd);
+            if (render_fd >= 0)
+            {
+                QueryDeviceInfo(render_fd, gpu);
+                if (!drm_version_found)
+                {
+                    QueryDrmVersion(render_fd, system_info.os.config);
+                    drm_version_found = true;
+                }
+                close(render_fd);
+            }
+#endif
+
+            close(device_fd);
+            system_info.gpus.push_back(std::move(gpu));
+        }
+
+        close(drm_fd);
+    }
+
+    /// @brief Collect the OS names from uname and /etc/os-release.
+    /// @param [in] name The uname info.
+    /// @param [in, out] buffer The buffer files are read into.
+    /// @param [out] os The OS info.
+    void CollectOs(const utsname& name, std::string& buffer, system_info_utils::OsInfo& os)
+    {
+        os.name     = name.sysname;
+        os.desc     = std::string(name.release) + " " + name.version;
+        os.hostname = name.nodename;
+
+        if (ReadFile(AT_FDCWD, "/etc/os-release", buffer))
+        {
+            std::string_view text = buffer;
+            while (!text.empty())
+            {
+                const size_t           end  = text.find('\n');
+                const std::string_view line = text.substr(0, end);
+                text.remove_prefix((end == std::string_view::npos) ? text.size() : end + 1);
+
+                static constexpr std::string_view kPrettyName = "PRETTY_NAME=";
+                if (line.substr(0, kPrettyName.size()) == kPrettyName)
+                {
+                    std::string_view value = Trim(line.substr(kPrettyName.size()));
+                    if ((value.size() >= 2) && (value.front() == '"') && (value.back() == '"'))
+                    {
+                        value = value.substr(1, value.size() - 2);
+                    }
+                    os.name = value;
+                    break;
+                }
+            }
+        }
+    }
+
+    /// @brief Collect the amdgpu kernel driver info.
+    /// @param [in, out] buffer The buffer files are read into.
+    /// @param [out] driver The driver info.
+    void CollectDriver(std::string& buffer, system_info_utils::DriverInfo& driver)
+    {
+        const int module_fd = open("/sys/module/amdgpu", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (module_fd < 0)
+        {
+            return;
+        }
+
+        driver.name = "amdgpu";
+
+        // Only out of tree builds of the driver report a version.
+        if (ReadFile(module_fd, "version", buffer))
+        {
+            driver.packaging_version = Trim(buffer);
+            system_info_utils::SystemInfoDecoder::DecodePackagingVersion(
+                driver.packaging_version, driver.packaging_version_major, driver.packaging_version_minor);
+        }
+
+        close(module_fd);
+    }
+}  // namespace
+#endif
+
+namespace system_info_utils
+{
+    SystemInfoCollector::SystemInfoCollector()
+        : static_info_()
+        , static_collected_(false)
+        , proc_fd_(-1)
+        , meminfo_fd_(-1)
+    {
+    }
+
+    SystemInfoCollector::~SystemInfoCollector()
+    {
+#ifdef __linux__
+        if (meminfo_fd_ >= 0)
+        {
+            close(meminfo_fd_);
+        }
+        if (proc_fd_ >= 0)
+        {
+            close(proc_fd_);
+        }
+#endif
+    }
+
+    bool SystemInfoCollector::Collect(SystemInfo& system_info, uint32_t sections)
+    {
+#ifdef __linux__
+        if (proc_fd_ < 0)
+        {
+            proc_fd_ = open("/proc", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+            if (proc_fd_ < 0)
+            {
+                return false;
+            }
+        }
+
+        if (!static_collected_)
+        {
+            CollectStatic();
+            static_collected_ = true;
+        }
+
+        system_info.version = static_info_.version;
+
+        if ((sections & kSystemInfoSectionDriver) != 0)
+        {
+            system_info.driver    = static_info_.driver;
+            system_info.devdriver = static_info_.devdriver;
+        }
+
+        if ((sections & kSystemInfoSectionOs) != 0)
+        {
+            const ConfigInfo config = system_info.os.config;
+            system_info.os          = static_info_.os;
+            if ((sections & kSystemInfoSectionOsConfig) == 0)
+            {
+                system_info.os.config = config;
+            }
+            CollectMemory(system_info.os.memory);
+        }
+
+        if ((sections & kSystemInfoSectionCpus) != 0)
+        {
+            system_info.cpus = static_info_.cpus;
+        }
+
+        if ((sections & kSystemInfoSectionGpus) != 0)
+        {
+            system_info.gpus = static_info_.gpus;
+            if ((sections & kSystemInfoSectionGpuHeaps) == 0)
+            {
+                for (GpuInfo& gpu : system_info.gpus)
+                {
+                    gpu.memory.heaps.clear();
+                }
+            }
+        }
+
+        if ((sections & kSystemInfoSectionProcessTable) != 0)
+        {
+            CollectProcesses(system_info, true);
+        }
+        else if ((sections & kSystemInfoSectionProcesses) != 0)
+        {
+            CollectProcesses(system_info, false);
+        }
+
+        return true;
+#else
+        SYSTEM_INFO_UNUSED(system_info);
+        SYSTEM_INFO_UNUSED(sections);
+        return false;
+#endif
+    }
+
+    void SystemInfoCollector::Reset()
+    {
+        static_info_      = SystemInfo();
+        static_collected_ = false;
+    }
+
+    void SystemInfoCollector::CollectStatic()
+    {
+#ifdef __linux__
+        static_info_ = SystemInfo();
+
+        // Version 2 of the schema includes the process list.
+        static_info_.version.major = 2;
+
+        utsname name = {};
+        uname(&name);
+
+        CollectDriver(buffer_, static_info_.driver);
+        CollectOs(name, buffer_, static_info_.os);
+        CollectCpus(proc_fd_, name.machine, buffer_, static_info_.cpus);
+        CollectGpus(buffer_, static_info_);
+#endif
+    }
+
+    void SystemInfoCollector::CollectMemory(OsMemoryInfo& memory)
+    {
+#ifdef __linux__
+        memory.physical = 0;
+        memory.swap     = 0;
+
+        if (meminfo_fd_ < 0)
+        {
+            meminfo_fd_ = openat(proc_fd_, "meminfo", O_RDONLY | O_CLOEXEC);
+        }
+
+        if ((meminfo_fd_ < 0) || !ReadFd(meminfo_fd_, buffer_))
+        {
+            return;
+        }
+
+        // The sizes are reported in KiB, e.g. "MemTotal:       65799056 kB".
+        ForEachField(buffer_, [&memory](std::string_view key, std::string_view value) {
+            uint64_t size = 0;
+            if (std::from_chars(value.data(), value.data() + value.size(), size).ec != std::errc())
+            {
+                return;
+            }
+
+            if (key == "MemTotal")
+            {
+                memory.physical = size * 1024;
+            }
+            else if (key == "SwapTotal")
+            {
+                memory.swap = size * 1024;
+            }
+        });
+#else
+        SYSTEM_INFO_UNUSED(memory);
+#endif
+    }
+
+    void SystemInfoCollector::CollectProcesses(SystemInfo& system_info, bool use_table)
+    {
+        if (use_table)
+        {
+            system_info.process_table.Clear();
+        }
+        else
+        {
+            system_info.processes.clear();
+        }
+
+#ifdef __linux__
+        // The directory stream shares the file offset of proc_fd_, so it is rewound for every listing.
+        const int list_fd = dup(proc_fd_);
+        if (list_fd < 0)
+        {
+            return;
+        }
+
+        DIR* dir = fdopendir(list_fd);
+        if (dir == nullptr)
+        {
+            close(list_fd);
+            return;
+        }
+        rewinddir(dir);
+
+        char path[32]      = {};
+        char exe[PATH_MAX] = {};
+        while (const dirent* entry = readdir(dir))
+        {
+            const std::string_view name(entry->d_name);
+
+            uint32_t id = 0;
+            if (std::from_chars(name.data(), name.data() + name.size(), id).ptr != name.data() + name.size())
+            {
+                continue;
+            }
+
+            // Processes that exited while the list was read are skipped.
+            snprintf(path, sizeof(path), "%u/comm", id);
+            if (!ReadFile(proc_fd_, path, buffer_))
+            {
+                continue;
+            }
+
+            std::string_view process_name = Trim(buffer_);
+            std::string_view process_path;
+
+            // The executable of kernel threads and of processes of other users cannot be read.
+            snprintf(path, sizeof(path), "%u/exe", id);
+            const ssize_t exe_size = readlinkat(proc_fd_, path, exe, sizeof(exe) - 1);
+            if (exe_size > 0)
+            {
+                process_path = std::string_view(exe, static_cast<size_t>(exe_size));
+
+                // The command name is truncated to 15 characters, unlike the executable name.
+                process_name = GetFileName(process_path);
+            }
+
+            if (use_table)
+            {
+                system_info.process_table.Add(process_name, process_path, id);
+            }
+            else
+            {
+                system_info.processes.push_back(Process{std::string(process_name), std::string(process_path), id});
+            }
+        }
+
+        closedir(dir);
+#else
+        SYSTEM_INFO_UNUSED(use_table);
+#endif
+    }
+}  // namespace system_info_utils
@@ -0,0 +1,78 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief System info collector definition
+///
+/// The System Info Collector fills the system info structures from the running system,
+/// rather than from a System Info chunk written by another component.
+//=============================================================================
+
+#ifndef SYSTEM_INFO_UTILS_SOURCE_SYSTEM_INFO_COLLECTOR_H_
+#define SYSTEM_INFO_UTILS_SOURCE_SYSTEM_INFO_COLLECTOR_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "system_info_reader.h"
+
+namespace system_info_utils
+{
+    /// @brief Collects the system info of the running system on Linux.
+    ///
+    /// The info is read from procfs and sysfs, and from the DRM render nodes when the kernel
+    /// amdgpu headers are available at build time. Nothing is run in a child process.
+    ///
+    /// The parts that do not change while the system is running (driver, OS, CPUs and GPUs) are
+    /// collected by the first call and cached. Later calls only refresh the system memory and the
+    /// process list, reading /proc/meminfo through a file descriptor that is kept open.
+    ///
+    /// A collector must not be shared between threads. On other platforms Collect fails.
+    class SystemInfoCollector
+    {
+    public:
+        /// @brief Constructor
+        SystemInfoCollector();
+
+        /// @brief Destructor
+        ~SystemInfoCollector();
+
+        /// @brief delete copy constructor
+        SystemInfoCollector(const SystemInfoCollector&) = delete;
+
+        /// @brief delete assignment operator
+        SystemInfoCollector& operator=(const SystemInfoCollector&) = delete;
+
+        /// @brief Collects the system info.
+        /// @param [in, out] system_info The system info structure.
+        /// @param [in] sections The SystemInfoSection flags selecting the sections to collect. Other sections are left unchanged.
+        /// kSystemInfoSectionProcessTable collects the processes into the process table instead of the process list.
+        /// @return true if the system info was collected, false if procfs is not available.
+        bool Collect(SystemInfo& system_info, uint32_t sections = kSystemInfoSectionAll);
+
+        /// @brief Discards the cached parts, so the next call to Collect reads them again, e.g. after a GPU was added.
+        void Reset();
+
+    private:
+        /// @brief Collects the parts of the system info that do not change while the system is running.
+        void CollectStatic();
+
+        /// @brief Reads the system memory sizes.
+        /// @param [out] memory The system memory info.
+        void CollectMemory(OsMemoryInfo& memory);
+
+        /// @brief Reads the running processes.
+        /// @param [in, out] system_info The system info structure. The previous processes are replaced.
+        /// @param [in] use_table True to fill the process table, false to fill the process list.
+        void CollectProcesses(SystemInfo& system_info, bool use_table);
+
+        SystemInfo  static_info_;       ///< The cached parts of the system info.
+        bool        static_collected_;  ///< True if static_info_ is valid.
+        int         proc_fd_;           ///< The /proc directory, or -1 if it is not open.
+        int         meminfo_fd_;        ///< The /proc/meminfo file, or -1 if it is not open.
+        std::string buffer_;            ///< The buffer files are read into.
+    };
+}  // namespace system_info_utils
+
+#endif
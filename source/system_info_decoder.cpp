@@ -0,0 +1,110 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief System info field decoder implementation
+//=============================================================================
+
+#include "system_info_decoder.h"
+
+#include <array>
+#include <charconv>
+#include <cstring>
+
+namespace
+{
+    constexpr uint8_t kInvalidHexDigit = 0xff;  ///< The hex digit table entry of characters that are not hex digits.
+
+    /// @brief Build the table of hex digit values.
+    /// @return The value of each hex digit character, kInvalidHexDigit for other characters.
+    constexpr std::array<uint8_t, 256> MakeHexDigitTable()
+    {
+        std::array<uint8_t, 256> table = {};
+        for (size_t i = 0; i < table.size(); ++i)
+        {
+            table[i] = kInvalidHexDigit;
+        }
+        for (uint8_t i = 0; i < 10; ++i)
+        {
+            table['0' + i] = i;
+        }
+        for (uint8_t i = 0; i < 6; ++i)
+        {
+            table['a' + i] = 10 + i;
+            table['A' + i] = 10 + i;
+        }
+        return table;
+    }
+
+    constexpr std::array<uint8_t, 256> kHexDigits = MakeHexDigitTable();  ///< The value of each hex digit character.
+
+    /// @brief Look up the value of a hex digit.
+    /// @param [in] c The character.
+    /// @return The value of the digit, or kInvalidHexDigit if the character is not a hex digit.
+    uint8_t HexDigit(char c)
+    {
+        return kHexDigits[static_cast<unsigned char>(c)];
+    }
+}  // namespace
+
+namespace system_info_utils
+{
+    bool SystemInfoDecoder::DecodeLuid(std::string_view text, uint8_t (&out_luid)[8])
+    {
+        memset(out_luid, 0, sizeof(out_luid));
+
+        if (text.size() > sizeof(out_luid) * 2)
+        {
+            return false;
+        }
+
+        uint8_t luid[8] = {};
+        for (size_t i = 0; i < text.size(); i += 2)
+        {
+            const uint8_t high = HexDigit(text[i]);
+            if (high == kInvalidHexDigit)
+            {
+                return false;
+            }
+
+            if (i + 1 == text.size())
+            {
+                luid[i / 2] = high;
+                break;
+            }
+
+            const uint8_t low = HexDigit(text[i + 1]);
+            if (low == kInvalidHexDigit)
+            {
+                return false;
+            }
+
+            luid[i / 2] = static_cast<uint8_t>((high << 4) | low);
+        }
+
+        memcpy(out_luid, luid, sizeof(out_luid));
+        return true;
+    }
+
+    bool SystemInfoDecoder::DecodePackagingVersion(std::string_view text, uint32_t& out_major, uint32_t& out_minor)
+    {
+        const char* const end = text.data() + text.size();
+
+        uint32_t                     major  = 0;
+        const std::from_chars_result result = std::from_chars(text.data(), end, major);
+        if ((result.ec != std::errc()) || (result.ptr == end) || (*result.ptr != '.'))
+        {
+            return false;
+        }
+
+        uint32_t minor = 0;
+        if (std::from_chars(result.ptr + 1, end, minor).ec != std::errc())
+        {
+            return false;
+        }
+
+        out_major = major;
+        out_minor = minor;
+        return true;
+    }
+}  // namespace system_info_utils
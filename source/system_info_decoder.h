@@ -0,0 +1,49 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief System info field decoder definition
+//=============================================================================
+
+#ifndef SYSTEM_INFO_UTILS_SOURCE_SYSTEM_INFO_DECODER_H_
+#define SYSTEM_INFO_UTILS_SOURCE_SYSTEM_INFO_DECODER_H_
+
+#include <cstdint>
+#include <string_view>
+
+namespace system_info_utils
+{
+    /// @brief Decodes the text encoded fields of the System Info chunk.
+    ///
+    /// The decoders do not allocate and never write past their outputs, so they can be
+    /// used on untrusted text at high rates.
+    class SystemInfoDecoder
+    {
+    public:
+        /// @brief Default constructor
+        SystemInfoDecoder() = delete;
+
+        /// @brief Default destructor
+        ~SystemInfoDecoder() = delete;
+
+        /// @brief Decode a LUID hex string into the LUID bytes.
+        ///
+        /// Every pair of hex digits is decoded into one byte, the first pair into the first byte.
+        /// A trailing single digit is decoded as the value of its byte. Bytes not covered by the
+        /// string are zero.
+        ///
+        /// @param [in] text The LUID hex string, e.g. "a1b2000000000000". At most 16 digits.
+        /// @param [out] out_luid The decoded LUID bytes. All zero if the string is not valid.
+        /// @return true if the string only contains hex digits and fits into the LUID, false otherwise.
+        static bool DecodeLuid(std::string_view text, uint8_t (&out_luid)[8]);
+
+        /// @brief Decode the major and minor version from a driver packaging version string.
+        /// @param [in] text The packaging version string, e.g. "23.20.16.01-230602a-393372C".
+        /// @param [out] out_major The major version. Not modified if the string is not valid.
+        /// @param [out] out_minor The minor version. Not modified if the string is not valid.
+        /// @return true if the string starts with "<major>.<minor>" and both fit into 32 bits, false otherwise.
+        static bool DecodePackagingVersion(std::string_view text, uint32_t& out_major, uint32_t& out_minor);
+    };
+}  // namespace system_info_utils
+
+#endif
@@ -0,0 +1,476 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief System info diff implementation
+//=============================================================================
+
+#include "system_info_diff.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <string_view>
+#include <utility>
+
+#include "definitions.h"
+#include "diff_matcher.h"
+#include "system_info_index.h"
+
+namespace
+{
+    using system_info_utils::DiffMatcher;
+    using system_info_utils::SystemInfoChange;
+    using system_info_utils::SystemInfoChangeType;
+
+    /// @brief The key GPUs are matched by.
+    struct GpuKey
+    {
+        uint32_t device;    ///< The PCI device ID.
+        uint32_t revision;  ///< The PCI revision ID.
+        uint64_t luid;      ///< The LUID, packed by SystemInfoIndex::PackLuid.
+
+        bool operator==(const GpuKey& other) const
+        {
+            return (device == other.device) && (revision == other.revision) && (luid == other.luid);
+        }
+    };
+
+    /// @brief Hash function for GPU keys.
+    struct GpuKeyHash
+    {
+        size_t operator()(const GpuKey& key) const
+        {
+            const uint64_t ids = (static_cast<uint64_t>(key.device) << 32) | key.revision;
+            return std::hash<uint64_t>()(ids ^ (key.luid * 0x9e3779b97f4a7c15ull));
+        }
+    };
+
+    /// @brief Get the key a GPU is matched by.
+    /// @param [in] gpu The GPU info.
+    /// @return The key.
+    GpuKey GetGpuKey(const system_info_utils::GpuInfo& gpu)
+    {
+        GpuKey key   = {};
+        key.device   = gpu.asic.id_info.device;
+        key.revision = gpu.asic.id_info.revision;
+        key.luid     = system_info_utils::SystemInfoIndex::PackLuid(gpu.asic.id_info.luid);
+        return key;
+    }
+
+    /// @brief Format the key a GPU is matched by, as "<device>:<revision>:<luid>" in hex.
+    /// @param [in] gpu The GPU info.
+    /// @return The key text.
+    std::string FormatGpuKey(const system_info_utils::GpuInfo& gpu)
+    {
+        const system_info_utils::IdInfo& id_info = gpu.asic.id_info;
+
+        char text[64];
+        int  length = snprintf(text, sizeof(text), "%" PRIx32 ":%" PRIx32 ":", id_info.device, id_info.revision);
+        for (uint8_t byte : id_info.luid)
+        {
+            length += snprintf(text + length, sizeof(text) - length, "%02" PRIx8, byte);
+        }
+
+        return std::string(text, length);
+    }
+
+    /// @brief Format a string field.
+    std::string ToText(const std::string& value)
+    {
+        return value;
+    }
+
+    /// @brief Format a boolean field.
+    std::string ToText(bool value)
+    {
+        return value ? "true" : "false";
+    }
+
+    /// @brief Format an integer field.
+    template <typename T>
+    std::string ToText(T value)
+    {
+        return std::to_string(value);
+    }
+
+    /// @brief Format a CU mask as nested JSON arrays.
+    /// @param [in] cu_mask The CU mask, by shader engine and then shader array.
+    /// @return The mask text, e.g. "[[255,255],[255,127]]".
+    std::string ToText(const system_info_utils::CuMask& cu_mask)
+    {
+        std::string text = "[";
+        for (size_t engine = 0; engine < cu_mask.size(); ++engine)
+        {
+            text += (engine == 0) ? "[" : ",[";
+            for (size_t array = 0; array < cu_mask[engine].size(); ++array)
+            {
+                if (array != 0)
+                {
+                    text += ',';
+                }
+                text += std::to_string(cu_mask[engine][array]);
+            }
+            text += ']';
+        }
+        text += ']';
+
+        return text;
+    }
+
+    /// @brief Builds the change list, tracking the path of the fields being compared.
+    class ChangeList
+    {
+    public:
+        /// @brief Constructor.
+        /// @param [in, out] changes The change list. Its previous contents are removed.
+        explicit ChangeList(std::vector<SystemInfoChange>& changes)
+            : changes_(changes)
+        {
+            changes_.clear();
+        }
+
+        /// @brief Enter a member of the current node.
+        /// @param [in] name The JSON key of the member.
+        /// @return The mark to pass to Leave.
+        size_t Enter(std::string_view name)
+        {
+            const size_t mark = path_.size();
+            if (!path_.empty())
+            {
+                path_ += '.';
+            }
+            path_ += name;
+            return mark;
+        }
+
+        /// @brief Enter an element of the current list.
+        /// @param [in] key The key the element is matched by.
+        /// @return The mark to pass to Leave.
+        size_t EnterElement(std::string_view key)
+        {
+            const size_t mark = path_.size();
+            path_ += '[';
+            path_ += key;
+            path_ += ']';
+            return mark;
+        }
+
+        /// @brief Return to the node that was current before Enter or EnterElement.
+        /// @param [in] mark The mark returned by Enter or EnterElement.
+        void Leave(size_t mark)
+        {
+            path_.resize(mark);
+        }
+
+        /// @brief Add a change at the current path.
+        /// @param [in] type The kind of change.
+        /// @param [in] old_value The old value text.
+        /// @param [in] new_value The new value text.
+        void Add(SystemInfoChangeType type, std::string old_value, std::string new_value)
+        {
+            changes_.push_back({type, path_, std::move(old_value), std::move(new_value)});
+        }
+
+        /// @brief Compare a member of the current node, adding a change if the values differ.
+        /// @param [in] name The JSON key of the member.
+        /// @param [in] old_value The old value.
+        /// @param [in] new_value The new value.
+        template <typename T>
+        void Compare(std::string_view name, const T& old_value, const T& new_value)
+        {
+            if (!(old_value == new_value))
+            {
+                const size_t mark = Enter(name);
+                Add(SystemInfoChangeType::kModified, ToText(old_value), ToText(new_value));
+                Leave(mark);
+            }
+        }
+
+    private:
+        std::vector<SystemInfoChange>& changes_;  ///< The change list.
+        std::string                    path_;     ///< The path of the current node.
+    };
+
+    /// @brief Compare two lists, pairing their elements by key.
+    ///
+    /// Matched elements are compared in the order of the new list, followed by the elements only present in the old list.
+    ///
+    /// @param [in, out] changes The change list, positioned at the list node.
+    /// @param [in, out] matcher The matcher used to pair the elements.
+    /// @param [in] old_list The old list.
+    /// @param [in] new_list The new list.
+    /// @param [in] key_of A function returning the key of an element.
+    /// @param [in] format_key A function returning the key text of an element.
+    /// @param [in] name_of A function returning the name reported when an element is added or removed.
+    /// @param [in] compare A function comparing two matched elements.
+    template <typename T, typename Key, typename Hash, typename KeyOf, typename FormatKey, typename NameOf, typename Compare>
+    void CompareList(ChangeList&             changes,
+                     DiffMatcher<Key, Hash>& matcher,
+                     const std::vector<T>&   old_list,
+                     const std::vector<T>&   new_list,
+                     KeyOf                   key_of,
+                     FormatKey               format_key,
+                     NameOf                  name_of,
+                     Compare                 compare)
+    {
+        matcher.Index(old_list.size(), [&](size_t i) { return key_of(old_list[i]); });
+
+        for (const T& new_element : new_list)
+        {
+            const size_t old_index = matcher.Match(key_of(new_element));
+            const size_t mark      = changes.EnterElement(format_key(new_element));
+
+            if (old_index == DiffMatcher<Key, Hash>::kNone)
+            {
+                changes.Add(SystemInfoChangeType::kAdded, std::string(), name_of(new_element));
+            }
+            else
+            {
+                compare(old_list[old_index], new_element);
+            }
+
+            changes.Leave(mark);
+        }
+
+        for (size_t i = 0; i < old_list.size(); ++i)
+        {
+            if (!matcher.IsMatched(i))
+            {
+                const size_t mark = changes.EnterElement(format_key(old_list[i]));
+                changes.Add(SystemInfoChangeType::kRemoved, name_of(old_list[i]), std::string());
+                changes.Leave(mark);
+            }
+        }
+    }
+
+    /// @brief Compare two clock ranges.
+    void CompareClock(ChangeList& changes, std::string_view name, const system_info_utils::ClockInfo& old_clock, const system_info_utils::ClockInfo& new_clock)
+    {
+        const size_t mark = changes.Enter(name);
+        changes.Compare(kNodeStringMin, old_clock.min, new_clock.min);
+        changes.Compare(kNodeStringMax, old_clock.max, new_clock.max);
+        changes.Leave(mark);
+    }
+
+    /// @brief Compare the info of two matched CPUs.
+    void CompareCpu(ChangeList& changes, const system_info_utils::CpuInfo& old_cpu, const system_info_utils::CpuInfo& new_cpu)
+    {
+        changes.Compare(kNodeStringName, old_cpu.name, new_cpu.name);
+        changes.Compare(kNodeStringCpuId, old_cpu.cpu_id, new_cpu.cpu_id);
+        changes.Compare(kNodeStringArchitecture, old_cpu.architecture, new_cpu.architecture);
+        changes.Compare(kNodeStringCpuVendorId, old_cpu.vendor_id, new_cpu.vendor_id);
+        changes.Compare(kNodeStringVirtualization, old_cpu.virtualization, new_cpu.virtualization);
+        changes.Compare(kNodeStringCpuPhysicalCoreCount, old_cpu.num_physical_cores, new_cpu.num_physical_cores);
+        changes.Compare(kNodeStringCpuLogicalCoreCount, old_cpu.num_logical_cores, new_cpu.num_logical_cores);
+
+        const size_t mark = changes.Enter(kNodeStringSpeed);
+        changes.Compare(kNodeStringMax, old_cpu.max_clock_speed, new_cpu.max_clock_speed);
+        changes.Leave(mark);
+
+        changes.Compare(kNodeStringCpuTimeClockFreq, old_cpu.timestamp_clock_frequency, new_cpu.timestamp_clock_frequency);
+    }
+
+    /// @brief Compare the memory info of two matched GPUs.
+    void CompareGpuMemory(ChangeList&                          changes,
+                          DiffMatcher<std::string_view>&       heap_matcher,
+                          const system_info_utils::MemoryInfo& old_memory,
+                          const system_info_utils::MemoryInfo& new_memory)
+    {
+        const size_t mark = changes.Enter(kNodeStringMemory);
+
+        changes.Compare(kNodeStringType, old_memory.type, new_memory.type);
+        changes.Compare(kNodeStringMemoryOpsPerClock, old_memory.mem_ops_per_clock, new_memory.mem_ops_per_clock);
+        changes.Compare(kNodeStringMemoryBusBitWidth, old_memory.bus_bit_width, new_memory.bus_bit_width);
+        changes.Compare(kNodeStringMemoryBandwith, old_memory.bandwidth, new_memory.bandwidth);
+        CompareClock(changes, kNodeStringMemoryClockSpeed, old_memory.mem_clock_hz, new_memory.mem_clock_hz);
+
+        // Heaps are keyed by their type.
+        const size_t heaps_mark = changes.Enter(kNodeStringHeaps);
+        CompareList(
+            changes,
+            heap_matcher,
+            old_memory.heaps,
+            new_memory.heaps,
+            [](const system_info_utils::HeapInfo& heap) { return std::string_view(heap.heap_type); },
+            [](const system_info_utils::HeapInfo& heap) { return std::string_view(heap.heap_type); },
+            [](const system_info_utils::HeapInfo& heap) { return heap.heap_type; },
+            [&](const system_info_utils::HeapInfo& old_heap, const system_info_utils::HeapInfo& new_heap) {
+                changes.Compare(kNodeStringPhysicalAddress, old_heap.phys_addr, new_heap.phys_addr);
+                changes.Compare(kNodeStringSize, old_heap.size, new_heap.size);
+            });
+        changes.Leave(heaps_mark);
+
+        // Excluded ranges have no key, so they are compared by position.
+        const size_t ranges_mark = changes.Enter(kNodeStringExcludedVaRanges);
+        const size_t range_count = std::max(old_memory.excluded_va_ranges.size(), new_memory.excluded_va_ranges.size());
+        for (size_t i = 0; i < range_count; ++i)
+        {
+            const size_t range_mark = changes.EnterElement(std::to_string(i));
+
+            if (i >= old_memory.excluded_va_ranges.size())
+            {
+                changes.Add(SystemInfoChangeType::kAdded, std::string(), std::string());
+            }
+            else if (i >= new_memory.excluded_va_ranges.size())
+            {
+                changes.Add(SystemInfoChangeType::kRemoved, std::string(), std::string());
+            }
+            else
+            {
+                const system_info_utils::ExcludedRangeInfo& old_range = old_memory.excluded_va_ranges[i];
+                const system_info_utils::ExcludedRangeInfo& new_range = new_memory.excluded_va_ranges[i];
+                changes.Compare(kNodeStringBase, old_range.base, new_range.base);
+                changes.Compare(kNodeStringSize, old_range.size, new_range.size);
+            }
+
+            changes.Leave(range_mark);
+        }
+        changes.Leave(ranges_mark);
+
+        changes.Leave(mark);
+    }
+
+    /// @brief Compare the info of two matched GPUs.
+    void CompareGpu(ChangeList&                       changes,
+                    DiffMatcher<std::string_view>&    heap_matcher,
+                    const system_info_utils::GpuInfo& old_gpu,
+                    const system_info_utils::GpuInfo& new_gpu)
+    {
+        changes.Compare(kNodeStringName, old_gpu.name, new_gpu.name);
+
+        size_t mark = changes.Enter(kNodeStringPci);
+        changes.Compare(kNodeStringPciBus, old_gpu.pci.bus, new_gpu.pci.bus);
+        changes.Compare(kNodeStringDevice, old_gpu.pci.device, new_gpu.pci.device);
+        changes.Compare(kNodeStringPciFunction, old_gpu.pci.function, new_gpu.pci.function);
+        changes.Leave(mark);
+
+        const system_info_utils::AsicInfo& old_asic = old_gpu.asic;
+        const system_info_utils::AsicInfo& new_asic = new_gpu.asic;
+
+        mark = changes.Enter(kNodeStringAsic);
+        changes.Compare(kNodeStringAsicGpuIndex, old_asic.gpu_index, new_asic.gpu_index);
+        changes.Compare(kNodeStringAsicGpuCounterFrequency, old_asic.gpu_counter_freq, new_asic.gpu_counter_freq);
+        CompareClock(changes, kNodeStringAsicEngineClockSpeed, old_asic.engine_clock_hz, new_asic.engine_clock_hz);
+        changes.Compare(kNodeStringAsicNumSe, old_asic.num_shader_engines, new_asic.num_shader_engines);
+        changes.Compare(kNodeStringAsicNumSaPerSe, old_asic.num_shader_arrays_per_engine, new_asic.num_shader_arrays_per_engine);
+        changes.Compare(kNodeStringAsicCuMask, old_asic.cu_mask, new_asic.cu_mask);
+        changes.Compare(kNodeStringAsicNumCus, old_asic.num_cus, new_asic.num_cus);
+
+        // The device ID, revision ID and LUID are equal, since the GPUs are matched by them.
+        const size_t ids_mark = changes.Enter(kNodeStringAsicIds);
+        changes.Compare(kNodeStringAsicGfxEngine, old_asic.id_info.gfx_engine, new_asic.id_info.gfx_engine);
+        changes.Compare(kNodeStringAsicFamily, old_asic.id_info.family, new_asic.id_info.family);
+        changes.Compare(kNodeStringAsicERev, old_asic.id_info.e_rev, new_asic.id_info.e_rev);
+        changes.Compare(kNodeStringAsicSubsystem, old_asic.id_info.subsystem, new_asic.id_info.subsystem);
+        changes.Compare(kNodeStringAsicVendor, old_asic.id_info.vendor, new_asic.id_info.vendor);
+        changes.Leave(ids_mark);
+        changes.Leave(mark);
+
+        CompareGpuMemory(changes, heap_matcher, old_gpu.memory, new_gpu.memory);
+
+        mark = changes.Enter(kNodeStringBigSw);
+        changes.Compare(kNodeStringMajor, old_gpu.big_sw.major, new_gpu.big_sw.major);
+        changes.Compare(kNodeStringMinor, old_gpu.big_sw.minor, new_gpu.big_sw.minor);
+        changes.Compare(kNodeStringMisc, old_gpu.big_sw.misc, new_gpu.big_sw.misc);
+        changes.Leave(mark);
+    }
+}  // namespace
+
+namespace system_info_utils
+{
+    void SystemInfoDiff::Diff(const SystemInfo& old_info, const SystemInfo& new_info, std::vector<SystemInfoChange>& out_changes)
+    {
+        ChangeList changes(out_changes);
+
+        size_t mark = changes.Enter(kNodeStringVersion);
+        changes.Compare(kNodeStringMajor, old_info.version.major, new_info.version.major);
+        changes.Compare(kNodeStringMinor, old_info.version.minor, new_info.version.minor);
+        changes.Compare(kNodeStringPatch, old_info.version.patch, new_info.version.patch);
+        changes.Compare(kNodeStringBuild, old_info.version.build, new_info.version.build);
+        changes.Leave(mark);
+
+        mark = changes.Enter(kNodeStringDriver);
+        changes.Compare(kNodeStringName, old_info.driver.name, new_info.driver.name);
+        changes.Compare(kNodeStringDescription, old_info.driver.description, new_info.driver.description);
+        changes.Compare(kNodeStringDriverPackagingVersion, old_info.driver.packaging_version, new_info.driver.packaging_version);
+        changes.Compare(kNodeStringDriverSoftwareVersion, old_info.driver.software_version, new_info.driver.software_version);
+        changes.Compare(kNodeStringIsClosedSource, old_info.driver.is_closed_source, new_info.driver.is_closed_source);
+        changes.Leave(mark);
+
+        mark                = changes.Enter(kNodeStringDevDriver);
+        size_t version_mark = changes.Enter(kNodeStringVersion);
+        changes.Compare(kNodeStringMajor, old_info.devdriver.major_version, new_info.devdriver.major_version);
+        changes.Leave(version_mark);
+        changes.Compare(kNodeStringTag, old_info.devdriver.tag, new_info.devdriver.tag);
+        changes.Leave(mark);
+
+        const OsInfo& old_os = old_info.os;
+        const OsInfo& new_os = new_info.os;
+
+        mark = changes.Enter(kNodeStringOs);
+        changes.Compare(kNodeStringName, old_os.name, new_os.name);
+        changes.Compare(kNodeStringDescription, old_os.desc, new_os.desc);
+        changes.Compare(kNodeStringHostName, old_os.hostname, new_os.hostname);
+
+        size_t child_mark = changes.Enter(kNodeStringMemory);
+        changes.Compare(kNodeStringMemoryPhysical, old_os.memory.physical, new_os.memory.physical);
+        changes.Compare(kNodeStringMemorySwap, old_os.memory.swap, new_os.memory.swap);
+        changes.Compare(kNodeStringName, old_os.memory.type, new_os.memory.type);
+        changes.Leave(child_mark);
+
+        child_mark           = changes.Enter(kNodeStringConfig);
+        size_t platform_mark = changes.Enter(kNodeStringLinux);
+        changes.Compare(kNodeStringPowerDpmWritable, old_os.config.power_dpm_writable, new_os.config.power_dpm_writable);
+        size_t drm_mark = changes.Enter(kNodeStringDrm);
+        changes.Compare(kNodeStringMajor, old_os.config.drm_major_version, new_os.config.drm_major_version);
+        changes.Compare(kNodeStringMinor, old_os.config.drm_minor_version, new_os.config.drm_minor_version);
+        changes.Leave(drm_mark);
+        changes.Leave(platform_mark);
+
+        const EtwSupportInfo& old_etw = old_os.config.etw_support_info;
+        const EtwSupportInfo& new_etw = new_os.config.etw_support_info;
+
+        platform_mark   = changes.Enter(kNodeStringWindows);
+        size_t etw_mark = changes.Enter(kNodeStringEtwSupport);
+        changes.Compare(kNodeStringSupported, old_etw.is_supported, new_etw.is_supported);
+        changes.Compare(kNodeStringHasPermission, old_etw.has_permission, new_etw.has_permission);
+        changes.Compare(kNodeStringStatusCode, old_etw.status_code, new_etw.status_code);
+        changes.Compare(kNodeStringEtwRegistryOrUserGroup, old_etw.needs_rgp_registry_or_usergroup, new_etw.needs_rgp_registry_or_usergroup);
+        changes.Leave(etw_mark);
+        changes.Leave(platform_mark);
+        changes.Leave(child_mark);
+        changes.Leave(mark);
+
+        DiffMatcher<std::string_view> cpu_matcher;
+        DiffMatcher<std::string_view> heap_matcher;
+
+        // CPUs are keyed by their slot identifier.
+        mark = changes.Enter(kNodeStringCpus);
+        CompareList(
+            changes,
+            cpu_matcher,
+            old_info.cpus,
+            new_info.cpus,
+            [](const CpuInfo& cpu) { return std::string_view(cpu.device_id); },
+            [](const CpuInfo& cpu) { return std::string_view(cpu.device_id); },
+            [](const CpuInfo& cpu) { return cpu.name; },
+            [&](const CpuInfo& old_cpu, const CpuInfo& new_cpu) { CompareCpu(changes, old_cpu, new_cpu); });
+        changes.Leave(mark);
+
+        // GPUs are keyed by their identification info, since the PCI location and index can change between boots.
+        DiffMatcher<GpuKey, GpuKeyHash> gpu_matcher;
+
+        mark = changes.Enter(kNodeStringGpus);
+        CompareList(
+            changes,
+            gpu_matcher,
+            old_info.gpus,
+            new_info.gpus,
+            GetGpuKey,
+            FormatGpuKey,
+            [](const GpuInfo& gpu) { return gpu.name; },
+            [&](const GpuInfo& old_gpu, const GpuInfo& new_gpu) { CompareGpu(changes, heap_matcher, old_gpu, new_gpu); });
+        changes.Leave(mark);
+    }
+}  // namespace system_info_utils
@@ -0,0 +1,68 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief System info diff definition
+//=============================================================================
+
+#ifndef SYSTEM_INFO_UTILS_SOURCE_SYSTEM_INFO_DIFF_H_
+#define SYSTEM_INFO_UTILS_SOURCE_SYSTEM_INFO_DIFF_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "system_info_reader.h"
+
+namespace system_info_utils
+{
+    /// @brief The kind of a change between two captures.
+    enum class SystemInfoChangeType : uint8_t
+    {
+        kAdded,    ///< The element only exists in the new capture.
+        kRemoved,  ///< The element only exists in the old capture.
+        kModified  ///< The field has a different value in each capture.
+    };
+
+    /// @brief A change between two system info captures.
+    struct SystemInfoChange
+    {
+        SystemInfoChangeType type;  ///< The kind of change.
+
+        /// @brief The location of the field or element, using the JSON key names.
+        ///
+        /// List elements are identified by their match key in brackets rather than by
+        /// their position, e.g. "gpus[73bf:c1:0000a1b200000000].memory.bandwidthBytesPerSec"
+        /// for the GPU with device ID 0x73bf, revision 0xc1 and the given LUID, or
+        /// "cpus[CPU0].speed.max" for the CPU in slot CPU0.
+        std::string path;
+
+        std::string old_value;  ///< The old value as text. The element name for added and removed elements.
+        std::string new_value;  ///< The new value as text. The element name for added and removed elements.
+    };
+
+    /// @brief Compares system info captures.
+    class SystemInfoDiff
+    {
+    public:
+        /// @brief Default constructor
+        SystemInfoDiff() = delete;
+
+        /// @brief Default destructor
+        ~SystemInfoDiff() = delete;
+
+        /// @brief Lists the fields that differ between two captures.
+        ///
+        /// GPUs are matched by their device ID, revision ID and LUID, CPUs by their slot
+        /// identifier and GPU heaps by their type, so reordered lists are not reported.
+        /// The process list is not compared, since it changes between every capture.
+        ///
+        /// @param [in] old_info The old capture, e.g. from before a driver update.
+        /// @param [in] new_info The new capture.
+        /// @param [in, out] out_changes The changes, in the order of the fields in the new capture, with removed elements after the
+        /// other elements of their list. Its previous contents are replaced.
+        static void Diff(const SystemInfo& old_info, const SystemInfo& new_info, std::vector<SystemInfoChange>& out_changes);
+    };
+}  // namespace system_info_utils
+
+#endif
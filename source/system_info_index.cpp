@@ -0,0 +1,88 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief System info index implementation
+//=============================================================================
+
+#include "system_info_index.h"
+
+namespace system_info_utils
+{
+    SystemInfoIndex::SystemInfoIndex(const SystemInfo& system_info)
+    {
+        Build(system_info);
+    }
+
+    void SystemInfoIndex::Build(const SystemInfo& system_info)
+    {
+        const std::vector<GpuInfo>& gpus = system_info.gpus;
+
+        system_info_ = &system_info;
+        gpus_by_index_.clear();
+        gpus_by_pci_.clear();
+        gpus_by_luid_.clear();
+        gpus_by_index_.reserve(gpus.size());
+        gpus_by_pci_.reserve(gpus.size());
+        gpus_by_luid_.reserve(gpus.size());
+
+        for (size_t i = 0; i < gpus.size(); ++i)
+        {
+            const GpuInfo& gpu = gpus[i];
+
+            // The first GPU with a key is kept.
+            gpus_by_index_.emplace(gpu.asic.gpu_index, i);
+            gpus_by_pci_.emplace(PackPciAddress(gpu.pci.bus, gpu.pci.device, gpu.pci.function), i);
+
+            // The LUID is not reported on every platform.
+            const uint64_t luid = PackLuid(gpu.asic.id_info.luid);
+            if (luid != 0)
+            {
+                gpus_by_luid_.emplace(luid, i);
+            }
+        }
+    }
+
+    const GpuInfo* SystemInfoIndex::FindGpuByIndex(uint32_t gpu_index) const
+    {
+        return Find(gpus_by_index_, gpu_index);
+    }
+
+    const GpuInfo* SystemInfoIndex::FindGpuByPci(uint32_t bus, uint32_t device, uint32_t function) const
+    {
+        return Find(gpus_by_pci_, PackPciAddress(bus, device, function));
+    }
+
+    const GpuInfo* SystemInfoIndex::FindGpuByLuid(uint64_t luid) const
+    {
+        return Find(gpus_by_luid_, luid);
+    }
+
+    uint64_t SystemInfoIndex::PackLuid(const uint8_t (&luid)[8])
+    {
+        uint64_t result = 0;
+        for (size_t i = 0; i < sizeof(luid); ++i)
+        {
+            result |= static_cast<uint64_t>(luid[i]) << (i * 8);
+        }
+
+        return result;
+    }
+
+    uint64_t SystemInfoIndex::PackPciAddress(uint32_t bus, uint32_t device, uint32_t function)
+    {
+        return (static_cast<uint64_t>(bus) << 32) | (static_cast<uint64_t>(device & 0xffff) << 16) | (function & 0xffff);
+    }
+
+    template <typename Key>
+    const GpuInfo* SystemInfoIndex::Find(const std::unordered_map<Key, size_t>& map, Key key) const
+    {
+        auto iter = map.find(key);
+        if (iter == map.end())
+        {
+            return nullptr;
+        }
+
+        return &system_info_->gpus[iter->second];
+    }
+}  // namespace system_info_utils
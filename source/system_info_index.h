@@ -0,0 +1,83 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief System info index definition
+//=============================================================================
+
+#ifndef SYSTEM_INFO_UTILS_SOURCE_SYSTEM_INFO_INDEX_H_
+#define SYSTEM_INFO_UTILS_SOURCE_SYSTEM_INFO_INDEX_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+
+#include "system_info_reader.h"
+
+namespace system_info_utils
+{
+    /// @brief Indexes the GPUs of a parsed system info structure for constant time lookup.
+    ///
+    /// Build the index once after parsing, rather than scanning the GPU list for every
+    /// event that needs to be correlated with a GPU. The index refers to the GPUs of the
+    /// system info structure, so it must be rebuilt if the GPU list changes. When several
+    /// GPUs have the same key the first one is returned.
+    class SystemInfoIndex
+    {
+    public:
+        /// @brief Constructor for an empty index.
+        SystemInfoIndex() = default;
+
+        /// @brief Constructor.
+        /// @param [in] system_info The system info structure to index. Must outlive the index.
+        explicit SystemInfoIndex(const SystemInfo& system_info);
+
+        /// @brief Index a system info structure, replacing the previous contents of the index.
+        /// @param [in] system_info The system info structure to index. Must outlive the index.
+        void Build(const SystemInfo& system_info);
+
+        /// @brief Find a GPU by the index it was enumerated with.
+        /// @param [in] gpu_index The AsicInfo::gpu_index of the GPU.
+        /// @return The GPU, or nullptr if there is no such GPU.
+        const GpuInfo* FindGpuByIndex(uint32_t gpu_index) const;
+
+        /// @brief Find a GPU by its PCI location.
+        /// @param [in] bus The PCI bus number.
+        /// @param [in] device The PCI device number.
+        /// @param [in] function The PCI function number.
+        /// @return The GPU, or nullptr if there is no such GPU.
+        const GpuInfo* FindGpuByPci(uint32_t bus, uint32_t device, uint32_t function) const;
+
+        /// @brief Find a GPU by its locally unique identifier.
+        /// @param [in] luid The LUID packed by PackLuid. GPUs with a zero LUID are not indexed.
+        /// @return The GPU, or nullptr if there is no such GPU.
+        const GpuInfo* FindGpuByLuid(uint64_t luid) const;
+
+        /// @brief Pack LUID bytes into an integer key.
+        /// @param [in] luid The IdInfo::luid bytes, the first byte being the least significant.
+        /// @return The packed LUID.
+        static uint64_t PackLuid(const uint8_t (&luid)[8]);
+
+        /// @brief Pack a PCI location into an integer key.
+        /// @param [in] bus The PCI bus number.
+        /// @param [in] device The PCI device number. Only the low 16 bits are used.
+        /// @param [in] function The PCI function number. Only the low 16 bits are used.
+        /// @return The packed PCI location.
+        static uint64_t PackPciAddress(uint32_t bus, uint32_t device, uint32_t function);
+
+    private:
+        /// @brief Get the GPU at an index in the GPU list.
+        /// @param [in] map The map from a key to the GPU list index.
+        /// @param [in] key The key.
+        /// @return The GPU, or nullptr if the key is not in the map.
+        template <typename Key>
+        const GpuInfo* Find(const std::unordered_map<Key, size_t>& map, Key key) const;
+
+        const SystemInfo*                    system_info_ = nullptr;  ///< The indexed system info structure.
+        std::unordered_map<uint32_t, size_t> gpus_by_index_;          ///< The GPU list index of each gpu_index.
+        std::unordered_map<uint64_t, size_t> gpus_by_pci_;            ///< The GPU list index of each packed PCI location.
+        std::unordered_map<uint64_t, size_t> gpus_by_luid_;           ///< The GPU list index of each packed LUID.
+    };
+}  // namespace system_info_utils
+
+#endif
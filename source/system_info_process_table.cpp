@@ -0,0 +1,156 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Process table implementation
+//=============================================================================
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+
+#include "system_info_reader.h"
+
+namespace
+{
+    constexpr size_t kMinSlotCount = 64;  ///< The number of hash slots allocated by the first string.
+}  // namespace
+
+namespace system_info_utils
+{
+    void ProcessTable::Reserve(size_t count, size_t string_bytes)
+    {
+        records_.reserve(count);
+        data_.reserve(string_bytes);
+    }
+
+    void ProcessTable::Clear()
+    {
+        records_.clear();
+        data_.clear();
+        strings_.clear();
+        std::fill(slots_.begin(), slots_.end(), 0);
+    }
+
+    bool ProcessTable::Add(std::string_view name, std::string_view path, uint32_t id)
+    {
+        Record record = {};
+        if (!MakeRecord(name, path, id, record))
+        {
+            return false;
+        }
+
+        records_.push_back(record);
+        return true;
+    }
+
+    bool ProcessTable::Assign(size_t index, std::string_view name, std::string_view path, uint32_t id)
+    {
+        return MakeRecord(name, path, id, records_[index]);
+    }
+
+    void ProcessTable::Truncate(size_t count)
+    {
+        if (count < records_.size())
+        {
+            records_.resize(count);
+        }
+    }
+
+    std::vector<Process> ProcessTable::ToVector() const
+    {
+        std::vector<Process> result;
+        result.reserve(size());
+        for (const ProcessView& process : *this)
+        {
+            result.push_back(Process{std::string(process.name), std::string(process.path), process.id});
+        }
+        return result;
+    }
+
+    bool ProcessTable::MakeRecord(std::string_view name, std::string_view path, uint32_t id, Record& out_record)
+    {
+        StringRange path_range = {};
+        if (!Intern(path, path_range))
+        {
+            return false;
+        }
+
+        // Names are usually the file name of the executable, which is already stored at the end of the path.
+        StringRange name_range = {};
+        if ((name.size() <= path.size()) && (path.substr(path.size() - name.size()) == name))
+        {
+            name_range.offset = path_range.offset + path_range.size - static_cast<uint32_t>(name.size());
+            name_range.size   = static_cast<uint32_t>(name.size());
+        }
+        else if (!Intern(name, name_range))
+        {
+            return false;
+        }
+
+        out_record.name = name_range;
+        out_record.path = path_range;
+        out_record.id   = id;
+
+        return true;
+    }
+
+    bool ProcessTable::Intern(std::string_view value, StringRange& out_range)
+    {
+        if (value.empty())
+        {
+            out_range = StringRange{0, 0};
+            return true;
+        }
+
+        if ((strings_.size() + 1) * 2 > slots_.size())
+        {
+            Grow();
+        }
+
+        // Linear probing in a table that is at most half full.
+        const size_t hash = std::hash<std::string_view>()(value);
+        const size_t mask = slots_.size() - 1;
+        size_t       slot = hash & mask;
+        for (; slots_[slot] != 0; slot = (slot + 1) & mask)
+        {
+            const InternedString& string = strings_[slots_[slot] - 1];
+            if ((string.hash == hash) && (GetString(string.range) == value))
+            {
+                out_range = string.range;
+                return true;
+            }
+        }
+
+        if ((data_.size() + value.size()) > UINT32_MAX)
+        {
+            return false;
+        }
+
+        out_range.offset = static_cast<uint32_t>(data_.size());
+        out_range.size   = static_cast<uint32_t>(value.size());
+
+        data_.insert(data_.end(), value.begin(), value.end());
+        strings_.push_back(InternedString{out_range, hash});
+        slots_[slot] = static_cast<uint32_t>(strings_.size());
+
+        return true;
+    }
+
+    void ProcessTable::Grow()
+    {
+        const size_t slot_count = std::max(kMinSlotCount, slots_.size() * 2);
+        const size_t mask       = slot_count - 1;
+
+        slots_.assign(slot_count, 0);
+        for (size_t i = 0; i < strings_.size(); ++i)
+        {
+            size_t slot = strings_[i].hash & mask;
+            while (slots_[slot] != 0)
+            {
+                slot = (slot + 1) & mask;
+            }
+            slots_[slot] = static_cast<uint32_t>(i + 1);
+        }
+    }
+}  // namespace system_info_utils
@@ -8,8 +8,11 @@
 #ifndef SYSTEM_INFO_UTILS_SOURCE_SYSTEM_INFO_READER_H_
 #define SYSTEM_INFO_UTILS_SOURCE_SYSTEM_INFO_READER_H_
 
+#include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #ifdef SYSTEM_INFO_ENABLE_RDF
@@ -113,6 +116,254 @@ namespace system_info_utils
         uint8_t  luid[8];     ///< The locally unique identifier for the adapter.
     };
 
+    /// @brief The mask that describes the active CUs on a GPU, with one bit per CU.
+    ///
+    /// The shader array masks of all shader engines are stored in a single array, ordered by
+    /// shader engine index first and then the shader array within the engine. Shader engines
+    /// do not need to have the same number of shader arrays.
+    class CuMask
+    {
+    public:
+        /// @brief A read-only view of the shader array masks of one shader engine.
+        class ShaderEngine
+        {
+        public:
+            /// @brief Constructor.
+            /// @param [in] masks The first shader array mask of the shader engine.
+            /// @param [in] count The number of shader arrays in the shader engine.
+            ShaderEngine(const uint32_t* masks, size_t count)
+                : masks_(masks)
+                , count_(count)
+            {
+            }
+
+            /// @brief Get the number of shader arrays in the shader engine.
+            size_t size() const
+            {
+                return count_;
+            }
+
+            /// @brief Check if the shader engine has no shader arrays.
+            bool empty() const
+            {
+                return count_ == 0;
+            }
+
+            /// @brief Get the mask of a shader array.
+            /// @param [in] shader_array The shader array index within the engine.
+            uint32_t operator[](size_t shader_array) const
+            {
+                return masks_[shader_array];
+            }
+
+            /// @brief Get the first shader array mask.
+            const uint32_t* begin() const
+            {
+                return masks_;
+            }
+
+            /// @brief Get the end of the shader array masks.
+            const uint32_t* end() const
+            {
+                return masks_ + count_;
+            }
+
+        private:
+            const uint32_t* masks_;  ///< The first shader array mask of the shader engine.
+            size_t          count_;  ///< The number of shader arrays in the shader engine.
+        };
+
+        /// @brief Iterates over the shader engines.
+        class Iterator
+        {
+        public:
+            /// @brief Constructor.
+            /// @param [in] cu_mask The CU mask.
+            /// @param [in] shader_engine The shader engine index.
+            Iterator(const CuMask* cu_mask, size_t shader_engine)
+                : cu_mask_(cu_mask)
+                , shader_engine_(shader_engine)
+                , engine_(nullptr, 0)
+            {
+            }
+
+            /// @brief Get the current shader engine.
+            /// @return A view that stays valid until the iterator is incremented, so rows can be bound to references.
+            const ShaderEngine& operator*() const
+            {
+                engine_ = (*cu_mask_)[shader_engine_];
+                return engine_;
+            }
+
+            Iterator& operator++()
+            {
+                ++shader_engine_;
+                return *this;
+            }
+
+            bool operator==(const Iterator& other) const
+            {
+                return shader_engine_ == other.shader_engine_;
+            }
+
+            bool operator!=(const Iterator& other) const
+            {
+                return shader_engine_ != other.shader_engine_;
+            }
+
+        private:
+            const CuMask*        cu_mask_;        ///< The CU mask.
+            size_t               shader_engine_;  ///< The shader engine index.
+            mutable ShaderEngine engine_;         ///< The view returned by the last dereference.
+        };
+
+        /// @brief Get the number of shader engines.
+        size_t size() const
+        {
+            return engine_offsets_.size();
+        }
+
+        /// @brief Check if the mask has no shader engines.
+        bool empty() const
+        {
+            return engine_offsets_.empty();
+        }
+
+        /// @brief Get the shader array masks of a shader engine.
+        /// @param [in] shader_engine The shader engine index.
+        ShaderEngine operator[](size_t shader_engine) const
+        {
+            const uint32_t first = engine_offsets_[shader_engine];
+            const uint32_t last  = (shader_engine + 1 < engine_offsets_.size()) ? engine_offsets_[shader_engine + 1] : static_cast<uint32_t>(masks_.size());
+            return ShaderEngine(masks_.data() + first, last - first);
+        }
+
+        /// @brief Get the first shader engine.
+        Iterator begin() const
+        {
+            return Iterator(this, 0);
+        }
+
+        /// @brief Get the end of the shader engines.
+        Iterator end() const
+        {
+            return Iterator(this, engine_offsets_.size());
+        }
+
+        /// @brief Get the shader array masks of all shader engines, in shader engine order.
+        const std::vector<uint32_t>& Masks() const
+        {
+            return masks_;
+        }
+
+        /// @brief Count the active CUs on the GPU.
+        /// @return The number of set bits in all shader array masks.
+        uint32_t ActiveCuCount() const
+        {
+            return CountBits(masks_.data(), masks_.size());
+        }
+
+        /// @brief Count the active CUs in a shader engine.
+        /// @param [in] shader_engine The shader engine index.
+        /// @return The number of set bits in the shader array masks of the shader engine.
+        uint32_t ActiveCuCount(size_t shader_engine) const
+        {
+            const ShaderEngine engine = (*this)[shader_engine];
+            return CountBits(engine.begin(), engine.size());
+        }
+
+        /// @brief Count the active CUs in a shader array.
+        /// @param [in] shader_engine The shader engine index.
+        /// @param [in] shader_array The shader array index within the engine.
+        /// @return The number of set bits in the shader array mask.
+        uint32_t ActiveCuCount(size_t shader_engine, size_t shader_array) const
+        {
+            return CountBits((*this)[shader_engine][shader_array]);
+        }
+
+        /// @brief Check if the mask agrees with the reported number of compute units.
+        /// @param [in] num_cus The number of compute units on the GPU.
+        /// @return true if the mask has exactly num_cus set bits, false otherwise.
+        bool IsConsistent(uint32_t num_cus) const
+        {
+            return ActiveCuCount() == num_cus;
+        }
+
+        /// @brief Copy the mask into a list of shader array masks per shader engine.
+        std::vector<std::vector<uint32_t>> ToVector() const
+        {
+            std::vector<std::vector<uint32_t>> result;
+            result.reserve(size());
+            for (const ShaderEngine engine : *this)
+            {
+                result.emplace_back(engine.begin(), engine.end());
+            }
+            return result;
+        }
+
+        /// @brief Remove all shader engines.
+        void Clear()
+        {
+            masks_.clear();
+            engine_offsets_.clear();
+        }
+
+        /// @brief Add a shader engine with no shader arrays.
+        void AddShaderEngine()
+        {
+            engine_offsets_.push_back(static_cast<uint32_t>(masks_.size()));
+        }
+
+        /// @brief Add a shader array to the last shader engine.
+        /// @param [in] mask The mask of the shader array.
+        void AddShaderArray(uint32_t mask)
+        {
+            masks_.push_back(mask);
+        }
+
+        bool operator==(const CuMask& other) const
+        {
+            return (engine_offsets_ == other.engine_offsets_) && (masks_ == other.masks_);
+        }
+
+        bool operator!=(const CuMask& other) const
+        {
+            return !(*this == other);
+        }
+
+        /// @brief Count the set bits in a mask.
+        /// @param [in] mask The mask.
+        /// @return The number of set bits.
+        static uint32_t CountBits(uint32_t mask)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<uint32_t>(__builtin_popcount(mask));
+#else
+            mask = mask - ((mask >> 1) & 0x55555555u);
+            mask = (mask & 0x33333333u) + ((mask >> 2) & 0x33333333u);
+            return (((mask + (mask >> 4)) & 0x0f0f0f0fu) * 0x01010101u) >> 24;
+#endif
+        }
+
+        /// @brief Count the set bits in a list of masks.
+        /// @param [in] masks The first mask.
+        /// @param [in] count The number of masks.
+        /// @return The number of set bits.
+        static uint32_t CountBits(const uint32_t* masks, size_t count)
+        {
+            uint32_t result = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                result += CountBits(masks[i]);
+            }
+            return result;
+        }
+
+    private:
+        std::vector<uint32_t> masks_;           ///< The shader array masks of all shader engines, in shader engine order.
+        std::vector<uint32_t> engine_offsets_;  ///< The index of the first shader array mask of each shader engine.
+    };
+
     /// @brief Structure containing physical hardware identification info.
     struct AsicInfo
     {
@@ -123,11 +374,8 @@ namespace system_info_utils
         uint32_t num_shader_engines;            ///< The number of shader engines on the GPU.
         uint32_t num_shader_arrays_per_engine;  ///< The number of shader arrays per shader engine on the GPU.
 
-        /// @brief The mask that describes the active CUs on the GPU.
-        ///
-        /// The mask is organized by shader engine index first and then the shader array within the engine.
-        std::vector<std::vector<uint32_t>> cu_mask;
-        uint32_t                           num_cus;  ///< The number of compute units on the GPU.
+        CuMask   cu_mask;  ///< The mask that describes the active CUs on the GPU.
+        uint32_t num_cus;  ///< The number of compute units on the GPU.
 
         IdInfo id_info;  ///< The hardware info, used to uniquely identify a GPU in the system.
     };
@@ -185,6 +433,188 @@ namespace system_info_utils
         uint32_t    id;    ///< Process ID
     };
 
+    /// @brief A read-only view of a process in a ProcessTable.
+    struct ProcessView
+    {
+        std::string_view name;  ///< Process name
+        std::string_view path;  ///< Process filepath
+        uint32_t         id;    ///< Process ID
+    };
+
+    /// @brief A compact list of processes, storing all names and paths in a single character arena.
+    ///
+    /// Each distinct path is stored once, and a name that is the file name at the end of its path
+    /// is stored as part of the path, so the many processes sharing an executable cost a small
+    /// fixed size record each. Views returned by the table stay valid until the table is modified.
+    class ProcessTable
+    {
+    public:
+        /// @brief Iterates over the processes.
+        class Iterator
+        {
+        public:
+            /// @brief Constructor.
+            /// @param [in] table The process table.
+            /// @param [in] index The process index.
+            Iterator(const ProcessTable* table, size_t index)
+                : table_(table)
+                , index_(index)
+                , process_()
+            {
+            }
+
+            /// @brief Get the current process.
+            /// @return A view that stays valid until the iterator is incremented, so processes can be bound to references.
+            const ProcessView& operator*() const
+            {
+                process_ = (*table_)[index_];
+                return process_;
+            }
+
+            Iterator& operator++()
+            {
+                ++index_;
+                return *this;
+            }
+
+            bool operator==(const Iterator& other) const
+            {
+                return index_ == other.index_;
+            }
+
+            bool operator!=(const Iterator& other) const
+            {
+                return index_ != other.index_;
+            }
+
+        private:
+            const ProcessTable* table_;    ///< The process table.
+            size_t              index_;    ///< The process index.
+            mutable ProcessView process_;  ///< The view returned by the last dereference.
+        };
+
+        /// @brief Get the number of processes.
+        size_t size() const
+        {
+            return records_.size();
+        }
+
+        /// @brief Check if the table has no processes.
+        bool empty() const
+        {
+            return records_.empty();
+        }
+
+        /// @brief Get a process.
+        /// @param [in] index The process index.
+        ProcessView operator[](size_t index) const
+        {
+            const Record& record = records_[index];
+            return ProcessView{GetString(record.name), GetString(record.path), record.id};
+        }
+
+        /// @brief Get the first process.
+        Iterator begin() const
+        {
+            return Iterator(this, 0);
+        }
+
+        /// @brief Get the end of the processes.
+        Iterator end() const
+        {
+            return Iterator(this, records_.size());
+        }
+
+        /// @brief Get the size of the character arena.
+        /// @return The number of bytes used by the distinct names and paths.
+        size_t StringBytes() const
+        {
+            return data_.size();
+        }
+
+        /// @brief Reserve memory for a number of processes.
+        /// @param [in] count The number of processes.
+        /// @param [in] string_bytes The number of bytes of distinct names and paths.
+        void Reserve(size_t count, size_t string_bytes);
+
+        /// @brief Remove all processes, keeping the allocated memory for reuse.
+        void Clear();
+
+        /// @brief Add a process.
+        /// @param [in] name The process name.
+        /// @param [in] path The process filepath.
+        /// @param [in] id The process ID.
+        /// @return true if the process was added, false if the character arena would exceed 4 GiB.
+        bool Add(std::string_view name, std::string_view path, uint32_t id);
+
+        /// @brief Replace a process.
+        /// @param [in] index The process index.
+        /// @param [in] name The process name.
+        /// @param [in] path The process filepath.
+        /// @param [in] id The process ID.
+        /// @return true if the process was replaced, false if the character arena would exceed 4 GiB.
+        bool Assign(size_t index, std::string_view name, std::string_view path, uint32_t id);
+
+        /// @brief Keep only the first processes.
+        /// @param [in] count The number of processes to keep. The strings of removed processes stay in the arena until Clear.
+        void Truncate(size_t count);
+
+        /// @brief Copy the processes into a process list.
+        std::vector<Process> ToVector() const;
+
+    private:
+        /// @brief The location of a string in the character arena.
+        struct StringRange
+        {
+            uint32_t offset;  ///< The offset of the first character.
+            uint32_t size;    ///< The number of characters.
+        };
+
+        /// @brief A process, referring to its strings in the character arena.
+        struct Record
+        {
+            StringRange name;  ///< Process name
+            StringRange path;  ///< Process filepath
+            uint32_t    id;    ///< Process ID
+        };
+
+        /// @brief A distinct string stored in the character arena.
+        struct InternedString
+        {
+            StringRange range;  ///< The location of the string.
+            size_t      hash;   ///< The hash of the string.
+        };
+
+        /// @brief Get a string from the character arena.
+        /// @param [in] range The location of the string.
+        std::string_view GetString(const StringRange& range) const
+        {
+            return std::string_view(data_.data() + range.offset, range.size);
+        }
+
+        /// @brief Store a string in the character arena unless an equal string is already stored.
+        /// @param [in] value The string.
+        /// @param [out] out_range The location of the string.
+        /// @return true if the string is stored, false if the character arena would exceed 4 GiB.
+        bool Intern(std::string_view value, StringRange& out_range);
+
+        /// @brief Rebuild the hash slots with room for more strings.
+        void Grow();
+
+        /// @brief Make a record, storing its strings.
+        /// @param [in] name The process name.
+        /// @param [in] path The process filepath.
+        /// @param [in] id The process ID.
+        /// @param [out] out_record The record.
+        /// @return true if the strings are stored, false if the character arena would exceed 4 GiB.
+        bool MakeRecord(std::string_view name, std::string_view path, uint32_t id, Record& out_record);
+
+        std::vector<Record>         records_;  ///< The processes.
+        std::vector<char>           data_;     ///< The character arena. Strings are not null terminated.
+        std::vector<InternedString> strings_;  ///< The distinct strings in the arena.
+        std::vector<uint32_t>       slots_;    ///< The open addressing hash slots, holding an index into strings_ plus one, or 0 if empty.
+    };
+
     /// @brief Structure containing the driver software info.
     struct DriverInfo
     {
@@ -207,9 +637,184 @@ namespace system_info_utils
         std::vector<CpuInfo> cpus;       ///< A vector of all CPU devices identified in the system.
         std::vector<GpuInfo> gpus;       ///< A vector of all GPU devices identified in the system.
         std::vector<Process> processes;  ///< A vector of running processes identified in the system.
+
+        /// @brief The running processes in compact form, filled instead of processes when parsing with kSystemInfoSectionProcessTable.
+        ProcessTable process_table;
+    };
+
+    /// @brief Flags selecting the system info sections to parse.
+    ///
+    /// Skipping unneeded sections, such as a long process list, reduces the parse
+    /// time and the memory used by the parsed structure. The version is always parsed.
+    enum SystemInfoSection : uint32_t
+    {
+        kSystemInfoSectionDriver    = 0x01,  ///< The driver and DevDriver info.
+        kSystemInfoSectionOs        = 0x02,  ///< The OS info.
+        kSystemInfoSectionOsConfig  = 0x04,  ///< The OS configuration info. Only parsed along with the OS info.
+        kSystemInfoSectionCpus      = 0x08,  ///< The CPU list.
+        kSystemInfoSectionGpus      = 0x10,  ///< The GPU list.
+        kSystemInfoSectionGpuHeaps  = 0x20,  ///< The memory heaps of each GPU. Only parsed along with the GPU list.
+        kSystemInfoSectionProcesses = 0x40,  ///< The process list.
+        kSystemInfoSectionAll       = 0x7f,  ///< All sections.
+
+        /// @brief The process list, stored in SystemInfo::process_table instead of SystemInfo::processes.
+        ///
+        /// Not part of kSystemInfoSectionAll. The process list is parsed if either this flag or
+        /// kSystemInfoSectionProcesses is set, and stored in the process table if this flag is set.
+        kSystemInfoSectionProcessTable = 0x80
+    };
+
+    /// @brief The reason a system info parse failed.
+    enum class SystemInfoParseError : uint32_t
+    {
+        kNone,                ///< The system info was parsed.
+        kSyntax,              ///< The text is not valid JSON.
+        kInvalidType,         ///< A member has a type or value that its field cannot hold, e.g. a string GPU index.
+        kUnsupportedVersion,  ///< The chunk version is not supported.
+        kChunkNotFound,       ///< The RDF file does not contain a System Info chunk of a supported version.
+        kOutOfMemory          ///< The parsed structure could not be allocated.
+    };
+
+    /// @brief The outcome of a parse, locating the error in the JSON text when it failed.
+    ///
+    /// The location is only computed once a parse has failed, by tokenizing the text again
+    /// up to the error, so successful parses pay nothing for it.
+    struct SystemInfoParseResult
+    {
+        SystemInfoParseError error;    ///< The reason the parse failed, or kNone if it succeeded.
+        size_t               offset;   ///< The byte offset just past the JSON token at which the error was detected. 0 if the text was not parsed.
+        std::string          pointer;  ///< The JSON pointer of the innermost member being parsed at the error, e.g. "/system/gpus/0/asic/gpuIndex".
+
+        /// @brief Check if the parse succeeded.
+        /// @return true if the error is kNone, false otherwise.
+        bool IsSucceeded() const
+        {
+            return error == SystemInfoParseError::kNone;
+        }
+    };
+
+#ifdef SYSTEM_INFO_ENABLE_PARSE_STATS
+    /// @brief The top-level sections timed by the parse stats.
+    enum class SystemInfoStatsSection : uint32_t
+    {
+        kDriver,     ///< The driver and DevDriver info.
+        kOs,         ///< The OS info.
+        kCpus,       ///< The CPU list.
+        kGpus,       ///< The GPU list.
+        kProcesses,  ///< The process list.
+        kCount       ///< The number of sections.
+    };
+
+    static constexpr size_t kSystemInfoStatsSectionCount = static_cast<size_t>(SystemInfoStatsSection::kCount);  ///< The number of timed sections.
+
+    /// @brief Timings and counters of a parse, only available when built with SYSTEM_INFO_ENABLE_PARSE_STATS.
+    ///
+    /// The JSON text is tokenized and the structures are populated in a single pass, so the time
+    /// of a section includes tokenizing it. The rest of the parse time is spent on the members
+    /// outside of the sections, such as the version and skipped members.
+    struct SystemInfoParseStats
+    {
+        uint64_t chunk_read_ns;                                   ///< The time spent reading the RDF chunk, 0 when parsing JSON text.
+        uint64_t parse_ns;                                        ///< The time spent parsing the JSON text, including all sections.
+        uint64_t bytes;                                           ///< The size of the JSON text in bytes.
+        uint64_t section_ns[kSystemInfoStatsSectionCount];        ///< The time spent in each section, indexed by SystemInfoStatsSection.
+        uint64_t section_elements[kSystemInfoStatsSectionCount];  ///< The list elements created in each section, e.g. CPUs, GPUs, heaps and processes.
+    };
+#endif
+
+    class SystemInfoSaxParser;
+
+    /// @brief Holds the state used to parse system info, so it can be reused between parses.
+    ///
+    /// Parsing many documents through one context avoids recreating the parser and
+    /// reallocating the chunk buffer for each of them. A context must not be shared
+    /// between threads, but each thread may use its own context.
+    class SystemInfoParseContext
+    {
+    public:
+        /// @brief Constructor
+        SystemInfoParseContext();
+
+        /// @brief Destructor
+        ~SystemInfoParseContext();
+
+        /// @brief delete copy constructor
+        SystemInfoParseContext(const SystemInfoParseContext&) = delete;
+
+        /// @brief delete assignment operator
+        SystemInfoParseContext& operator=(const SystemInfoParseContext&) = delete;
+
+        /// @brief Parses system info JSON representation
+        /// @param [in] json The system info JSON
+        /// @param [in, out] system_info The parsed JSON represented by system info structure
+        /// @param [in] sections The SystemInfoSection flags selecting the sections to parse. Other sections are skipped and left unchanged.
+        /// @return true if successfully parsed, false otherwise
+        bool Parse(const std::string& json, SystemInfo& system_info, uint32_t sections = kSystemInfoSectionAll);
+
+        /// @brief Parses system info JSON representation in place
+        /// @param [in] json The system info JSON text. Does not need to be null terminated.
+        /// @param [in] size The size of the system info JSON text in bytes
+        /// @param [in, out] system_info The parsed JSON represented by system info structure
+        /// @param [in] sections The SystemInfoSection flags selecting the sections to parse. Other sections are skipped and left unchanged.
+        /// @return true if successfully parsed, false otherwise
+        bool Parse(const char* json, size_t size, SystemInfo& system_info, uint32_t sections = kSystemInfoSectionAll);
+
+        /// @brief Parses system info JSON representation in place, reporting where it failed
+        /// @param [in] json The system info JSON text. Does not need to be null terminated.
+        /// @param [in] size The size of the system info JSON text in bytes
+        /// @param [in, out] system_info The parsed JSON represented by system info structure
+        /// @param [in] sections The SystemInfoSection flags selecting the sections to parse. Other sections are skipped and left unchanged.
+        /// @return The parse result, with the error and its location if the parse failed
+        SystemInfoParseResult TryParse(const char* json, size_t size, SystemInfo& system_info, uint32_t sections = kSystemInfoSectionAll);
+
+#ifdef SYSTEM_INFO_ENABLE_RDF
+#ifdef RDF_CXX_BINDINGS
+        /// @brief Parses system info chunk from RDF file, reading it into the context's chunk buffer
+        /// @param [in] file The RDF file
+        /// @param [in, out] system_info The system info structure
+        /// @param [in] sections The SystemInfoSection flags selecting the sections to parse. Other sections are skipped and left unchanged.
+        /// @return true on successful parse, false otherwise
+        bool Parse(rdf::ChunkFile& file, SystemInfo& system_info, uint32_t sections = kSystemInfoSectionAll);
+
+        /// @brief Parses system info chunk from RDF file, reading it into the context's chunk buffer and reporting where it failed
+        /// @param [in] file The RDF file
+        /// @param [in, out] system_info The system info structure
+        /// @param [in] sections The SystemInfoSection flags selecting the sections to parse. Other sections are skipped and left unchanged.
+        /// @return The parse result, with the error and its location in the chunk data if the parse failed
+        SystemInfoParseResult TryParse(rdf::ChunkFile& file, SystemInfo& system_info, uint32_t sections = kSystemInfoSectionAll);
+#endif
+        /// @brief Parses system info chunk from RDF file, reading it into the context's chunk buffer
+        /// @param [in] file The RDF file
+        /// @param [in, out] system_info The system info structure
+        /// @param [in] sections The SystemInfoSection flags selecting the sections to parse. Other sections are skipped and left unchanged.
+        /// @return true on successful parse, false otherwise
+        bool Parse(rdfChunkFile* file, SystemInfo& system_info, uint32_t sections = kSystemInfoSectionAll);
+
+        /// @brief Parses system info chunk from RDF file, reading it into the context's chunk buffer and reporting where it failed
+        /// @param [in] file The RDF file
+        /// @param [in, out] system_info The system info structure
+        /// @param [in] sections The SystemInfoSection flags selecting the sections to parse. Other sections are skipped and left unchanged.
+        /// @return The parse result, with the error and its location in the chunk data if the parse failed
+        SystemInfoParseResult TryParse(rdfChunkFile* file, SystemInfo& system_info, uint32_t sections = kSystemInfoSectionAll);
+#endif
+
+#ifdef SYSTEM_INFO_ENABLE_PARSE_STATS
+        /// @brief Get the timings and counters of the last parse.
+        /// @return The stats of the last call to Parse, also when it failed.
+        const SystemInfoParseStats& GetParseStats() const;
+#endif
+
+    private:
+        std::unique_ptr<SystemInfoSaxParser> parser_;        ///< The parser, reused between parses.
+        std::vector<char>                    chunk_buffer_;  ///< The buffer RDF chunk data is read into.
+#ifdef SYSTEM_INFO_ENABLE_PARSE_STATS
+        SystemInfoParseStats parse_stats_;  ///< The stats of the last parse.
+#endif
     };
 
     /// @brief Parses system info JSON representation
+    ///
+    /// Each call uses its own parse context, so the reader may be used from several threads at once.
     class SystemInfoReader
     {
     public:
@@ -222,12 +827,32 @@ namespace system_info_utils
         /// @brief Parses system info JSON representation
         /// @param [in] json The system info JSON
         /// @param [in, out] system_info The parsed JSON represented by system info structure
+        /// @param [in] sections The SystemInfoSection flags selecting the sections to parse. Other sections are skipped and left unchanged.
         /// @return true if successfully parsed, false otherwise
-        static bool Parse(const std::string& json, SystemInfo& system_info);
+        static bool Parse(const std::string& json, SystemInfo& system_info, uint32_t sections = kSystemInfoSectionAll);
+
+        /// @brief Parses system info JSON representation in place
+        /// @param [in] json The system info JSON text. Does not need to be null terminated.
+        /// @param [in] size The size of the system info JSON text in bytes
+        /// @param [in, out] system_info The parsed JSON represented by system info structure
+        /// @param [in] sections The SystemInfoSection flags selecting the sections to parse. Other sections are skipped and left unchanged.
+        /// @return true if successfully parsed, false otherwise
+        static bool Parse(const char* json, size_t size, SystemInfo& system_info, uint32_t sections = kSystemInfoSectionAll);
+
+        /// @brief Parses system info JSON representation in place, reporting where it failed
+        /// @param [in] json The system info JSON text. Does not need to be null terminated.
+        /// @param [in] size The size of the system info JSON text in bytes
+        /// @param [in, out] system_info The parsed JSON represented by system info structure
+        /// @param [in] sections The SystemInfoSection flags selecting the sections to parse. Other sections are skipped and left unchanged.
+        /// @return The parse result, with the error and its location if the parse failed
+        static SystemInfoParseResult TryParse(const char* json, size_t size, SystemInfo& system_info, uint32_t sections = kSystemInfoSectionAll);
 
         /// @brief Parses system info JSON representation
+        ///
+        /// The 'system' node is returned as it is written rather than re-serialized. If the key is
+        /// repeated, the last node is returned.
         /// @param [in] json The system info JSON
-        /// @return system info JSON structure text
+        /// @return system info JSON structure text, or an empty string if the JSON is not valid
         static std::string Parse(const std::string& json);
 
 #ifdef SYSTEM_INFO_ENABLE_RDF
@@ -235,14 +860,32 @@ namespace system_info_utils
         /// @brief Parses system info chunk from RDF file
         /// @param [in] file The RDF file
         /// @param [in, out] system_info The system info structure
+        /// @param [in] sections The SystemInfoSection flags selecting the sections to parse. Other sections are skipped and left unchanged.
         /// @return true on successful parse, false otherwise
-        static bool Parse(rdf::ChunkFile& file, SystemInfo& system_info);
+        static bool Parse(rdf::ChunkFile& file, SystemInfo& system_info, uint32_t sections = kSystemInfoSectionAll);
+
+        /// @brief Parses system info chunk from RDF file
+        /// @param [in] file The RDF file
+        /// @param [in, out] system_info The system info structure
+        /// @param [in, out] buffer The buffer the chunk data is read into. Reusing it avoids an allocation per chunk.
+        /// @param [in] sections The SystemInfoSection flags selecting the sections to parse. Other sections are skipped and left unchanged.
+        /// @return true on successful parse, false otherwise
+        static bool Parse(rdf::ChunkFile& file, SystemInfo& system_info, std::vector<char>& buffer, uint32_t sections = kSystemInfoSectionAll);
 #endif
         /// @brief Parses system info chunk from RDF file
         /// @param [in] file The RDF file
         /// @param [in, out] system_info The system info structure
+        /// @param [in] sections The SystemInfoSection flags selecting the sections to parse. Other sections are skipped and left unchanged.
+        /// @return true on successful parse, false otherwise
+        static bool Parse(rdfChunkFile* file, SystemInfo& system_info, uint32_t sections = kSystemInfoSectionAll);
+
+        /// @brief Parses system info chunk from RDF file
+        /// @param [in] file The RDF file
+        /// @param [in, out] system_info The system info structure
+        /// @param [in, out] buffer The buffer the chunk data is read into. Reusing it avoids an allocation per chunk.
+        /// @param [in] sections The SystemInfoSection flags selecting the sections to parse. Other sections are skipped and left unchanged.
         /// @return true on successful parse, false otherwise
-        static bool Parse(rdfChunkFile* file, SystemInfo& system_info);
+        static bool Parse(rdfChunkFile* file, SystemInfo& system_info, std::vector<char>& buffer, uint32_t sections = kSystemInfoSectionAll);
 #endif
     };
 }  // namespace system_info_utils
@@ -0,0 +1,2354 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief System info SAX parser implementation
+//=============================================================================
+
+#include "system_info_sax_parser.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "definitions.h"
+#include "static_key_table.h"
+#include "system_info_decoder.h"
+
+namespace
+{
+    using system_info_utils::SaxKey;
+
+    /// @brief The JSON object keys used by the parser and their key identifiers.
+    constexpr system_info_utils::StaticKeyEntry<SaxKey> kKeyEntries[] = {
+        {kNodeStringSystem, SaxKey::kSystem},
+        {kNodeStringDriver, SaxKey::kDriver},
+        {kNodeStringName, SaxKey::kName},
+        {kNodeStringDescription, SaxKey::kDescription},
+        {kNodeStringVersion, SaxKey::kVersion},
+        {kNodeStringDriverPackagingVersion, SaxKey::kDriverPackagingVersion},
+        {kNodeStringDriverSoftwareVersion, SaxKey::kDriverSoftwareVersion},
+        {kNodeStringOs, SaxKey::kOs},
+        {kNodeStringVirtualization, SaxKey::kVirtualization},
+        {kNodeStringType, SaxKey::kType},
+        {kNodeStringHostName, SaxKey::kHostName},
+        {kNodeStringMemory, SaxKey::kMemory},
+        {kNodeStringMemoryPhysical, SaxKey::kMemoryPhysical},
+        {kNodeStringMemorySwap, SaxKey::kMemorySwap},
+        {kNodeStringCpus, SaxKey::kCpus},
+        {kNodeStringProcesses, SaxKey::kProcesses},
+        {kNodeStringProcessId, SaxKey::kProcessId},
+        {kNodeStringPath, SaxKey::kPath},
+        {kNodeStringArchitecture, SaxKey::kArchitecture},
+        {kNodeStringCpuVendorId, SaxKey::kCpuVendorId},
+        {kNodeStringCpuTimeClockFreq, SaxKey::kCpuTimeClockFreq},
+        {kNodeStringCpuPhysicalCoreCount, SaxKey::kCpuPhysicalCoreCount},
+        {kNodeStringCpuLogicalCoreCount, SaxKey::kCpuLogicalCoreCount},
+        {kNodeStringSpeed, SaxKey::kSpeed},
+        {kNodeStringCpuId, SaxKey::kCpuId},
+        {kNodeStringCpuDeviceId, SaxKey::kCpuDeviceId},
+        {kNodeStringGpus, SaxKey::kGpus},
+        {kNodeStringPci, SaxKey::kPci},
+        {kNodeStringPciBus, SaxKey::kPciBus},
+        {kNodeStringDevice, SaxKey::kDevice},
+        {kNodeStringPciFunction, SaxKey::kPciFunction},
+        {kNodeStringAsic, SaxKey::kAsic},
+        {kNodeStringAsicGpuIndex, SaxKey::kAsicGpuIndex},
+        {kNodeStringAsicGpuCounterFrequency, SaxKey::kAsicGpuCounterFrequency},
+        {kNodeStringAsicNumSe, SaxKey::kAsicNumSe},
+        {kNodeStringAsicNumSaPerSe, SaxKey::kAsicNumSaPerSe},
+        {kNodeStringAsicCuMask, SaxKey::kAsicCuMask},
+        {kNodeStringAsicNumCus, SaxKey::kAsicNumCus},
+        {kNodeStringAsicEngineClockSpeed, SaxKey::kAsicEngineClockSpeed},
+        {kNodeStringMin, SaxKey::kMin},
+        {kNodeStringMax, SaxKey::kMax},
+        {kNodeStringAsicIds, SaxKey::kAsicIds},
+        {kNodeStringAsicGfxEngine, SaxKey::kAsicGfxEngine},
+        {kNodeStringAsicFamily, SaxKey::kAsicFamily},
+        {kNodeStringAsicERev, SaxKey::kAsicERev},
+        {kNodeStringAsicRevision, SaxKey::kAsicRevision},
+        {kNodeStringAsicSubsystem, SaxKey::kAsicSubsystem},
+        {kNodeStringAsicVendor, SaxKey::kAsicVendor},
+        {kNodeStringAsicLuid, SaxKey::kAsicLuid},
+        {kNodeStringMemoryOpsPerClock, SaxKey::kMemoryOpsPerClock},
+        {kNodeStringMemoryBusBitWidth, SaxKey::kMemoryBusBitWidth},
+        {kNodeStringMemoryBandwith, SaxKey::kMemoryBandwith},
+        {kNodeStringMemoryClockSpeed, SaxKey::kMemoryClockSpeed},
+        {kNodeStringHeaps, SaxKey::kHeaps},
+        {kNodeStringPhysicalAddress, SaxKey::kPhysicalAddress},
+        {kNodeStringSize, SaxKey::kSize},
+        {kNodeStringExcludedVaRanges, SaxKey::kExcludedVaRanges},
+        {kNodeStringBase, SaxKey::kBase},
+        {kNodeStringBigSw, SaxKey::kBigSw},
+        {kNodeStringMajor, SaxKey::kMajor},
+        {kNodeStringMinor, SaxKey::kMinor},
+        {kNodeStringPatch, SaxKey::kPatch},
+        {kNodeStringBuild, SaxKey::kBuild},
+        {kNodeStringMisc, SaxKey::kMisc},
+        {kNodeStringConfig, SaxKey::kConfig},
+        {kNodeStringDrm, SaxKey::kDrm},
+        {kNodeStringIsClosedSource, SaxKey::kIsClosedSource},
+        {kNodeStringEtwSupport, SaxKey::kEtwSupport},
+        {kNodeStringSupported, SaxKey::kSupported},
+        {kNodeStringEtwRegistryOrUserGroup, SaxKey::kEtwRegistryOrUserGroup},
+        {kNodeStringHasPermission, SaxKey::kHasPermission},
+        {kNodeStringStatusCode, SaxKey::kStatusCode},
+        {kNodeStringPowerDpmWritable, SaxKey::kPowerDpmWritable},
+        {kNodeStringDevDriver, SaxKey::kDevDriver},
+        {kNodeStringTag, SaxKey::kTag},
+        {kNodeStringLinux, SaxKey::kLinux},
+        {kNodeStringWindows, SaxKey::kWindows},
+    };
+
+    /// @brief The perfect hash table of the JSON object keys, built at compile time.
+    constexpr auto kKeys = system_info_utils::MakeStaticKeyTable(kKeyEntries, SaxKey::kUnknown);
+    static_assert(kKeys.IsValid(), "The JSON object keys must be unique");
+
+    /// @brief Look up the key identifier for a JSON object key.
+    /// @param [in] name The JSON object key.
+    /// @return The key identifier, or SaxKey::kUnknown if the key is not used by the parser.
+    SaxKey LookupKey(std::string_view name)
+    {
+        return kKeys.Find(name);
+    }
+
+#ifdef SYSTEM_INFO_ENABLE_PARSE_STATS
+    /// @brief Get the parse stats section of a node that contains a whole top-level section.
+    /// @param [in] node The node.
+    /// @param [out] section The section contained by the node.
+    /// @return true if the node contains a section, false otherwise.
+    bool GetTimedSection(system_info_utils::SaxNode node, system_info_utils::SystemInfoStatsSection& section)
+    {
+        using system_info_utils::SaxNode;
+        using system_info_utils::SystemInfoStatsSection;
+
+        switch (node)
+        {
+        case SaxNode::kDriver:
+        case SaxNode::kDevDriver:
+            section = SystemInfoStatsSection::kDriver;
+            return true;
+        case SaxNode::kOs:
+            section = SystemInfoStatsSection::kOs;
+            return true;
+        case SaxNode::kCpuList:
+            section = SystemInfoStatsSection::kCpus;
+            return true;
+        case SaxNode::kGpuList:
+            section = SystemInfoStatsSection::kGpus;
+            return true;
+        case SaxNode::kProcessList:
+            section = SystemInfoStatsSection::kProcesses;
+            return true;
+        default:
+            return false;
+        }
+    }
+#endif
+
+    /// @brief Assign an arithmetic JSON value, converting it the same way as nlohmann::json::get.
+    /// @tparam [in] T The arithmetic type of the field.
+    /// @param [in] value The scalar JSON value.
+    /// @param [out] out The field to assign.
+    /// @return false if the value is not a number or boolean, true otherwise.
+    template <typename T>
+    bool AssignArithmetic(const system_info_utils::SaxValue& value, T& out)
+    {
+        switch (value.type)
+        {
+        case system_info_utils::SaxValueType::kBoolean:
+            // nlohmann::json does not convert booleans to its own number types.
+            if constexpr (std::is_same<T, nlohmann::json::number_unsigned_t>::value)
+            {
+                return false;
+            }
+            out = static_cast<T>(value.boolean);
+            return true;
+        case system_info_utils::SaxValueType::kInteger:
+            out = static_cast<T>(value.number_integer);
+            return true;
+        case system_info_utils::SaxValueType::kUnsigned:
+            out = static_cast<T>(value.number_unsigned);
+            return true;
+        case system_info_utils::SaxValueType::kFloat:
+            out = static_cast<T>(value.number_float);
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    /// @brief Assign a boolean JSON value.
+    /// @param [in] value The scalar JSON value.
+    /// @param [out] out The field to assign.
+    /// @return false if the value is not a boolean, true otherwise.
+    bool AssignBoolean(const system_info_utils::SaxValue& value, bool& out)
+    {
+        if (value.type != system_info_utils::SaxValueType::kBoolean)
+        {
+            return false;
+        }
+
+        out = value.boolean;
+        return true;
+    }
+
+    /// @brief Assign a string JSON value.
+    /// @param [in] value The scalar JSON value.
+    /// @param [out] out The field to assign.
+    /// @return false if the value is not a string, true otherwise.
+    bool AssignString(const system_info_utils::SaxValue& value, std::string& out)
+    {
+        if (value.type != system_info_utils::SaxValueType::kString)
+        {
+            return false;
+        }
+
+        out = *value.string;
+        return true;
+    }
+
+    /// @brief An iterator over JSON text that jumps over the interiors of skipped values, optionally recording how many bytes the lexer has read.
+    class SkippingIterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = char;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const char*;
+        using reference         = const char&;
+
+        /// @brief Constructor.
+        /// @param [in] begin The beginning of the JSON text.
+        /// @param [in] current The character the iterator points to. Must not be inside a skipped range.
+        /// @param [in] skips The skipped ranges, in document order.
+        /// @param [out] read The number of bytes before the iterator, updated as it advances, or nullptr if not needed.
+        SkippingIterator(const char* begin, const char* current, const std::vector<system_info_utils::SaxSkipRange>& skips, size_t* read)
+            : begin_(begin)
+            , current_(current)
+            , next_skip_(skips.data())
+            , last_skip_(skips.data() + skips.size())
+            , skip_from_(nullptr)
+            , read_(read)
+        {
+            while ((next_skip_ != last_skip_) && (begin_ + next_skip_->begin < current_))
+            {
+                ++next_skip_;
+            }
+
+            skip_from_ = (next_skip_ != last_skip_) ? begin_ + next_skip_->begin : nullptr;
+        }
+
+        reference operator*() const
+        {
+            return *current_;
+        }
+
+        SkippingIterator& operator++()
+        {
+            ++current_;
+            if (current_ == skip_from_)
+            {
+                // Continue at the closing bracket, so the lexer sees an empty container.
+                current_ = begin_ + next_skip_->end;
+                ++next_skip_;
+                skip_from_ = (next_skip_ != last_skip_) ? begin_ + next_skip_->begin : nullptr;
+            }
+
+            if (read_ != nullptr)
+            {
+                *read_ = static_cast<size_t>(current_ - begin_);
+            }
+
+            return *this;
+        }
+
+        SkippingIterator operator++(int)
+        {
+            SkippingIterator result = *this;
+            ++(*this);
+            return result;
+        }
+
+        bool operator==(const SkippingIterator& other) const
+        {
+            return current_ == other.current_;
+        }
+
+        bool operator!=(const SkippingIterator& other) const
+        {
+            return current_ != other.current_;
+        }
+
+    private:
+        const char*                            begin_;      ///< The beginning of the JSON text.
+        const char*                            current_;    ///< The character the iterator points to.
+        const system_info_utils::SaxSkipRange* next_skip_;  ///< The next skipped range.
+        const system_info_utils::SaxSkipRange* last_skip_;  ///< The end of the skipped ranges.
+        const char*                            skip_from_;  ///< The first character of the next skipped range, or nullptr if there is none.
+        size_t*                                read_;       ///< The number of bytes read by the lexer, or nullptr.
+    };
+
+    /// @brief Replays the SAX events of a document up to a numbered event and reports where it is.
+    ///
+    /// Only used once a parse has failed, so the parser itself never tracks keys, array indices or offsets.
+    class SaxLocator
+    {
+    public:
+        /// @brief Constructor.
+        /// @param [in] event The number of the event to locate, counting from 1.
+        explicit SaxLocator(size_t event)
+            : event_(event)
+            , event_count_(0)
+            , data_(nullptr)
+            , read_(0)
+            , offset_(nullptr)
+            , pointer_(nullptr)
+        {
+        }
+
+        /// @brief Tokenize the JSON text up to the event, or up to the first syntax error.
+        /// @param [in] data The JSON text.
+        /// @param [in] size The size of the JSON text in bytes.
+        /// @param [in] skips The interiors of the values skipped by the failed parse, so the events are numbered the same.
+        /// @param [out] out_offset The byte offset just past the token of the event.
+        /// @param [out] out_pointer The JSON pointer of the innermost member being parsed at the event.
+        void Run(const char* data, size_t size, const std::vector<system_info_utils::SaxSkipRange>& skips, size_t& out_offset, std::string& out_pointer)
+        {
+            data_    = data;
+            offset_  = &out_offset;
+            pointer_ = &out_pointer;
+
+            nlohmann::json::sax_parse(SkippingIterator(data, data, skips, &read_), SkippingIterator(data, data + size, skips, &read_), this);
+        }
+
+        bool null()
+        {
+            return OnValue(false);
+        }
+
+        bool boolean(bool value)
+        {
+            SYSTEM_INFO_UNUSED(value);
+            return OnValue(false);
+        }
+
+        bool number_integer(nlohmann::json::number_integer_t value)
+        {
+            SYSTEM_INFO_UNUSED(value);
+            return OnValue(true);
+        }
+
+        bool number_unsigned(nlohmann::json::number_unsigned_t value)
+        {
+            SYSTEM_INFO_UNUSED(value);
+            return OnValue(true);
+        }
+
+        bool number_float(nlohmann::json::number_float_t value, const nlohmann::json::string_t& text)
+        {
+            SYSTEM_INFO_UNUSED(value);
+            SYSTEM_INFO_UNUSED(text);
+            return OnValue(true);
+        }
+
+        bool string(nlohmann::json::string_t& value)
+        {
+            SYSTEM_INFO_UNUSED(value);
+            return OnValue(false);
+        }
+
+        bool binary(nlohmann::json::binary_t& value)
+        {
+            SYSTEM_INFO_UNUSED(value);
+            return OnValue(false);
+        }
+
+        bool start_object(std::size_t element_count)
+        {
+            SYSTEM_INFO_UNUSED(element_count);
+            return OnStartContainer(false);
+        }
+
+        bool key(nlohmann::json::string_t& value)
+        {
+            Component& component = components_.back();
+            component.key        = value;
+            component.active     = true;
+            return !IsEvent(false);
+        }
+
+        bool end_object()
+        {
+            return OnEndContainer();
+        }
+
+        bool start_array(std::size_t element_count)
+        {
+            SYSTEM_INFO_UNUSED(element_count);
+            return OnStartContainer(true);
+        }
+
+        bool end_array()
+        {
+            return OnEndContainer();
+        }
+
+        bool parse_error(std::size_t position, const std::string& last_token, const nlohmann::json::exception& exception)
+        {
+            SYSTEM_INFO_UNUSED(position);
+            SYSTEM_INFO_UNUSED(last_token);
+            SYSTEM_INFO_UNUSED(exception);
+
+            Capture(false);
+            return false;
+        }
+
+    private:
+        /// @brief The member of a container currently being parsed.
+        struct Component
+        {
+            std::string key;       ///< The key of the member, for objects.
+            size_t      count;     ///< The number of elements started, for arrays.
+            bool        is_array;  ///< True if the container is an array, false if it is an object.
+            bool        active;    ///< True while a member of the container is being parsed.
+        };
+
+        /// @brief Handle a scalar value.
+        /// @param [in] is_number True if the value is a number, whose token is followed by a character the lexer has already read.
+        /// @return false once the event has been located, true otherwise.
+        bool OnValue(bool is_number)
+        {
+            BeginElement();
+            const bool found = IsEvent(is_number);
+            EndElement();
+            return !found;
+        }
+
+        /// @brief Handle the beginning of an object or array.
+        bool OnStartContainer(bool is_array)
+        {
+            BeginElement();
+            if (IsEvent(false))
+            {
+                return false;
+            }
+
+            components_.push_back({std::string(), 0, is_array, false});
+            return true;
+        }
+
+        /// @brief Handle the end of an object or array.
+        bool OnEndContainer()
+        {
+            if (IsEvent(false))
+            {
+                return false;
+            }
+
+            components_.pop_back();
+            EndElement();
+            return true;
+        }
+
+        /// @brief Start an element of the innermost array.
+        void BeginElement()
+        {
+            if (!components_.empty() && components_.back().is_array)
+            {
+                ++components_.back().count;
+                components_.back().active = true;
+            }
+        }
+
+        /// @brief Finish the member of the innermost container.
+        void EndElement()
+        {
+            if (!components_.empty())
+            {
+                components_.back().active = false;
+            }
+        }
+
+        /// @brief Count an event, capturing the location if it is the event being located.
+        /// @param [in] is_number True if the event is a number.
+        /// @return true if it is the event being located, false otherwise.
+        bool IsEvent(bool is_number)
+        {
+            if (++event_count_ != event_)
+            {
+                return false;
+            }
+
+            Capture(is_number);
+            return true;
+        }
+
+        /// @brief Capture the current location.
+        /// @param [in] is_number True if the event is a number.
+        void Capture(bool is_number)
+        {
+            // The lexer reads the character following a number to find its end.
+            *offset_ = read_;
+            if (is_number && (read_ > 0) && (std::string_view("0123456789+-.eE").find(data_[read_ - 1]) == std::string_view::npos))
+            {
+                --(*offset_);
+            }
+
+            pointer_->clear();
+            for (const Component& component : components_)
+            {
+                if (!component.active)
+                {
+                    continue;
+                }
+
+                pointer_->push_back('/');
+                if (component.is_array)
+                {
+                    pointer_->append(std::to_string(component.count - 1));
+                    continue;
+                }
+
+                // Escape the key as described by RFC 6901.
+                for (char c : component.key)
+                {
+                    if (c == '~')
+                    {
+                        pointer_->append("~0");
+                    }
+                    else if (c == '/')
+                    {
+                        pointer_->append("~1");
+                    }
+                    else
+                    {
+                        pointer_->push_back(c);
+                    }
+                }
+            }
+        }
+
+        std::vector<Component> components_;   ///< The member being parsed in each open container.
+        size_t                 event_;        ///< The number of the event to locate.
+        size_t                 event_count_;  ///< The number of events received.
+        const char*            data_;         ///< The JSON text.
+        size_t                 read_;         ///< The number of bytes read by the lexer.
+        size_t*                offset_;       ///< The offset to fill in.
+        std::string*           pointer_;      ///< The JSON pointer to fill in.
+    };
+
+    /// @brief Finds the members of a document that a later member of the same object replaces.
+    ///
+    /// The DOM based parser keeps only the last member for a repeated key. Only used once a parse
+    /// has found a repeated key or failed, so the parser itself tracks keys by identifier only.
+    class SaxRepeatedKeyFinder
+    {
+    public:
+        /// @brief Constructor.
+        SaxRepeatedKeyFinder()
+            : event_count_(0)
+            , superseded_(nullptr)
+        {
+        }
+
+        /// @brief Tokenize the JSON text, numbering the events like the parser.
+        /// @param [in] data The JSON text.
+        /// @param [in] size The size of the JSON text in bytes.
+        /// @param [in] skips The interiors of the values skipped by the parser, so the events are numbered the same.
+        /// @param [out] out_superseded The key events of the replaced members, in order.
+        void Run(const char* data, size_t size, const std::vector<system_info_utils::SaxSkipRange>& skips, std::vector<size_t>& out_superseded)
+        {
+            superseded_ = &out_superseded;
+            superseded_->clear();
+
+            nlohmann::json::sax_parse(SkippingIterator(data, data, skips, nullptr), SkippingIterator(data, data + size, skips, nullptr), this);
+
+            // A member is recorded when its replacement is found, which may be after later members were recorded.
+            std::sort(superseded_->begin(), superseded_->end());
+        }
+
+        bool null()
+        {
+            return OnEvent();
+        }
+
+        bool boolean(bool value)
+        {
+            SYSTEM_INFO_UNUSED(value);
+            return OnEvent();
+        }
+
+        bool number_integer(nlohmann::json::number_integer_t value)
+        {
+            SYSTEM_INFO_UNUSED(value);
+            return OnEvent();
+        }
+
+        bool number_unsigned(nlohmann::json::number_unsigned_t value)
+        {
+            SYSTEM_INFO_UNUSED(value);
+            return OnEvent();
+        }
+
+        bool number_float(nlohmann::json::number_float_t value, const nlohmann::json::string_t& text)
+        {
+            SYSTEM_INFO_UNUSED(value);
+            SYSTEM_INFO_UNUSED(text);
+            return OnEvent();
+        }
+
+        bool string(nlohmann::json::string_t& value)
+        {
+            SYSTEM_INFO_UNUSED(value);
+            return OnEvent();
+        }
+
+        bool binary(nlohmann::json::binary_t& value)
+        {
+            SYSTEM_INFO_UNUSED(value);
+            return OnEvent();
+        }
+
+        bool start_object(std::size_t element_count)
+        {
+            SYSTEM_INFO_UNUSED(element_count);
+            containers_.push_back(keys_.size());
+            return OnEvent();
+        }
+
+        bool key(nlohmann::json::string_t& value)
+        {
+            OnEvent();
+
+            for (size_t index = containers_.back(); index < keys_.size(); ++index)
+            {
+                if (keys_[index].first == value)
+                {
+                    superseded_->push_back(keys_[index].second);
+                    keys_[index].second = event_count_;
+                    return true;
+                }
+            }
+
+            keys_.emplace_back(value, event_count_);
+            return true;
+        }
+
+        bool end_object()
+        {
+            return OnEndContainer();
+        }
+
+        bool start_array(std::size_t element_count)
+        {
+            SYSTEM_INFO_UNUSED(element_count);
+            containers_.push_back(keys_.size());
+            return OnEvent();
+        }
+
+        bool end_array()
+        {
+            return OnEndContainer();
+        }
+
+        bool parse_error(std::size_t position, const std::string& last_token, const nlohmann::json::exception& exception)
+        {
+            SYSTEM_INFO_UNUSED(position);
+            SYSTEM_INFO_UNUSED(last_token);
+            SYSTEM_INFO_UNUSED(exception);
+            return false;
+        }
+
+    private:
+        /// @brief Count an event.
+        bool OnEvent()
+        {
+            ++event_count_;
+            return true;
+        }
+
+        /// @brief Handle the end of an object or array, forgetting the keys of its members.
+        bool OnEndContainer()
+        {
+            keys_.resize(containers_.back());
+            containers_.pop_back();
+            return OnEvent();
+        }
+
+        size_t                                      event_count_;  ///< The number of events received.
+        std::vector<std::pair<std::string, size_t>> keys_;         ///< The keys of the members of the open objects, with the event of the last member with each key.
+        std::vector<size_t>                         containers_;   ///< The index in keys_ of the first member of each open container.
+        std::vector<size_t>*                        superseded_;   ///< The key events of the replaced members.
+    };
+
+    /// @brief Hash an object key that is not looked up in the key table.
+    /// @param [in] key The key.
+    /// @return The FNV-1a hash of the key, with the top bit set so it never equals a SaxKey identifier.
+    uint64_t HashMemberKey(std::string_view key)
+    {
+        uint64_t hash = 0xcbf29ce484222325ULL;
+        for (char c : key)
+        {
+            hash = (hash ^ static_cast<uint8_t>(c)) * 0x100000001b3ULL;
+        }
+
+        return hash | (uint64_t{1} << 63);
+    }
+}  // namespace
+
+
+namespace system_info_utils
+{
+    SystemInfoSaxParser::SystemInfoSaxParser()
+        : system_info_(nullptr)
+        , sections_(kSystemInfoSectionAll)
+        , process_count_(0)
+        , process_table_count_(0)
+        , heap_list_begin_(0)
+        , system_node_found_(false)
+        , root_members_parsed_(false)
+        , version_found_(false)
+        , cu_mask_rejected_(false)
+        , process_list_invalid_(false)
+        , error_(SystemInfoParseError::kNone)
+        , event_count_(0)
+        , error_event_(0)
+        , version_event_(0)
+        , process_error_event_(0)
+        , detect_repeats_(false)
+        , repeated_key_found_(false)
+        , next_superseded_(0)
+#ifdef SYSTEM_INFO_ENABLE_PARSE_STATS
+        , parse_stats_(nullptr)
+#endif
+    {
+        // Deep enough for the system info schema, so parsing never grows the stack.
+        frames_.reserve(16);
+        member_ids_.reserve(64);
+    }
+
+    bool SystemInfoSaxParser::Parse(const char* data, size_t size, SystemInfo& system_info, uint32_t sections, SystemInfoParseResult& out_result)
+    {
+        system_info_ = &system_info;
+        sections_    = sections;
+
+        const size_t cpu_count           = system_info.cpus.size();
+        const size_t gpu_count           = system_info.gpus.size();
+        const size_t process_count       = system_info.processes.size();
+        const size_t process_table_count = system_info.process_table.size();
+        saved_version_                   = system_info.version;
+        saved_driver_                    = system_info.driver;
+        saved_devdriver_                 = system_info.devdriver;
+        saved_os_                        = system_info.os;
+
+        FindSkippedValues(data, size);
+        superseded_members_.clear();
+
+        process_count_       = process_count;
+        process_table_count_ = process_table_count;
+        bool result          = Run(data, size, true);
+
+        // Syntax errors fail the DOM based parser too, but a member of the wrong type may be replaced by a later one.
+        if (repeated_key_found_ || (!result && (error_ != SystemInfoParseError::kSyntax)))
+        {
+            FindSupersededMembers(data, size);
+
+            if (repeated_key_found_ || !superseded_members_.empty())
+            {
+                // Parse again from the original structure, skipping the replaced members.
+                system_info.version   = saved_version_;
+                system_info.driver    = saved_driver_;
+                system_info.devdriver = saved_devdriver_;
+                system_info.os        = saved_os_;
+                system_info.cpus.erase(system_info.cpus.begin() + std::min(cpu_count, system_info.cpus.size()), system_info.cpus.end());
+                system_info.gpus.erase(system_info.gpus.begin() + std::min(gpu_count, system_info.gpus.size()), system_info.gpus.end());
+                system_info.processes.erase(system_info.processes.begin() + std::min(process_count, system_info.processes.size()), system_info.processes.end());
+                system_info.process_table.Truncate(std::min(process_table_count, system_info.process_table.size()));
+
+                process_count_       = process_count;
+                process_table_count_ = process_table_count;
+                result               = Run(data, size, false);
+            }
+        }
+
+        system_info_ = nullptr;
+
+        out_result = SystemInfoParseResult();
+        if (!result)
+        {
+            out_result.error = error_;
+            Locate(data, size, out_result);
+        }
+
+        return result;
+    }
+
+    bool SystemInfoSaxParser::Run(const char* data, size_t size, bool detect_repeats)
+    {
+        heap_list_begin_      = 0;
+        system_node_found_    = false;
+        root_members_parsed_  = false;
+        version_found_        = false;
+        cu_mask_rejected_     = false;
+        process_list_invalid_ = false;
+        error_                = SystemInfoParseError::kNone;
+        event_count_          = 0;
+        error_event_          = 0;
+        version_event_        = 0;
+        process_error_event_  = 0;
+        detect_repeats_       = detect_repeats;
+        repeated_key_found_   = false;
+        next_superseded_      = 0;
+        frames_.clear();
+        member_ids_.clear();
+
+        bool result = false;
+        if (skipped_values_.empty())
+        {
+            result = nlohmann::json::sax_parse(data, data + size, this);
+        }
+        else
+        {
+            result = nlohmann::json::sax_parse(SkippingIterator(data, data, skipped_values_, nullptr), SkippingIterator(data, data + size, skipped_values_, nullptr), this);
+        }
+
+        if (result)
+        {
+            result = Finish();
+        }
+        else if (error_ == SystemInfoParseError::kNone)
+        {
+            // Syntax errors are reported by parse_error, so any other rejected event is a member of the wrong type.
+            error_       = SystemInfoParseError::kInvalidType;
+            error_event_ = event_count_;
+        }
+
+        return result;
+    }
+
+#ifdef SYSTEM_INFO_ENABLE_PARSE_STATS
+    void SystemInfoSaxParser::SetParseStats(SystemInfoParseStats* stats)
+    {
+        parse_stats_ = stats;
+    }
+#endif
+
+    bool SystemInfoSaxParser::null()
+    {
+        SaxValue value = {};
+        value.type     = SaxValueType::kNull;
+        return OnValue(value);
+    }
+
+    bool SystemInfoSaxParser::boolean(bool val)
+    {
+        SaxValue value = {};
+        value.type     = SaxValueType::kBoolean;
+        value.boolean  = val;
+        return OnValue(value);
+    }
+
+    bool SystemInfoSaxParser::number_integer(nlohmann::json::number_integer_t val)
+    {
+        SaxValue value       = {};
+        value.type           = SaxValueType::kInteger;
+        value.number_integer = val;
+        return OnValue(value);
+    }
+
+    bool SystemInfoSaxParser::number_unsigned(nlohmann::json::number_unsigned_t val)
+    {
+        SaxValue value        = {};
+        value.type            = SaxValueType::kUnsigned;
+        value.number_unsigned = val;
+        return OnValue(value);
+    }
+
+    bool SystemInfoSaxParser::number_float(nlohmann::json::number_float_t val, const nlohmann::json::string_t& text)
+    {
+        SYSTEM_INFO_UNUSED(text);
+
+        SaxValue value     = {};
+        value.type         = SaxValueType::kFloat;
+        value.number_float = val;
+        return OnValue(value);
+    }
+
+    bool SystemInfoSaxParser::string(nlohmann::json::string_t& val)
+    {
+        SaxValue value = {};
+        value.type     = SaxValueType::kString;
+        value.string   = &val;
+        return OnValue(value);
+    }
+
+    bool SystemInfoSaxParser::binary(nlohmann::json::binary_t& val)
+    {
+        SYSTEM_INFO_UNUSED(val);
+
+        ++event_count_;
+
+        // Binary values only exist in binary formats, which are never used for system info.
+        return false;
+    }
+
+    bool SystemInfoSaxParser::start_object(std::size_t element_count)
+    {
+        SYSTEM_INFO_UNUSED(element_count);
+
+        return OnStartContainer(false);
+    }
+
+    bool SystemInfoSaxParser::key(nlohmann::json::string_t& val)
+    {
+        ++event_count_;
+
+        Frame& frame      = frames_.back();
+        frame.skip_member = false;
+
+        if ((next_superseded_ < superseded_members_.size()) && (superseded_members_[next_superseded_] == event_count_))
+        {
+            // A later member with the same key replaces this one.
+            ++next_superseded_;
+            frame.key         = SaxKey::kUnknown;
+            frame.skip_member = true;
+            return true;
+        }
+
+        switch (frame.node)
+        {
+        case SaxNode::kSkip:
+            break;
+
+        case SaxNode::kCpuList:
+        case SaxNode::kGpuList:
+        case SaxNode::kGpuMemoryExcludedRangeList:
+        case SaxNode::kProcessList:
+            // The members of list objects are processed in order, regardless of their key.
+            if (detect_repeats_ && !AddMember(HashMemberKey(val)))
+            {
+                return false;
+            }
+            break;
+
+        case SaxNode::kGpuMemoryHeapList:
+        {
+            if (detect_repeats_ && !AddMember(HashMemberKey(val)))
+            {
+                return false;
+            }
+
+            // Heaps are keyed by the heap type.
+            HeapInfo heap  = {};
+            heap.heap_type = val;
+            system_info_->gpus.back().memory.heaps.push_back(std::move(heap));
+#ifdef SYSTEM_INFO_ENABLE_PARSE_STATS
+            CountElement(frame.node);
+#endif
+            break;
+        }
+
+        case SaxNode::kRoot:
+        {
+            frame.key = LookupKey(val);
+            if (detect_repeats_ && (frame.key != SaxKey::kUnknown) && !AddMember(static_cast<uint64_t>(frame.key)))
+            {
+                return false;
+            }
+
+            if (system_node_found_)
+            {
+                // Only the members of the 'system' node are used once it has been found.
+                frame.key = SaxKey::kUnknown;
+            }
+            else if (frame.key == SaxKey::kSystem)
+            {
+                // The document wraps the system info, so discard anything parsed from the root node.
+                if (root_members_parsed_)
+                {
+                    *system_info_        = SystemInfo();
+                    process_count_       = 0;
+                    process_table_count_ = 0;
+                }
+
+                system_node_found_ = true;
+                version_found_     = false;
+            }
+            else
+            {
+                switch (frame.key)
+                {
+                case SaxKey::kVersion:
+                case SaxKey::kDevDriver:
+                case SaxKey::kDriver:
+                case SaxKey::kOs:
+                case SaxKey::kCpus:
+                case SaxKey::kGpus:
+                case SaxKey::kProcesses:
+                    root_members_parsed_ = true;
+                    break;
+                default:
+                    break;
+                }
+
+                if (IsSectionSkipped(SaxNode::kSystem, frame.key))
+                {
+                    frame.key = SaxKey::kUnknown;
+                }
+
+                ApplyMemberDefaults(SaxNode::kSystem, frame.key);
+            }
+            break;
+        }
+
+        default:
+            frame.key = LookupKey(val);
+            if (detect_repeats_ && (frame.key != SaxKey::kUnknown) && !AddMember(static_cast<uint64_t>(frame.key)))
+            {
+                return false;
+            }
+
+            // Members of sections that were not requested are skipped like unknown members.
+            if (IsSectionSkipped(frame.node, frame.key))
+            {
+                frame.key = SaxKey::kUnknown;
+            }
+
+            ApplyMemberDefaults(frame.node, frame.key);
+            break;
+        }
+
+        return true;
+    }
+
+    bool SystemInfoSaxParser::end_object()
+    {
+        return OnEndContainer();
+    }
+
+    bool SystemInfoSaxParser::start_array(std::size_t element_count)
+    {
+        SYSTEM_INFO_UNUSED(element_count);
+
+        return OnStartContainer(true);
+    }
+
+    bool SystemInfoSaxParser::end_array()
+    {
+        return OnEndContainer();
+    }
+
+    bool SystemInfoSaxParser::parse_error(std::size_t position, const std::string& last_token, const nlohmann::json::exception& exception)
+    {
+        SYSTEM_INFO_UNUSED(position);
+        SYSTEM_INFO_UNUSED(last_token);
+        SYSTEM_INFO_UNUSED(exception);
+
+        // The error is located by the syntax error when the events are replayed.
+        error_       = SystemInfoParseError::kSyntax;
+        error_event_ = event_count_ + 1;
+
+        return false;
+    }
+
+    bool SystemInfoSaxParser::OnValue(const SaxValue& value)
+    {
+        ++event_count_;
+
+        if (frames_.empty())
+        {
+            // A scalar document contains no system info.
+            return true;
+        }
+
+        const Frame& frame = frames_.back();
+
+        switch (frame.skip_member ? SaxNode::kSkip : frame.node)
+        {
+        case SaxNode::kSkip:
+            return true;
+
+        case SaxNode::kCpuList:
+        case SaxNode::kGpuList:
+        case SaxNode::kGpuMemoryExcludedRangeList:
+        case SaxNode::kProcessList:
+            // Elements that are not objects produce a default initialized entry.
+            AddListElement(frame.node);
+            return true;
+
+        case SaxNode::kGpuMemoryHeapList:
+            // Heaps are keyed by their type, so array elements are invalid.
+            return !frame.is_array;
+
+        case SaxNode::kGpuAsicCuMask:
+            // Each element of the CU mask must be an array of shader array masks.
+            if (!cu_mask_rejected_)
+            {
+                RejectCuMask();
+            }
+            return true;
+
+        case SaxNode::kGpuAsicCuMaskEngine:
+            if (!cu_mask_rejected_)
+            {
+                if (value.type == SaxValueType::kUnsigned)
+                {
+                    system_info_->gpus.back().asic.cu_mask.AddShaderArray(static_cast<uint32_t>(value.number_unsigned));
+                }
+                else
+                {
+                    RejectCuMask();
+                }
+            }
+            return true;
+
+        default:
+            return AssignMember(frame.node, frame.key, value);
+        }
+    }
+
+    bool SystemInfoSaxParser::OnStartContainer(bool is_array)
+    {
+        ++event_count_;
+
+        SaxNode child = SaxNode::kSkip;
+
+        if (frames_.empty())
+        {
+            // Only an object document contains system info.
+            if (!is_array)
+            {
+                child = SaxNode::kRoot;
+            }
+        }
+        else
+        {
+            const Frame& frame = frames_.back();
+
+            switch (frame.skip_member ? SaxNode::kSkip : frame.node)
+            {
+            case SaxNode::kSkip:
+                break;
+
+            case SaxNode::kCpuList:
+            case SaxNode::kGpuList:
+            case SaxNode::kGpuMemoryExcludedRangeList:
+            case SaxNode::kProcessList:
+                child = AddListElement(frame.node);
+                if (is_array)
+                {
+                    child = SaxNode::kSkip;
+                }
+                break;
+
+            case SaxNode::kGpuMemoryHeapList:
+                if (frame.is_array)
+                {
+                    return false;
+                }
+
+                if (!is_array)
+                {
+                    child = SaxNode::kGpuMemoryHeap;
+                }
+                break;
+
+            case SaxNode::kGpuAsicCuMask:
+                if (!cu_mask_rejected_)
+                {
+                    if (is_array)
+                    {
+                        system_info_->gpus.back().asic.cu_mask.AddShaderEngine();
+                        child = SaxNode::kGpuAsicCuMaskEngine;
+                    }
+                    else
+                    {
+                        RejectCuMask();
+                    }
+                }
+                break;
+
+            case SaxNode::kGpuAsicCuMaskEngine:
+                if (!cu_mask_rejected_)
+                {
+                    RejectCuMask();
+                }
+                break;
+
+            default:
+                if (!OpenMember(frame.node, frame.key, is_array, child))
+                {
+                    return false;
+                }
+                break;
+            }
+        }
+
+        frames_.push_back({child, SaxKey::kUnknown, is_array, false, member_ids_.size()});
+
+#ifdef SYSTEM_INFO_ENABLE_PARSE_STATS
+        SystemInfoStatsSection section = SystemInfoStatsSection::kCount;
+        if ((parse_stats_ != nullptr) && GetTimedSection(child, section))
+        {
+            section_start_ = std::chrono::steady_clock::now();
+        }
+#endif
+
+        return true;
+    }
+
+    bool SystemInfoSaxParser::OnEndContainer()
+    {
+        ++event_count_;
+
+        const Frame frame = frames_.back();
+        frames_.pop_back();
+        member_ids_.resize(frame.first_member);
+
+#ifdef SYSTEM_INFO_ENABLE_PARSE_STATS
+        SystemInfoStatsSection section = SystemInfoStatsSection::kCount;
+        if ((parse_stats_ != nullptr) && GetTimedSection(frame.node, section))
+        {
+            const auto elapsed = std::chrono::steady_clock::now() - section_start_;
+            parse_stats_->section_ns[static_cast<size_t>(section)] += std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+        }
+#endif
+
+        switch (frame.node)
+        {
+        case SaxNode::kDriver:
+        {
+            // The major and minor version are not modified if the packaging version cannot be decoded.
+            DriverInfo& driver = system_info_->driver;
+            SystemInfoDecoder::DecodePackagingVersion(driver.packaging_version, driver.packaging_version_major, driver.packaging_version_minor);
+            break;
+        }
+
+        case SaxNode::kGpuMemoryHeapList:
+        {
+            // Heaps are reported in the key order of the JSON object, and a repeated heap type replaces the earlier one.
+            std::vector<HeapInfo>& heaps = system_info_->gpus.back().memory.heaps;
+
+            auto first = heaps.begin() + heap_list_begin_;
+            std::stable_sort(first, heaps.end(), [](const HeapInfo& lhs, const HeapInfo& rhs) { return lhs.heap_type < rhs.heap_type; });
+
+            auto out = first;
+            for (auto iter = first; iter != heaps.end(); ++iter)
+            {
+                auto next = iter + 1;
+                if ((next != heaps.end()) && (next->heap_type == iter->heap_type))
+                {
+                    continue;
+                }
+
+                if (out != iter)
+                {
+                    *out = std::move(*iter);
+                }
+                ++out;
+            }
+            heaps.erase(out, heaps.end());
+            break;
+        }
+
+        case SaxNode::kProcess:
+            if (UseProcessTable() && !system_info_->process_table.Assign(
+                                         system_info_->process_table.size() - 1, pending_process_.name, pending_process_.path, pending_process_.id))
+            {
+                RejectProcessList();
+            }
+            break;
+
+        default:
+            break;
+        }
+
+        return true;
+    }
+
+    bool SystemInfoSaxParser::IsSectionSkipped(SaxNode node, SaxKey key) const
+    {
+        uint32_t section = 0;
+
+        switch (node)
+        {
+        case SaxNode::kSystem:
+            switch (key)
+            {
+            case SaxKey::kDriver:
+            case SaxKey::kDevDriver:
+                section = kSystemInfoSectionDriver;
+                break;
+            case SaxKey::kOs:
+                section = kSystemInfoSectionOs;
+                break;
+            case SaxKey::kCpus:
+                section = kSystemInfoSectionCpus;
+                break;
+            case SaxKey::kGpus:
+                section = kSystemInfoSectionGpus;
+                break;
+            case SaxKey::kProcesses:
+                section = kSystemInfoSectionProcesses | kSystemInfoSectionProcessTable;
+                break;
+            default:
+                break;
+            }
+            break;
+
+        case SaxNode::kOs:
+            if (key == SaxKey::kConfig)
+            {
+                section = kSystemInfoSectionOsConfig;
+            }
+            break;
+
+        case SaxNode::kGpuMemory:
+            if (key == SaxKey::kHeaps)
+            {
+                section = kSystemInfoSectionGpuHeaps;
+            }
+            break;
+
+        default:
+            break;
+        }
+
+        return (section != 0) && ((sections_ & section) == 0);
+    }
+
+    void SystemInfoSaxParser::ApplyMemberDefaults(SaxNode node, SaxKey key)
+    {
+        // Objects that are present in the JSON have all of their fields assigned, using a default for missing members.
+        switch (node)
+        {
+        case SaxNode::kSystem:
+            switch (key)
+            {
+            case SaxKey::kDevDriver:
+                system_info_->devdriver.tag.clear();
+                break;
+            case SaxKey::kDriver:
+            {
+                DriverInfo& driver = system_info_->driver;
+                driver.name.clear();
+                driver.description.clear();
+                driver.software_version.clear();
+                driver.packaging_version.clear();
+                driver.is_closed_source = false;
+                break;
+            }
+            case SaxKey::kOs:
+                system_info_->os.name.clear();
+                system_info_->os.desc.clear();
+                system_info_->os.hostname.clear();
+                break;
+            default:
+                break;
+            }
+            break;
+
+        case SaxNode::kDevDriver:
+            if (key == SaxKey::kVersion)
+            {
+                system_info_->devdriver.major_version = 0;
+            }
+            break;
+
+        case SaxNode::kOs:
+            if (key == SaxKey::kMemory)
+            {
+                OsMemoryInfo& memory = system_info_->os.memory;
+                memory.physical      = 0;
+                memory.swap          = 0;
+                memory.type.clear();
+            }
+            break;
+
+        case SaxNode::kOsConfig:
+            if (key == SaxKey::kLinux)
+            {
+                system_info_->os.config.power_dpm_writable = false;
+            }
+            break;
+
+        case SaxNode::kOsConfigLinux:
+            if (key == SaxKey::kDrm)
+            {
+                system_info_->os.config.drm_major_version = 0;
+                system_info_->os.config.drm_minor_version = 0;
+            }
+            break;
+
+        case SaxNode::kOsConfigWindows:
+            if (key == SaxKey::kEtwSupport)
+            {
+                system_info_->os.config.etw_support_info = {};
+            }
+            break;
+
+        case SaxNode::kCpu:
+            if (key == SaxKey::kSpeed)
+            {
+                system_info_->cpus.back().max_clock_speed = 0;
+            }
+            break;
+
+        case SaxNode::kGpu:
+        {
+            GpuInfo& gpu = system_info_->gpus.back();
+            switch (key)
+            {
+            case SaxKey::kPci:
+                gpu.pci = {};
+                break;
+            case SaxKey::kAsic:
+                gpu.asic.gpu_index                    = static_cast<uint32_t>(-1);
+                gpu.asic.gpu_counter_freq             = 0;
+                gpu.asic.num_shader_engines           = 0;
+                gpu.asic.num_shader_arrays_per_engine = 0;
+                gpu.asic.num_cus                      = 0;
+                break;
+            case SaxKey::kMemory:
+                gpu.memory.type.clear();
+                gpu.memory.mem_ops_per_clock = 0;
+                gpu.memory.bus_bit_width     = 0;
+                gpu.memory.bandwidth         = 0;
+                break;
+            case SaxKey::kBigSw:
+                gpu.big_sw = {};
+                break;
+            default:
+                break;
+            }
+            break;
+        }
+
+        case SaxNode::kGpuAsic:
+            if (key == SaxKey::kAsicEngineClockSpeed)
+            {
+                system_info_->gpus.back().asic.engine_clock_hz = {};
+            }
+            else if (key == SaxKey::kAsicIds)
+            {
+                system_info_->gpus.back().asic.id_info = {};
+            }
+            break;
+
+        case SaxNode::kGpuMemory:
+            if (key == SaxKey::kMemoryClockSpeed)
+            {
+                system_info_->gpus.back().memory.mem_clock_hz = {};
+            }
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    bool SystemInfoSaxParser::OpenMember(SaxNode node, SaxKey key, bool is_array, SaxNode& child)
+    {
+        // Object members are ignored when they are arrays, and scalar members are invalid when they are containers.
+        const auto object = [is_array](SaxNode object_node) { return is_array ? SaxNode::kSkip : object_node; };
+
+        child = SaxNode::kSkip;
+
+        if (node == SaxNode::kRoot)
+        {
+            if (key == SaxKey::kSystem)
+            {
+                child = object(SaxNode::kSystem);
+                return true;
+            }
+
+            node = SaxNode::kSystem;
+        }
+
+        switch (node)
+        {
+        case SaxNode::kSystem:
+            switch (key)
+            {
+            case SaxKey::kVersion:
+                if (is_array)
+                {
+                    return false;
+                }
+
+                version_found_              = true;
+                system_info_->version.major = 2;
+                system_info_->version.minor = 0;
+                system_info_->version.patch = 0;
+                system_info_->version.build = 0;
+                child                       = SaxNode::kVersion;
+                break;
+            case SaxKey::kDevDriver:
+                child = object(SaxNode::kDevDriver);
+                break;
+            case SaxKey::kDriver:
+                child = object(SaxNode::kDriver);
+                break;
+            case SaxKey::kOs:
+                child = object(SaxNode::kOs);
+                break;
+            case SaxKey::kCpus:
+                child = SaxNode::kCpuList;
+                break;
+            case SaxKey::kGpus:
+                child = SaxNode::kGpuList;
+                break;
+            case SaxKey::kProcesses:
+                child = SaxNode::kProcessList;
+                break;
+            default:
+                break;
+            }
+            return true;
+
+        case SaxNode::kVersion:
+        case SaxNode::kDevDriverVersion:
+        case SaxNode::kOsConfigDrm:
+        case SaxNode::kGpuBigSw:
+            switch (key)
+            {
+            case SaxKey::kMajor:
+            case SaxKey::kMinor:
+            case SaxKey::kPatch:
+            case SaxKey::kBuild:
+            case SaxKey::kMisc:
+                return false;
+            default:
+                return true;
+            }
+
+        case SaxNode::kDevDriver:
+            switch (key)
+            {
+            case SaxKey::kVersion:
+                child = object(SaxNode::kDevDriverVersion);
+                return true;
+            case SaxKey::kTag:
+                return false;
+            default:
+                return true;
+            }
+
+        case SaxNode::kDriver:
+            switch (key)
+            {
+            case SaxKey::kName:
+            case SaxKey::kDescription:
+            case SaxKey::kDriverSoftwareVersion:
+            case SaxKey::kDriverPackagingVersion:
+            case SaxKey::kIsClosedSource:
+                return false;
+            default:
+                return true;
+            }
+
+        case SaxNode::kOs:
+            switch (key)
+            {
+            case SaxKey::kMemory:
+                child = object(SaxNode::kOsMemory);
+                return true;
+            case SaxKey::kConfig:
+                child = object(SaxNode::kOsConfig);
+                return true;
+            case SaxKey::kName:
+            case SaxKey::kDescription:
+            case SaxKey::kHostName:
+                return false;
+            default:
+                return true;
+            }
+
+        case SaxNode::kOsMemory:
+            switch (key)
+            {
+            case SaxKey::kMemoryPhysical:
+            case SaxKey::kMemorySwap:
+            case SaxKey::kName:
+                return false;
+            default:
+                return true;
+            }
+
+        case SaxNode::kOsConfig:
+            switch (key)
+            {
+            case SaxKey::kLinux:
+                child = object(SaxNode::kOsConfigLinux);
+                return true;
+            case SaxKey::kWindows:
+                child = object(SaxNode::kOsConfigWindows);
+                return true;
+            default:
+                return true;
+            }
+
+        case SaxNode::kOsConfigLinux:
+            switch (key)
+            {
+            case SaxKey::kDrm:
+                child = object(SaxNode::kOsConfigDrm);
+                return true;
+            case SaxKey::kPowerDpmWritable:
+                return false;
+            default:
+                return true;
+            }
+
+        case SaxNode::kOsConfigWindows:
+            if (key == SaxKey::kEtwSupport)
+            {
+                child = object(SaxNode::kOsConfigEtw);
+            }
+            return true;
+
+        case SaxNode::kOsConfigEtw:
+            switch (key)
+            {
+            case SaxKey::kSupported:
+            case SaxKey::kHasPermission:
+            case SaxKey::kStatusCode:
+            case SaxKey::kEtwRegistryOrUserGroup:
+                return false;
+            default:
+                return true;
+            }
+
+        case SaxNode::kCpu:
+            switch (key)
+            {
+            case SaxKey::kSpeed:
+                child = object(SaxNode::kCpuSpeed);
+                return true;
+            case SaxKey::kName:
+            case SaxKey::kArchitecture:
+            case SaxKey::kCpuId:
+            case SaxKey::kCpuDeviceId:
+            case SaxKey::kCpuVendorId:
+            case SaxKey::kCpuLogicalCoreCount:
+            case SaxKey::kCpuPhysicalCoreCount:
+            case SaxKey::kVirtualization:
+            case SaxKey::kCpuTimeClockFreq:
+                return false;
+            default:
+                return true;
+            }
+
+        case SaxNode::kCpuSpeed:
+            return key != SaxKey::kMax;
+
+        case SaxNode::kGpu:
+            switch (key)
+            {
+            case SaxKey::kPci:
+                child = object(SaxNode::kGpuPci);
+                return true;
+            case SaxKey::kAsic:
+                child = object(SaxNode::kGpuAsic);
+                return true;
+            case SaxKey::kMemory:
+                child = object(SaxNode::kGpuMemory);
+                return true;
+            case SaxKey::kBigSw:
+                child = object(SaxNode::kGpuBigSw);
+                return true;
+            case SaxKey::kName:
+                return false;
+            default:
+                return true;
+            }
+
+        case SaxNode::kGpuPci:
+            switch (key)
+            {
+            case SaxKey::kPciBus:
+            case SaxKey::kDevice:
+            case SaxKey::kPciFunction:
+                return false;
+            default:
+                return true;
+            }
+
+        case SaxNode::kGpuAsic:
+            switch (key)
+            {
+            case SaxKey::kAsicCuMask:
+                // The CU mask is only parsed when it is an array.
+                if (is_array)
+                {
+                    cu_mask_rejected_ = false;
+                    child             = SaxNode::kGpuAsicCuMask;
+                }
+                return true;
+            case SaxKey::kAsicEngineClockSpeed:
+                child = object(SaxNode::kGpuAsicEngineClock);
+                return true;
+            case SaxKey::kAsicIds:
+                child = object(SaxNode::kGpuAsicIds);
+                return true;
+            case SaxKey::kAsicGpuIndex:
+            case SaxKey::kAsicGpuCounterFrequency:
+            case SaxKey::kAsicNumSe:
+            case SaxKey::kAsicNumSaPerSe:
+            case SaxKey::kAsicNumCus:
+                return false;
+            default:
+                return true;
+            }
+
+        case SaxNode::kGpuAsicEngineClock:
+        case SaxNode::kGpuMemoryClock:
+            return (key != SaxKey::kMin) && (key != SaxKey::kMax);
+
+        case SaxNode::kGpuAsicIds:
+            switch (key)
+            {
+            case SaxKey::kAsicGfxEngine:
+            case SaxKey::kAsicFamily:
+            case SaxKey::kAsicERev:
+            case SaxKey::kAsicRevision:
+            case SaxKey::kDevice:
+            case SaxKey::kAsicSubsystem:
+            case SaxKey::kAsicVendor:
+            case SaxKey::kAsicLuid:
+                return false;
+            default:
+                return true;
+            }
+
+        case SaxNode::kGpuMemory:
+            switch (key)
+            {
+            case SaxKey::kMemoryClockSpeed:
+                child = object(SaxNode::kGpuMemoryClock);
+                return true;
+            case SaxKey::kHeaps:
+                heap_list_begin_ = system_info_->gpus.back().memory.heaps.size();
+                child            = SaxNode::kGpuMemoryHeapList;
+                return true;
+            case SaxKey::kExcludedVaRanges:
+                child = SaxNode::kGpuMemoryExcludedRangeList;
+                return true;
+            case SaxKey::kType:
+            case SaxKey::kMemoryOpsPerClock:
+            case SaxKey::kMemoryBusBitWidth:
+            case SaxKey::kMemoryBandwith:
+                return false;
+            default:
+                return true;
+            }
+
+        case SaxNode::kGpuMemoryHeap:
+            return (key != SaxKey::kPhysicalAddress) && (key != SaxKey::kSize);
+
+        case SaxNode::kGpuMemoryExcludedRange:
+            return (key != SaxKey::kBase) && (key != SaxKey::kSize);
+
+        case SaxNode::kProcess:
+            switch (key)
+            {
+            case SaxKey::kName:
+            case SaxKey::kPath:
+            case SaxKey::kProcessId:
+                // The process list is only validated if the chunk version includes it.
+                RejectProcessList();
+                return true;
+            default:
+                return true;
+            }
+
+        default:
+            return true;
+        }
+    }
+
+    bool SystemInfoSaxParser::AssignMember(SaxNode node, SaxKey key, const SaxValue& value)
+    {
+        if (node == SaxNode::kRoot)
+        {
+            if (key == SaxKey::kSystem)
+            {
+                // A 'system' node that is not an object contains no system info.
+                return true;
+            }
+
+            node = SaxNode::kSystem;
+        }
+
+        switch (node)
+        {
+        case SaxNode::kSystem:
+            switch (key)
+            {
+            case SaxKey::kVersion:
+                version_found_ = true;
+                version_event_ = event_count_;
+                return AssignArithmetic(value, system_info_->version.major);
+            case SaxKey::kCpus:
+            case SaxKey::kGpus:
+            case SaxKey::kProcesses:
+                // A scalar list is treated as a list containing that single element.
+                if (value.type != SaxValueType::kNull)
+                {
+                    AddListElement((key == SaxKey::kCpus) ? SaxNode::kCpuList : ((key == SaxKey::kGpus) ? SaxNode::kGpuList : SaxNode::kProcessList));
+                }
+                return true;
+            default:
+                return true;
+            }
+
+        case SaxNode::kVersion:
+            switch (key)
+            {
+            case SaxKey::kMajor:
+                version_event_ = event_count_;
+                return AssignArithmetic(value, system_info_->version.major);
+            case SaxKey::kMinor:
+                return AssignArithmetic(value, system_info_->version.minor);
+            case SaxKey::kPatch:
+                return AssignArithmetic(value, system_info_->version.patch);
+            case SaxKey::kBuild:
+                return AssignArithmetic(value, system_info_->version.build);
+            default:
+                return true;
+            }
+
+        case SaxNode::kDevDriver:
+            if (key == SaxKey::kTag)
+            {
+                return AssignString(value, system_info_->devdriver.tag);
+            }
+            return true;
+
+        case SaxNode::kDevDriverVersion:
+            if (key == SaxKey::kMajor)
+            {
+                return AssignArithmetic(value, system_info_->devdriver.major_version);
+            }
+            return true;
+
+        case SaxNode::kDriver:
+        {
+            DriverInfo& driver = system_info_->driver;
+            switch (key)
+            {
+            case SaxKey::kName:
+                return AssignString(value, driver.name);
+            case SaxKey::kDescription:
+                return AssignString(value, driver.description);
+            case SaxKey::kDriverSoftwareVersion:
+                return AssignString(value, driver.software_version);
+            case SaxKey::kDriverPackagingVersion:
+                return AssignString(value, driver.packaging_version);
+            case SaxKey::kIsClosedSource:
+                return AssignBoolean(value, driver.is_closed_source);
+            default:
+                return true;
+            }
+        }
+
+        case SaxNode::kOs:
+        {
+            OsInfo& os = system_info_->os;
+            switch (key)
+            {
+            case SaxKey::kName:
+                return AssignString(value, os.name);
+            case SaxKey::kDescription:
+                return AssignString(value, os.desc);
+            case SaxKey::kHostName:
+                return AssignString(value, os.hostname);
+            default:
+                return true;
+            }
+        }
+
+        case SaxNode::kOsMemory:
+        {
+            OsMemoryInfo& memory = system_info_->os.memory;
+            switch (key)
+            {
+            case SaxKey::kMemoryPhysical:
+                return AssignArithmetic(value, memory.physical);
+            case SaxKey::kMemorySwap:
+                return AssignArithmetic(value, memory.swap);
+            case SaxKey::kName:
+                return AssignString(value, memory.type);
+            default:
+                return true;
+            }
+        }
+
+        case SaxNode::kOsConfigLinux:
+            if (key == SaxKey::kPowerDpmWritable)
+            {
+                return AssignBoolean(value, system_info_->os.config.power_dpm_writable);
+            }
+            return true;
+
+        case SaxNode::kOsConfigDrm:
+            switch (key)
+            {
+            case SaxKey::kMajor:
+                return AssignArithmetic(value, system_info_->os.config.drm_major_version);
+            case SaxKey::kMinor:
+                return AssignArithmetic(value, system_info_->os.config.drm_minor_version);
+            default:
+                return true;
+            }
+
+        case SaxNode::kOsConfigEtw:
+        {
+            EtwSupportInfo& etw_info = system_info_->os.config.etw_support_info;
+            switch (key)
+            {
+            case SaxKey::kSupported:
+                return AssignBoolean(value, etw_info.is_supported);
+            case SaxKey::kHasPermission:
+                return AssignBoolean(value, etw_info.has_permission);
+            case SaxKey::kStatusCode:
+            {
+                unsigned long status_code = 0;
+                if (!AssignArithmetic(value, status_code))
+                {
+                    return false;
+                }
+                etw_info.status_code = static_cast<uint32_t>(status_code);
+                return true;
+            }
+            case SaxKey::kEtwRegistryOrUserGroup:
+                return AssignBoolean(value, etw_info.needs_rgp_registry_or_usergroup);
+            default:
+                return true;
+            }
+        }
+
+        case SaxNode::kCpu:
+        {
+            CpuInfo& cpu = system_info_->cpus.back();
+            switch (key)
+            {
+            case SaxKey::kName:
+                return AssignString(value, cpu.name);
+            case SaxKey::kArchitecture:
+                return AssignString(value, cpu.architecture);
+            case SaxKey::kCpuId:
+                return AssignString(value, cpu.cpu_id);
+            case SaxKey::kCpuDeviceId:
+                return AssignString(value, cpu.device_id);
+            case SaxKey::kCpuVendorId:
+                return AssignString(value, cpu.vendor_id);
+            case SaxKey::kCpuLogicalCoreCount:
+                return AssignArithmetic(value, cpu.num_logical_cores);
+            case SaxKey::kCpuPhysicalCoreCount:
+                return AssignArithmetic(value, cpu.num_physical_cores);
+            case SaxKey::kVirtualization:
+                return AssignString(value, cpu.virtualization);
+            case SaxKey::kCpuTimeClockFreq:
+                return AssignArithmetic(value, cpu.timestamp_clock_frequency);
+            default:
+                return true;
+            }
+        }
+
+        case SaxNode::kCpuSpeed:
+            if (key == SaxKey::kMax)
+            {
+                return AssignArithmetic(value, system_info_->cpus.back().max_clock_speed);
+            }
+            return true;
+
+        case SaxNode::kGpu:
+            if (key == SaxKey::kName)
+            {
+                return AssignString(value, system_info_->gpus.back().name);
+            }
+            return true;
+
+        case SaxNode::kGpuPci:
+        {
+            PciInfo& pci = system_info_->gpus.back().pci;
+            switch (key)
+            {
+            case SaxKey::kPciBus:
+                return AssignArithmetic(value, pci.bus);
+            case SaxKey::kDevice:
+                return AssignArithmetic(value, pci.device);
+            case SaxKey::kPciFunction:
+                return AssignArithmetic(value, pci.function);
+            default:
+                return true;
+            }
+        }
+
+        case SaxNode::kGpuAsic:
+        {
+            AsicInfo& asic = system_info_->gpus.back().asic;
+            switch (key)
+            {
+            case SaxKey::kAsicGpuIndex:
+                return AssignArithmetic(value, asic.gpu_index);
+            case SaxKey::kAsicGpuCounterFrequency:
+                return AssignArithmetic(value, asic.gpu_counter_freq);
+            case SaxKey::kAsicNumSe:
+                return AssignArithmetic(value, asic.num_shader_engines);
+            case SaxKey::kAsicNumSaPerSe:
+                return AssignArithmetic(value, asic.num_shader_arrays_per_engine);
+            case SaxKey::kAsicNumCus:
+                return AssignArithmetic(value, asic.num_cus);
+            default:
+                return true;
+            }
+        }
+
+        case SaxNode::kGpuAsicEngineClock:
+        case SaxNode::kGpuMemoryClock:
+        {
+            GpuInfo&   gpu        = system_info_->gpus.back();
+            ClockInfo& clock_info = (node == SaxNode::kGpuAsicEngineClock) ? gpu.asic.engine_clock_hz : gpu.memory.mem_clock_hz;
+            switch (key)
+            {
+            case SaxKey::kMin:
+                return AssignArithmetic(value, clock_info.min);
+            case SaxKey::kMax:
+                return AssignArithmetic(value, clock_info.max);
+            default:
+                return true;
+            }
+        }
+
+        case SaxNode::kGpuAsicIds:
+        {
+            IdInfo& id_info = system_info_->gpus.back().asic.id_info;
+            switch (key)
+            {
+            case SaxKey::kAsicGfxEngine:
+                return AssignArithmetic(value, id_info.gfx_engine);
+            case SaxKey::kAsicFamily:
+                return AssignArithmetic(value, id_info.family);
+            case SaxKey::kAsicERev:
+                return AssignArithmetic(value, id_info.e_rev);
+            case SaxKey::kAsicRevision:
+                return AssignArithmetic(value, id_info.revision);
+            case SaxKey::kDevice:
+                return AssignArithmetic(value, id_info.device);
+            case SaxKey::kAsicSubsystem:
+                return AssignArithmetic(value, id_info.subsystem);
+            case SaxKey::kAsicVendor:
+                return AssignArithmetic(value, id_info.vendor);
+            case SaxKey::kAsicLuid:
+                if (value.type != SaxValueType::kString)
+                {
+                    return false;
+                }
+                // Malformed LUIDs decode to zero, which is not a valid LUID.
+                SystemInfoDecoder::DecodeLuid(*value.string, id_info.luid);
+                return true;
+            default:
+                return true;
+            }
+        }
+
+        case SaxNode::kGpuMemory:
+        {
+            MemoryInfo& memory = system_info_->gpus.back().memory;
+            switch (key)
+            {
+            case SaxKey::kType:
+                return AssignString(value, memory.type);
+            case SaxKey::kMemoryOpsPerClock:
+                return AssignArithmetic(value, memory.mem_ops_per_clock);
+            case SaxKey::kMemoryBusBitWidth:
+                return AssignArithmetic(value, memory.bus_bit_width);
+            case SaxKey::kMemoryBandwith:
+                return AssignArithmetic(value, memory.bandwidth);
+            case SaxKey::kHeaps:
+                // Heaps are keyed by their type, so only an object (or nothing) is valid.
+                return value.type == SaxValueType::kNull;
+            case SaxKey::kExcludedVaRanges:
+                if (value.type != SaxValueType::kNull)
+                {
+                    AddListElement(SaxNode::kGpuMemoryExcludedRangeList);
+                }
+                return true;
+            default:
+                return true;
+            }
+        }
+
+        case SaxNode::kGpuMemoryHeap:
+        {
+            HeapInfo& heap = system_info_->gpus.back().memory.heaps.back();
+            switch (key)
+            {
+            case SaxKey::kPhysicalAddress:
+                return AssignArithmetic(value, heap.phys_addr);
+            case SaxKey::kSize:
+                return AssignArithmetic(value, heap.size);
+            default:
+                return true;
+            }
+        }
+
+        case SaxNode::kGpuMemoryExcludedRange:
+        {
+            ExcludedRangeInfo& range = system_info_->gpus.back().memory.excluded_va_ranges.back();
+            switch (key)
+            {
+            case SaxKey::kBase:
+                return AssignArithmetic(value, range.base);
+            case SaxKey::kSize:
+                return AssignArithmetic(value, range.size);
+            default:
+                return true;
+            }
+        }
+
+        case SaxNode::kGpuBigSw:
+        {
+            SoftwareVersion& big_sw = system_info_->gpus.back().big_sw;
+            switch (key)
+            {
+            case SaxKey::kMajor:
+                return AssignArithmetic(value, big_sw.major);
+            case SaxKey::kMinor:
+                return AssignArithmetic(value, big_sw.minor);
+            case SaxKey::kMisc:
+                return AssignArithmetic(value, big_sw.misc);
+            default:
+                return true;
+            }
+        }
+
+        case SaxNode::kProcess:
+        {
+            // Processes stored in the table are collected here and added once their object ends.
+            Process& process = UseProcessTable() ? pending_process_ : system_info_->processes.back();
+            bool     result  = true;
+            switch (key)
+            {
+            case SaxKey::kName:
+                result = AssignString(value, process.name);
+                break;
+            case SaxKey::kPath:
+                result = AssignString(value, process.path);
+                break;
+            case SaxKey::kProcessId:
+                result = AssignArithmetic(value, process.id);
+                break;
+            default:
+                break;
+            }
+
+            // The process list is only validated if the chunk version includes it.
+            if (!result)
+            {
+                RejectProcessList();
+            }
+            return true;
+        }
+
+        default:
+            return true;
+        }
+    }
+
+    SaxNode SystemInfoSaxParser::AddListElement(SaxNode node)
+    {
+#ifdef SYSTEM_INFO_ENABLE_PARSE_STATS
+        CountElement(node);
+#endif
+
+        switch (node)
+        {
+        case SaxNode::kCpuList:
+            system_info_->cpus.emplace_back();
+            return SaxNode::kCpu;
+        case SaxNode::kGpuList:
+            system_info_->gpus.emplace_back();
+            return SaxNode::kGpu;
+        case SaxNode::kGpuMemoryExcludedRangeList:
+            system_info_->gpus.back().memory.excluded_va_ranges.emplace_back();
+            return SaxNode::kGpuMemoryExcludedRange;
+        case SaxNode::kProcessList:
+            if (UseProcessTable())
+            {
+                // Elements that are not objects keep the default initialized entry.
+                pending_process_.name.clear();
+                pending_process_.path.clear();
+                pending_process_.id = 0;
+                if (!system_info_->process_table.Add(std::string_view(), std::string_view(), 0))
+                {
+                    RejectProcessList();
+                }
+            }
+            else
+            {
+                system_info_->processes.emplace_back();
+            }
+            return SaxNode::kProcess;
+        default:
+            return SaxNode::kSkip;
+        }
+    }
+
+#ifdef SYSTEM_INFO_ENABLE_PARSE_STATS
+    void SystemInfoSaxParser::CountElement(SaxNode node)
+    {
+        if (parse_stats_ == nullptr)
+        {
+            return;
+        }
+
+        SystemInfoStatsSection section = SystemInfoStatsSection::kGpus;
+        switch (node)
+        {
+        case SaxNode::kCpuList:
+            section = SystemInfoStatsSection::kCpus;
+            break;
+        case SaxNode::kGpuList:
+        case SaxNode::kGpuMemoryHeapList:
+        case SaxNode::kGpuMemoryExcludedRangeList:
+            section = SystemInfoStatsSection::kGpus;
+            break;
+        case SaxNode::kProcessList:
+            section = SystemInfoStatsSection::kProcesses;
+            break;
+        default:
+            return;
+        }
+
+        ++parse_stats_->section_elements[static_cast<size_t>(section)];
+    }
+#endif
+
+    void SystemInfoSaxParser::RejectCuMask()
+    {
+        system_info_->gpus.back().asic.cu_mask.Clear();
+        cu_mask_rejected_ = true;
+    }
+
+    void SystemInfoSaxParser::RejectProcessList()
+    {
+        if (!process_list_invalid_)
+        {
+            process_list_invalid_ = true;
+            process_error_event_  = event_count_;
+        }
+    }
+
+    void SystemInfoSaxParser::FindSkippedValues(const char* data, size_t size)
+    {
+        constexpr SaxKey kSectionKeys[] = {SaxKey::kDriver, SaxKey::kDevDriver, SaxKey::kOs, SaxKey::kCpus, SaxKey::kGpus, SaxKey::kProcesses};
+
+        skipped_values_.clear();
+
+        // Most parses select every top-level section, and then there is nothing to scan for.
+        bool any_skipped = false;
+        for (SaxKey key : kSectionKeys)
+        {
+            any_skipped = any_skipped || IsSectionSkipped(SaxNode::kSystem, key);
+        }
+
+        if (!any_skipped || !scanner_.Scan(data, size))
+        {
+            return;
+        }
+
+        // Members of the root node are matched too, since unwrapped documents keep the system info there.
+        const auto add_skipped = [this, data](const std::vector<SystemInfoNodeRange>& nodes) {
+            for (const SystemInfoNodeRange& node : nodes)
+            {
+                const bool is_container = (node.end - node.begin > 2) && (((data[node.begin] == '[') && (data[node.end - 1] == ']')) ||
+                                                                          ((data[node.begin] == '{') && (data[node.end - 1] == '}')));
+                if (is_container && IsSectionSkipped(SaxNode::kSystem, LookupKey(node.key)))
+                {
+                    skipped_values_.push_back({node.begin + 1, node.end - 1});
+                }
+            }
+        };
+
+        add_skipped(scanner_.GetRootNodes());
+        if (scanner_.IsSystemNodeFound())
+        {
+            add_skipped(scanner_.GetSystemNodes());
+            std::sort(skipped_values_.begin(), skipped_values_.end(), [](const SaxSkipRange& a, const SaxSkipRange& b) { return a.begin < b.begin; });
+        }
+
+        // A skipped value must still be valid JSON. If one is not, nothing is skipped, so the parser reports the same error as a full parse.
+        for (const SaxSkipRange& skipped : skipped_values_)
+        {
+            if (!SystemInfoScanner::Validate(data + skipped.begin - 1, skipped.end - skipped.begin + 2))
+            {
+                skipped_values_.clear();
+                break;
+            }
+        }
+    }
+
+    bool SystemInfoSaxParser::AddMember(uint64_t id)
+    {
+        // Objects have few members, so they are searched linearly.
+        for (size_t index = frames_.back().first_member; index < member_ids_.size(); ++index)
+        {
+            if (member_ids_[index] == id)
+            {
+                repeated_key_found_ = true;
+                return false;
+            }
+        }
+
+        member_ids_.push_back(id);
+        return true;
+    }
+
+    void SystemInfoSaxParser::FindSupersededMembers(const char* data, size_t size)
+    {
+        SaxRepeatedKeyFinder finder;
+        finder.Run(data, size, skipped_values_, superseded_members_);
+    }
+
+    bool SystemInfoSaxParser::Finish()
+    {
+        if (!version_found_)
+        {
+            system_info_->version.major = 1;
+        }
+
+        switch (system_info_->version.major)
+        {
+        case 1:
+            // Version 1 does not include the process list.
+            system_info_->processes.erase(system_info_->processes.begin() + process_count_, system_info_->processes.end());
+            system_info_->process_table.Truncate(process_table_count_);
+            return true;
+        case 2:
+            if (process_list_invalid_)
+            {
+                error_       = SystemInfoParseError::kInvalidType;
+                error_event_ = process_error_event_;
+                return false;
+            }
+            return true;
+        default:
+            error_       = SystemInfoParseError::kUnsupportedVersion;
+            error_event_ = version_event_;
+            return false;
+        }
+    }
+
+    void SystemInfoSaxParser::Locate(const char* data, size_t size, SystemInfoParseResult& result) const
+    {
+        SaxLocator locator(error_event_);
+        locator.Run(data, size, skipped_values_, result.offset, result.pointer);
+    }
+}  // namespace system_info_utils
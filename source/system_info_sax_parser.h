@@ -0,0 +1,403 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief System info SAX parser definition
+///
+/// The SAX parser populates the system info structures directly from the JSON
+/// token stream, without building an intermediate nlohmann::json DOM.
+//=============================================================================
+
+#ifndef SYSTEM_INFO_UTILS_SOURCE_SYSTEM_INFO_SAX_PARSER_H_
+#define SYSTEM_INFO_UTILS_SOURCE_SYSTEM_INFO_SAX_PARSER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifdef SYSTEM_INFO_ENABLE_PARSE_STATS
+#include <chrono>
+#endif
+
+#include "json.hpp"
+
+#include "system_info_reader.h"
+#include "system_info_scanner.h"
+
+namespace system_info_utils
+{
+    /// @brief The interior of a container value that the lexer skips, so the parser sees an empty container.
+    struct SaxSkipRange
+    {
+        size_t begin;  ///< The byte offset of the first character after the opening bracket.
+        size_t end;    ///< The byte offset of the closing bracket.
+    };
+
+    /// @brief The JSON object keys recognized by the SAX parser.
+    enum class SaxKey : uint8_t
+    {
+        kUnknown,
+        kSystem,
+        kDriver,
+        kName,
+        kDescription,
+        kVersion,
+        kDriverPackagingVersion,
+        kDriverSoftwareVersion,
+        kOs,
+        kVirtualization,
+        kType,
+        kHostName,
+        kMemory,
+        kMemoryPhysical,
+        kMemorySwap,
+        kCpus,
+        kProcesses,
+        kProcessId,
+        kPath,
+        kArchitecture,
+        kCpuVendorId,
+        kCpuTimeClockFreq,
+        kCpuPhysicalCoreCount,
+        kCpuLogicalCoreCount,
+        kSpeed,
+        kCpuId,
+        kCpuDeviceId,
+        kGpus,
+        kPci,
+        kPciBus,
+        kDevice,
+        kPciFunction,
+        kAsic,
+        kAsicGpuIndex,
+        kAsicGpuCounterFrequency,
+        kAsicNumSe,
+        kAsicNumSaPerSe,
+        kAsicCuMask,
+        kAsicNumCus,
+        kAsicEngineClockSpeed,
+        kMin,
+        kMax,
+        kAsicIds,
+        kAsicGfxEngine,
+        kAsicFamily,
+        kAsicERev,
+        kAsicRevision,
+        kAsicSubsystem,
+        kAsicVendor,
+        kAsicLuid,
+        kMemoryOpsPerClock,
+        kMemoryBusBitWidth,
+        kMemoryBandwith,
+        kMemoryClockSpeed,
+        kHeaps,
+        kPhysicalAddress,
+        kSize,
+        kExcludedVaRanges,
+        kBase,
+        kBigSw,
+        kMajor,
+        kMinor,
+        kPatch,
+        kBuild,
+        kMisc,
+        kConfig,
+        kDrm,
+        kIsClosedSource,
+        kEtwSupport,
+        kSupported,
+        kEtwRegistryOrUserGroup,
+        kHasPermission,
+        kStatusCode,
+        kPowerDpmWritable,
+        kDevDriver,
+        kTag,
+        kLinux,
+        kWindows
+    };
+
+    /// @brief The JSON nodes the SAX parser can be positioned in.
+    ///
+    /// Each node identifies the structure that values are written to, so no
+    /// target pointers need to be kept on the parser stack.
+    enum class SaxNode : uint8_t
+    {
+        kSkip,  ///< A node whose contents are ignored.
+        kRoot,
+        kSystem,
+        kVersion,
+        kDevDriver,
+        kDevDriverVersion,
+        kDriver,
+        kOs,
+        kOsMemory,
+        kOsConfig,
+        kOsConfigLinux,
+        kOsConfigDrm,
+        kOsConfigWindows,
+        kOsConfigEtw,
+        kCpuList,
+        kCpu,
+        kCpuSpeed,
+        kGpuList,
+        kGpu,
+        kGpuPci,
+        kGpuAsic,
+        kGpuAsicCuMask,
+        kGpuAsicCuMaskEngine,
+        kGpuAsicEngineClock,
+        kGpuAsicIds,
+        kGpuMemory,
+        kGpuMemoryClock,
+        kGpuMemoryHeapList,
+        kGpuMemoryHeap,
+        kGpuMemoryExcludedRangeList,
+        kGpuMemoryExcludedRange,
+        kGpuBigSw,
+        kProcessList,
+        kProcess
+    };
+
+    /// @brief The type of a scalar JSON value.
+    enum class SaxValueType : uint8_t
+    {
+        kNull,
+        kBoolean,
+        kInteger,
+        kUnsigned,
+        kFloat,
+        kString
+    };
+
+    /// @brief A scalar JSON value as reported by the SAX interface.
+    struct SaxValue
+    {
+        SaxValueType                      type;             ///< The type of the value.
+        bool                              boolean;          ///< The value when type is kBoolean.
+        nlohmann::json::number_integer_t  number_integer;   ///< The value when type is kInteger.
+        nlohmann::json::number_unsigned_t number_unsigned;  ///< The value when type is kUnsigned.
+        nlohmann::json::number_float_t    number_float;     ///< The value when type is kFloat.
+        const nlohmann::json::string_t*   string;           ///< The value when type is kString.
+    };
+
+    /// @brief Parses the system info JSON representation using the nlohmann::json SAX interface.
+    ///
+    /// The output matches the DOM based parser: fields are assigned as the tokens
+    /// arrive, and the chunk version (which may appear anywhere in the system node)
+    /// is applied once the whole document has been consumed. Version 1 chunks ignore
+    /// the process list, version 2 chunks include it.
+    ///
+    /// Like the DOM, an object with a repeated key keeps only the last member with that
+    /// key. The parser stops at the first repeated key it sees, finds every member that a
+    /// later one replaces, and parses the document again without them. A failed parse is
+    /// checked the same way, since the invalid member may be replaced.
+    ///
+    /// A parser instance may be reused for any number of documents, but must not be
+    /// shared between threads.
+    class SystemInfoSaxParser
+    {
+    public:
+        /// @brief Constructor.
+        SystemInfoSaxParser();
+
+        /// @brief Destructor.
+        ~SystemInfoSaxParser() = default;
+
+        /// @brief Parses system info JSON text.
+        /// @param [in] data The system info JSON text. Does not need to be null terminated.
+        /// @param [in] size The size of the JSON text in bytes.
+        /// @param [in, out] system_info The parsed JSON represented by system info structure.
+        /// @param [in] sections The SystemInfoSection flags selecting the sections to parse.
+        /// @param [out] out_result The parse result, with the error and its location if the parse failed.
+        /// @return true if successfully parsed, false otherwise.
+        bool Parse(const char* data, size_t size, SystemInfo& system_info, uint32_t sections, SystemInfoParseResult& out_result);
+
+#ifdef SYSTEM_INFO_ENABLE_PARSE_STATS
+        /// @brief Set the structure the section timings and element counts are added to.
+        /// @param [in] stats The parse stats, or nullptr to stop recording them.
+        void SetParseStats(SystemInfoParseStats* stats);
+#endif
+
+        /// @brief SAX event for a null value.
+        bool null();
+
+        /// @brief SAX event for a boolean value.
+        bool boolean(bool value);
+
+        /// @brief SAX event for a signed integer value.
+        bool number_integer(nlohmann::json::number_integer_t value);
+
+        /// @brief SAX event for an unsigned integer value.
+        bool number_unsigned(nlohmann::json::number_unsigned_t value);
+
+        /// @brief SAX event for a floating point value.
+        bool number_float(nlohmann::json::number_float_t value, const nlohmann::json::string_t& text);
+
+        /// @brief SAX event for a string value.
+        bool string(nlohmann::json::string_t& value);
+
+        /// @brief SAX event for a binary value. Never generated for JSON text.
+        bool binary(nlohmann::json::binary_t& value);
+
+        /// @brief SAX event for the beginning of an object.
+        bool start_object(std::size_t element_count);
+
+        /// @brief SAX event for an object key.
+        bool key(nlohmann::json::string_t& value);
+
+        /// @brief SAX event for the end of an object.
+        bool end_object();
+
+        /// @brief SAX event for the beginning of an array.
+        bool start_array(std::size_t element_count);
+
+        /// @brief SAX event for the end of an array.
+        bool end_array();
+
+        /// @brief SAX event for a syntax error.
+        bool parse_error(std::size_t position, const std::string& last_token, const nlohmann::json::exception& exception);
+
+    private:
+        /// @brief A container currently being parsed.
+        struct Frame
+        {
+            SaxNode node;          ///< The node describing the container.
+            SaxKey  key;           ///< The key of the member currently being parsed, for objects.
+            bool    is_array;      ///< True if the container is an array, false if it is an object.
+            bool    skip_member;   ///< True if the member currently being parsed is replaced by a later one with the same key.
+            size_t  first_member;  ///< The index in member_ids_ of the first member of the container.
+        };
+
+        /// @brief Run the SAX parser over the text once, filling the structure.
+        /// @param [in] data The system info JSON text.
+        /// @param [in] size The size of the JSON text in bytes.
+        /// @param [in] detect_repeats True to stop at the first repeated key, false to skip the members in superseded_members_.
+        /// @return true if successfully parsed, false otherwise.
+        bool Run(const char* data, size_t size, bool detect_repeats);
+
+        /// @brief Record a member of the innermost object while looking for repeated keys.
+        /// @param [in] id The identifier of the member key.
+        /// @return false if the object already has a member with the key, true otherwise.
+        bool AddMember(uint64_t id);
+
+        /// @brief Handle a scalar value.
+        bool OnValue(const SaxValue& value);
+
+        /// @brief Handle the beginning of an object or array.
+        bool OnStartContainer(bool is_array);
+
+        /// @brief Handle the end of an object or array.
+        bool OnEndContainer();
+
+        /// @brief Check if an object member belongs to a section that was not requested.
+        /// @param [in] node The object node containing the member.
+        /// @param [in] key The key of the member.
+        /// @return true if the member should be skipped, false otherwise.
+        bool IsSectionSkipped(SaxNode node, SaxKey key) const;
+
+        /// @brief Apply the default values for an object member whose key has just been read.
+        void ApplyMemberDefaults(SaxNode node, SaxKey key);
+
+        /// @brief Select the node used to parse a container member of an object node.
+        /// @param [in] node The object node containing the member.
+        /// @param [in] key The key of the member.
+        /// @param [in] is_array True if the member is an array, false if it is an object.
+        /// @param [out] child The node to parse the member with.
+        /// @return false if the member type is invalid, true otherwise.
+        bool OpenMember(SaxNode node, SaxKey key, bool is_array, SaxNode& child);
+
+        /// @brief Assign a scalar member of an object node.
+        /// @param [in] node The object node containing the member.
+        /// @param [in] key The key of the member.
+        /// @param [in] value The scalar value.
+        /// @return false if the member type is invalid, true otherwise.
+        bool AssignMember(SaxNode node, SaxKey key, const SaxValue& value);
+
+        /// @brief Add a default initialized element to a list node.
+        /// @param [in] node The list node.
+        /// @return The node used to parse the contents of the element.
+        SaxNode AddListElement(SaxNode node);
+
+        /// @brief Check if the process list is stored in the process table.
+        /// @return true if the table is used, false if the process vector is used.
+        bool UseProcessTable() const
+        {
+            return (sections_ & kSystemInfoSectionProcessTable) != 0;
+        }
+
+        /// @brief Discard the CU mask of the current GPU once an invalid entry is found.
+        void RejectCuMask();
+
+        /// @brief Mark the process list as invalid, remembering the event of the first invalid member.
+        void RejectProcessList();
+
+        /// @brief Find the values of the top-level sections that are not selected, so the lexer can skip them.
+        ///
+        /// Skipped sections are ignored by the parser anyway, so only the time spent tokenizing them is saved.
+        /// They are still validated, and if one is not valid JSON nothing is skipped, so errors are reported
+        /// exactly as by a full parse.
+        /// @param [in] data The system info JSON text.
+        /// @param [in] size The size of the JSON text in bytes.
+        void FindSkippedValues(const char* data, size_t size);
+
+        /// @brief Find the key events of the members that a later member of the same object replaces.
+        /// @param [in] data The system info JSON text.
+        /// @param [in] size The size of the JSON text in bytes.
+        void FindSupersededMembers(const char* data, size_t size);
+
+        /// @brief Apply the chunk version once the whole document has been parsed.
+        /// @return true if the chunk version is supported, false otherwise.
+        bool Finish();
+
+        /// @brief Find the location of the failed event by tokenizing the JSON text again.
+        /// @param [in] data The system info JSON text.
+        /// @param [in] size The size of the JSON text in bytes.
+        /// @param [in, out] result The parse result, whose offset and pointer are filled in.
+        void Locate(const char* data, size_t size, SystemInfoParseResult& result) const;
+
+#ifdef SYSTEM_INFO_ENABLE_PARSE_STATS
+        /// @brief Count an element added to a list node in the parse stats.
+        /// @param [in] node The list node.
+        void CountElement(SaxNode node);
+#endif
+
+        SystemInfo*          system_info_;           ///< The structure being populated.
+        std::vector<Frame>   frames_;                ///< The stack of containers currently being parsed.
+        uint32_t             sections_;              ///< The SystemInfoSection flags selecting the sections to parse.
+        size_t               process_count_;         ///< The number of processes in the structure before parsing.
+        size_t               process_table_count_;   ///< The number of processes in the process table before parsing.
+        size_t               heap_list_begin_;       ///< The index of the first heap added by the current heap list.
+        bool                 system_node_found_;     ///< True if the document wraps the system info in a 'system' node.
+        bool                 root_members_parsed_;   ///< True if system info members were parsed from the root node.
+        bool                 version_found_;         ///< True if the system node contains a version.
+        bool                 cu_mask_rejected_;      ///< True if the current CU mask contained an invalid entry.
+        bool                 process_list_invalid_;  ///< True if the process list contained an invalid member.
+        Process              pending_process_;       ///< The process being parsed when the process table is used, reused so its strings keep their capacity.
+        SystemInfoParseError error_;                 ///< The reason the parse failed, set at the event that failed it.
+        size_t               event_count_;           ///< The number of SAX events received, used to locate errors without tracking positions.
+        size_t               error_event_;           ///< The number of the event the error was detected at.
+        size_t               version_event_;         ///< The number of the event the chunk version was read at.
+        size_t               process_error_event_;   ///< The number of the event the first invalid process list member was read at.
+
+        SystemInfoScanner         scanner_;         ///< Finds the top-level nodes when sections are skipped.
+        std::vector<SaxSkipRange> skipped_values_;  ///< The interiors of the values the lexer skips, in document order.
+
+        bool                  detect_repeats_;      ///< True if the parse stops at the first repeated key.
+        bool                  repeated_key_found_;  ///< True if the parse stopped at a repeated key.
+        std::vector<uint64_t> member_ids_;          ///< The key identifiers of the members of the open objects.
+        std::vector<size_t>   superseded_members_;  ///< The key events of the members replaced by a later member, in order.
+        size_t                next_superseded_;     ///< The index of the next superseded member to skip.
+        Version               saved_version_;       ///< The version before parsing, restored for a second parse.
+        DriverInfo            saved_driver_;        ///< The driver info before parsing, restored for a second parse.
+        DevDriverInfo         saved_devdriver_;     ///< The DevDriver info before parsing, restored for a second parse.
+        OsInfo                saved_os_;            ///< The OS info before parsing, restored for a second parse.
+
+#ifdef SYSTEM_INFO_ENABLE_PARSE_STATS
+        SystemInfoParseStats*                 parse_stats_;    ///< The parse stats, or nullptr if they are not recorded.
+        std::chrono::steady_clock::time_point section_start_;  ///< The time the current section was entered.
+#endif
+    };
+}  // namespace system_info_utils
+
+#endif
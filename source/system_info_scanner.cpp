@@ -0,0 +1,882 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief System info scanner implementation
+//=============================================================================
+
+#include "system_info_scanner.h"
+
+#include <clocale>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define SYSTEM_INFO_SCANNER_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace
+{
+    using system_info_utils::SystemInfoNodeRange;
+
+    constexpr size_t kBlockSize = 64;  ///< The number of bytes classified at a time, one per bit of a mask.
+
+    /// @brief The bit masks of the characters of a block, bit i standing for byte i.
+    struct BlockMasks
+    {
+        uint64_t quote;       ///< The '"' characters.
+        uint64_t backslash;   ///< The '\' characters.
+        uint64_t structural;  ///< The '{', '}', '[', ']', ':' and ',' characters.
+    };
+
+#ifdef SYSTEM_INFO_SCANNER_SSE2
+    /// @brief Classify the characters of a block, 16 at a time.
+    /// @param [in] block The block of kBlockSize bytes.
+    /// @param [out] out_masks The masks of the block.
+    void Classify(const char* block, BlockMasks& out_masks)
+    {
+        // Setting bit 5 maps '[' to '{' and ']' to '}', and no other character to either.
+        const __m128i case_bit      = _mm_set1_epi8(0x20);
+        const __m128i quote         = _mm_set1_epi8('"');
+        const __m128i backslash     = _mm_set1_epi8('\\');
+        const __m128i open_bracket  = _mm_set1_epi8('{');
+        const __m128i close_bracket = _mm_set1_epi8('}');
+        const __m128i colon         = _mm_set1_epi8(':');
+        const __m128i comma         = _mm_set1_epi8(',');
+
+        out_masks = {};
+        for (size_t i = 0; i < kBlockSize; i += 16)
+        {
+            const __m128i chars      = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + i));
+            const __m128i folded     = _mm_or_si128(chars, case_bit);
+            const __m128i brackets   = _mm_or_si128(_mm_cmpeq_epi8(folded, open_bracket), _mm_cmpeq_epi8(folded, close_bracket));
+            const __m128i separators = _mm_or_si128(_mm_cmpeq_epi8(chars, colon), _mm_cmpeq_epi8(chars, comma));
+
+            out_masks.quote |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, quote)))) << i;
+            out_masks.backslash |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, backslash)))) << i;
+            out_masks.structural |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_or_si128(brackets, separators)))) << i;
+        }
+    }
+#else
+    /// @brief Classify the characters of a block, one at a time.
+    /// @param [in] block The block of kBlockSize bytes.
+    /// @param [out] out_masks The masks of the block.
+    void Classify(const char* block, BlockMasks& out_masks)
+    {
+        out_masks = {};
+        for (size_t i = 0; i < kBlockSize; ++i)
+        {
+            const uint64_t bit = uint64_t{1} << i;
+            switch (block[i])
+            {
+            case '"':
+                out_masks.quote |= bit;
+                break;
+            case '\\':
+                out_masks.backslash |= bit;
+                break;
+            case '{':
+            case '}':
+            case '[':
+            case ']':
+            case ':':
+            case ',':
+                out_masks.structural |= bit;
+                break;
+            default:
+                break;
+            }
+        }
+    }
+#endif
+
+    /// @brief Find the characters escaped by a backslash.
+    ///
+    /// A character is escaped if it follows an odd number of consecutive backslashes. Subtracting
+    /// the start of each backslash run from the run with the odd bits set carries into the bit past
+    /// the run, and the parity of the run start and of that bit tells if the run has an odd length.
+    /// @param [in] backslash The backslashes of the block.
+    /// @param [in, out] next_is_escaped 1 if the first character of the block is escaped by the previous block. Updated for the next block.
+    /// @return The escaped characters of the block.
+    uint64_t FindEscaped(uint64_t backslash, uint64_t& next_is_escaped)
+    {
+        constexpr uint64_t kOddBits = 0xaaaaaaaaaaaaaaaaULL;
+
+        if (backslash == 0)
+        {
+            const uint64_t escaped = next_is_escaped;
+            next_is_escaped        = 0;
+            return escaped;
+        }
+
+        // A backslash escaped by the previous block does not start a run.
+        const uint64_t potential_escape         = backslash & ~next_is_escaped;
+        const uint64_t escape_and_terminal_code = (((potential_escape << 1) | kOddBits) - potential_escape) ^ kOddBits;
+        const uint64_t escaped                  = escape_and_terminal_code ^ (backslash | next_is_escaped);
+        const uint64_t escape                   = escape_and_terminal_code & backslash;
+
+        next_is_escaped = escape >> 63;
+        return escaped;
+    }
+
+    /// @brief Compute the prefix XOR of a mask, setting each bit to the parity of the bits up to and including it.
+    /// @param [in] mask The mask.
+    /// @return The prefix XOR.
+    uint64_t PrefixXor(uint64_t mask)
+    {
+        mask ^= mask << 1;
+        mask ^= mask << 2;
+        mask ^= mask << 4;
+        mask ^= mask << 8;
+        mask ^= mask << 16;
+        mask ^= mask << 32;
+        return mask;
+    }
+
+    /// @brief Get the index of the lowest set bit.
+    /// @param [in] mask The mask. Must not be 0.
+    /// @return The index of the lowest set bit.
+    size_t CountTrailingZeros(uint64_t mask)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<size_t>(__builtin_ctzll(mask));
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+        unsigned long index = 0;
+        _BitScanForward64(&index, mask);
+        return index;
+#else
+        size_t index = 0;
+        while ((mask & 1) == 0)
+        {
+            mask >>= 1;
+            ++index;
+        }
+        return index;
+#endif
+    }
+
+    /// @brief Check if a character is JSON whitespace.
+    /// @param [in] c The character.
+    /// @return true if the character is a space, tab, line feed or carriage return.
+    bool IsWhitespace(char c)
+    {
+        return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\r');
+    }
+
+    /// @brief Follows the structural characters of a document in order, recording the members of
+    /// the root object and of the last 'system' object of the root object.
+    class StructureWalker
+    {
+    public:
+        /// @brief Constructor.
+        /// @param [in] data The JSON text.
+        /// @param [in] size The size of the JSON text in bytes.
+        /// @param [out] root_nodes The members of the root object.
+        /// @param [out] system_nodes The members of the 'system' node.
+        StructureWalker(const char* data, size_t size, std::vector<SystemInfoNodeRange>& root_nodes, std::vector<SystemInfoNodeRange>& system_nodes)
+            : data_(data)
+            , size_(size)
+            , root_nodes_(root_nodes)
+            , system_nodes_(system_nodes)
+            , depth_(0)
+            , root_closed_(false)
+            , system_node_found_(false)
+        {
+        }
+
+        /// @brief Visit a structural character or the opening quote of a string.
+        /// @param [in] offset The byte offset of the character.
+        /// @return false if the text is structurally invalid, true otherwise.
+        bool Visit(size_t offset)
+        {
+            if (root_closed_)
+            {
+                // Only one value may follow the root.
+                return false;
+            }
+
+            Level* level = ((depth_ == 1) || (depth_ == 2)) && (levels_[depth_].nodes != nullptr) ? &levels_[depth_] : nullptr;
+
+            switch (data_[offset])
+            {
+            case '"':
+                if ((level != nullptr) && level->expect_key)
+                {
+                    return ReadKey(offset, *level);
+                }
+                break;
+
+            case ':':
+                if ((level != nullptr) && level->has_key)
+                {
+                    size_t begin = offset + 1;
+                    while ((begin < size_) && IsWhitespace(data_[begin]))
+                    {
+                        ++begin;
+                    }
+
+                    level->nodes->push_back({key_, begin, begin});
+                    level->has_key  = false;
+                    level->in_value = true;
+                }
+                break;
+
+            case ',':
+                if (level != nullptr)
+                {
+                    EndValue(offset, *level);
+                    level->expect_key = true;
+                }
+                break;
+
+            case '{':
+            case '[':
+            {
+                // The object value of the 'system' member of the root object is followed too. A repeated key replaces the earlier members.
+                const bool is_system = (level != nullptr) && (depth_ == 1) && level->in_value && (data_[offset] == '{') &&
+                                       (root_nodes_.back().begin == offset) && (root_nodes_.back().key == "system");
+
+                ++depth_;
+                if (depth_ <= 2)
+                {
+                    levels_[depth_] = Level();
+                }
+
+                if (is_system)
+                {
+                    system_nodes_.clear();
+                }
+
+                if (((depth_ == 1) && (data_[offset] == '{')) || is_system)
+                {
+                    levels_[depth_].nodes      = (depth_ == 1) ? &root_nodes_ : &system_nodes_;
+                    levels_[depth_].expect_key = true;
+                    system_node_found_         = system_node_found_ || is_system;
+                }
+                break;
+            }
+
+            case '}':
+            case ']':
+                if (depth_ == 0)
+                {
+                    return false;
+                }
+
+                if (level != nullptr)
+                {
+                    EndValue(offset, *level);
+                }
+
+                --depth_;
+                root_closed_ = (depth_ == 0);
+                break;
+
+            default:
+                break;
+            }
+
+            return true;
+        }
+
+        /// @brief Check if every container was closed.
+        /// @return true if the depth is back to 0, false otherwise.
+        bool IsBalanced() const
+        {
+            return depth_ == 0;
+        }
+
+        /// @brief Check if the root object has a 'system' object.
+        /// @return true if the 'system' object was found, false otherwise.
+        bool IsSystemNodeFound() const
+        {
+            return system_node_found_;
+        }
+
+    private:
+        /// @brief The state of an object whose members are recorded.
+        struct Level
+        {
+            std::vector<SystemInfoNodeRange>* nodes      = nullptr;  ///< The members of the object, or nullptr if its members are not recorded.
+            bool                              expect_key = false;    ///< True if the next string is a member key.
+            bool                              has_key    = false;    ///< True if a key was read and its ':' has not been seen yet.
+            bool                              in_value   = false;    ///< True if the value of the last recorded member has not ended yet.
+        };
+
+        /// @brief Read a member key.
+        /// @param [in] offset The byte offset of the opening quote.
+        /// @param [in, out] level The object the key belongs to.
+        /// @return false if the key is not terminated, true otherwise.
+        bool ReadKey(size_t offset, Level& level)
+        {
+            // Keys are short, so the closing quote is found one character at a time.
+            size_t end = offset + 1;
+            while ((end < size_) && (data_[end] != '"'))
+            {
+                end += (data_[end] == '\\') ? 2 : 1;
+            }
+
+            if (end >= size_)
+            {
+                return false;
+            }
+
+            key_             = std::string_view(data_ + offset + 1, end - offset - 1);
+            level.expect_key = false;
+            level.has_key    = true;
+            return true;
+        }
+
+        /// @brief End the value of the last recorded member of an object, if it has not ended yet.
+        /// @param [in] offset The byte offset of the ',' or closing bracket after the value.
+        /// @param [in, out] level The object.
+        void EndValue(size_t offset, Level& level)
+        {
+            if (!level.in_value)
+            {
+                return;
+            }
+
+            SystemInfoNodeRange& node = level.nodes->back();
+
+            size_t end = offset;
+            while ((end > node.begin) && IsWhitespace(data_[end - 1]))
+            {
+                --end;
+            }
+
+            node.end       = end;
+            level.in_value = false;
+        }
+
+        const char*                       data_;               ///< The JSON text.
+        size_t                            size_;               ///< The size of the JSON text in bytes.
+        std::vector<SystemInfoNodeRange>& root_nodes_;         ///< The members of the root object.
+        std::vector<SystemInfoNodeRange>& system_nodes_;       ///< The members of the 'system' node.
+        Level                             levels_[3];          ///< The objects at depth 1 and 2. Index 0 is unused.
+        std::string_view                  key_;                ///< The key of the member whose ':' is expected next.
+        size_t                            depth_;              ///< The number of open containers.
+        bool                              root_closed_;        ///< True once the root container has been closed.
+        bool                              system_node_found_;  ///< True once the 'system' object has been opened.
+    };
+
+    /// @brief Checks JSON text against the grammar accepted by the JSON parser, without materializing any value.
+    ///
+    /// Containers are tracked on an explicit stack, so deeply nested text does not exhaust the call stack.
+    class GrammarValidator
+    {
+    public:
+        /// @brief Constructor.
+        /// @param [in] data The JSON text.
+        /// @param [in] size The size of the JSON text in bytes.
+        GrammarValidator(const char* data, size_t size)
+            : current_(data)
+            , end_(data + size)
+        {
+        }
+
+        /// @brief Check that the text is a single value, surrounded by optional whitespace.
+        /// @return true if the text is valid, false otherwise.
+        bool Run()
+        {
+            std::vector<char> containers;
+
+            SkipWhitespace();
+            for (;;)
+            {
+                // A value is expected.
+                if (current_ == end_)
+                {
+                    return false;
+                }
+
+                bool value_ended = true;
+                if ((*current_ == '{') || (*current_ == '['))
+                {
+                    const char close = (*current_ == '{') ? '}' : ']';
+                    ++current_;
+                    SkipWhitespace();
+                    if ((current_ != end_) && (*current_ == close))
+                    {
+                        ++current_;
+                    }
+                    else
+                    {
+                        containers.push_back(close);
+                        if ((close == '}') && !ReadKey())
+                        {
+                            return false;
+                        }
+                        value_ended = false;
+                    }
+                }
+                else if (!ReadScalar())
+                {
+                    return false;
+                }
+
+                // Close every container that ends after the value, then continue with the next member or element.
+                while (value_ended)
+                {
+                    SkipWhitespace();
+                    if (containers.empty())
+                    {
+                        return current_ == end_;
+                    }
+
+                    if (current_ == end_)
+                    {
+                        return false;
+                    }
+
+                    if (*current_ == containers.back())
+                    {
+                        ++current_;
+                        containers.pop_back();
+                    }
+                    else if (*current_ == ',')
+                    {
+                        ++current_;
+                        SkipWhitespace();
+                        if ((containers.back() == '}') && !ReadKey())
+                        {
+                            return false;
+                        }
+                        value_ended = false;
+                    }
+                    else
+                    {
+                        return false;
+                    }
+                }
+
+                SkipWhitespace();
+            }
+        }
+
+    private:
+        /// @brief Skip whitespace.
+        void SkipWhitespace()
+        {
+            while ((current_ != end_) && IsWhitespace(*current_))
+            {
+                ++current_;
+            }
+        }
+
+        /// @brief Read a member key and the ':' after it.
+        /// @return true if they are valid, false otherwise.
+        bool ReadKey()
+        {
+            if ((current_ == end_) || (*current_ != '"') || !ReadString())
+            {
+                return false;
+            }
+
+            SkipWhitespace();
+            if ((current_ == end_) || (*current_ != ':'))
+            {
+                return false;
+            }
+
+            ++current_;
+            SkipWhitespace();
+            return true;
+        }
+
+        /// @brief Read a string, number or literal.
+        /// @return true if it is valid, false otherwise.
+        bool ReadScalar()
+        {
+            switch (*current_)
+            {
+            case '"':
+                return ReadString();
+            case 't':
+                return ReadLiteral("true", 4);
+            case 'f':
+                return ReadLiteral("false", 5);
+            case 'n':
+                return ReadLiteral("null", 4);
+            default:
+                return ReadNumber();
+            }
+        }
+
+        /// @brief Read a literal.
+        /// @param [in] literal The literal.
+        /// @param [in] length The length of the literal.
+        /// @return true if the text matches the literal, false otherwise.
+        bool ReadLiteral(const char* literal, size_t length)
+        {
+            if ((static_cast<size_t>(end_ - current_) < length) || (std::memcmp(current_, literal, length) != 0))
+            {
+                return false;
+            }
+
+            current_ += length;
+            return true;
+        }
+
+        /// @brief Read a run of decimal digits.
+        /// @return The number of digits read.
+        size_t ReadDigits()
+        {
+            const char* begin = current_;
+            while ((current_ != end_) && (*current_ >= '0') && (*current_ <= '9'))
+            {
+                ++current_;
+            }
+
+            return static_cast<size_t>(current_ - begin);
+        }
+
+        /// @brief Read a number.
+        ///
+        /// Like the JSON parser, numbers that do not fit an integer are read as floating point,
+        /// and those that overflow a double are rejected.
+        /// @return true if the number is valid, false otherwise.
+        bool ReadNumber()
+        {
+            const char* begin    = current_;
+            bool        is_float = false;
+
+            if ((current_ != end_) && (*current_ == '-'))
+            {
+                ++current_;
+            }
+
+            if ((current_ != end_) && (*current_ == '0'))
+            {
+                ++current_;
+            }
+            else if (ReadDigits() == 0)
+            {
+                return false;
+            }
+
+            if ((current_ != end_) && (*current_ == '.'))
+            {
+                ++current_;
+                is_float = true;
+                if (ReadDigits() == 0)
+                {
+                    return false;
+                }
+            }
+
+            if ((current_ != end_) && ((*current_ == 'e') || (*current_ == 'E')))
+            {
+                ++current_;
+                is_float = true;
+                if ((current_ != end_) && ((*current_ == '+') || (*current_ == '-')))
+                {
+                    ++current_;
+                }
+
+                if (ReadDigits() == 0)
+                {
+                    return false;
+                }
+            }
+
+            // Integers of up to 19 digits always fit a 64-bit integer or convert to a finite double.
+            const size_t length = static_cast<size_t>(current_ - begin);
+            return (!is_float && (length <= 19)) || IsFinite(begin, length);
+        }
+
+        /// @brief Check if a number converts to a finite double.
+        /// @param [in] number The number text.
+        /// @param [in] length The length of the number text.
+        /// @return true if the number is finite, false otherwise.
+        static bool IsFinite(const char* number, size_t length)
+        {
+            // The decimal point is replaced with the one of the current locale, as the JSON parser does.
+            std::string text(number, length);
+            const char  decimal_point = std::localeconv()->decimal_point[0];
+            for (char& c : text)
+            {
+                if (c == '.')
+                {
+                    c = decimal_point;
+                }
+            }
+
+            return std::isfinite(std::strtod(text.c_str(), nullptr));
+        }
+
+        /// @brief Read a hexadecimal escape code.
+        /// @param [out] out_code The code unit.
+        /// @return true if four hexadecimal digits were read, false otherwise.
+        bool ReadCodeUnit(uint32_t& out_code)
+        {
+            if (end_ - current_ < 4)
+            {
+                return false;
+            }
+
+            out_code = 0;
+            for (int i = 0; i < 4; ++i, ++current_)
+            {
+                const char c = *current_;
+                if ((c >= '0') && (c <= '9'))
+                {
+                    out_code = (out_code << 4) | static_cast<uint32_t>(c - '0');
+                }
+                else if ((c >= 'a') && (c <= 'f'))
+                {
+                    out_code = (out_code << 4) | static_cast<uint32_t>(c - 'a' + 10);
+                }
+                else if ((c >= 'A') && (c <= 'F'))
+                {
+                    out_code = (out_code << 4) | static_cast<uint32_t>(c - 'A' + 10);
+                }
+                else
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /// @brief Read an escape sequence after its backslash.
+        /// @return true if it is valid, false otherwise.
+        bool ReadEscape()
+        {
+            if (current_ == end_)
+            {
+                return false;
+            }
+
+            const char c = *current_++;
+            if (c != 'u')
+            {
+                return (c == '"') || (c == '\\') || (c == '/') || (c == 'b') || (c == 'f') || (c == 'n') || (c == 'r') || (c == 't');
+            }
+
+            uint32_t code = 0;
+            if (!ReadCodeUnit(code) || ((code >= 0xdc00) && (code <= 0xdfff)))
+            {
+                return false;
+            }
+
+            // A high surrogate must be followed by an escaped low surrogate.
+            if ((code >= 0xd800) && (code <= 0xdbff))
+            {
+                if ((end_ - current_ < 2) || (current_[0] != '\\') || (current_[1] != 'u'))
+                {
+                    return false;
+                }
+
+                current_ += 2;
+                return ReadCodeUnit(code) && (code >= 0xdc00) && (code <= 0xdfff);
+            }
+
+            return true;
+        }
+
+        /// @brief Read the continuation bytes of a UTF-8 sequence.
+        /// @param [in] count The number of continuation bytes.
+        /// @param [in] min The minimum value of the first continuation byte.
+        /// @param [in] max The maximum value of the first continuation byte.
+        /// @return true if the bytes are valid, false otherwise.
+        bool ReadContinuation(int count, uint8_t min, uint8_t max)
+        {
+            if (end_ - current_ < count)
+            {
+                return false;
+            }
+
+            for (int i = 0; i < count; ++i, ++current_)
+            {
+                const uint8_t byte = static_cast<uint8_t>(*current_);
+                if ((byte < min) || (byte > max))
+                {
+                    return false;
+                }
+
+                min = 0x80;
+                max = 0xbf;
+            }
+
+            return true;
+        }
+
+        /// @brief Read a string, rejecting control characters, invalid escapes and invalid UTF-8 like the JSON parser.
+        /// @return true if the string is valid, false otherwise.
+        bool ReadString()
+        {
+            ++current_;
+            while (current_ != end_)
+            {
+                const uint8_t byte = static_cast<uint8_t>(*current_++);
+                bool          valid = true;
+
+                if (byte == '"')
+                {
+                    return true;
+                }
+                else if (byte == '\\')
+                {
+                    valid = ReadEscape();
+                }
+                else if (byte < 0x20)
+                {
+                    valid = false;
+                }
+                else if (byte < 0x80)
+                {
+                    // ASCII.
+                }
+                else if ((byte >= 0xc2) && (byte <= 0xdf))
+                {
+                    valid = ReadContinuation(1, 0x80, 0xbf);
+                }
+                else if (byte == 0xe0)
+                {
+                    valid = ReadContinuation(2, 0xa0, 0xbf);
+                }
+                else if (byte == 0xed)
+                {
+                    valid = ReadContinuation(2, 0x80, 0x9f);
+                }
+                else if ((byte >= 0xe1) && (byte <= 0xef))
+                {
+                    valid = ReadContinuation(2, 0x80, 0xbf);
+                }
+                else if (byte == 0xf0)
+                {
+                    valid = ReadContinuation(3, 0x90, 0xbf);
+                }
+                else if ((byte >= 0xf1) && (byte <= 0xf3))
+                {
+                    valid = ReadContinuation(3, 0x80, 0xbf);
+                }
+                else if (byte == 0xf4)
+                {
+                    valid = ReadContinuation(3, 0x80, 0x8f);
+                }
+                else
+                {
+                    valid = false;
+                }
+
+                if (!valid)
+                {
+                    return false;
+                }
+            }
+
+            return false;
+        }
+
+        const char* current_;  ///< The character being read.
+        const char* end_;      ///< The end of the JSON text.
+    };
+
+    /// @brief Find the last node with a key, which is the one the JSON parser keeps when a key is repeated.
+    /// @param [in] nodes The nodes.
+    /// @param [in] key The key.
+    /// @return The node, or nullptr if there is none.
+    const SystemInfoNodeRange* FindNode(const std::vector<SystemInfoNodeRange>& nodes, std::string_view key)
+    {
+        for (auto node = nodes.rbegin(); node != nodes.rend(); ++node)
+        {
+            if (node->key == key)
+            {
+                return &*node;
+            }
+        }
+
+        return nullptr;
+    }
+}  // namespace
+
+namespace system_info_utils
+{
+    bool SystemInfoScanner::Scan(const char* json, size_t size)
+    {
+        root_nodes_.clear();
+        system_nodes_.clear();
+        system_node_found_ = false;
+
+        StructureWalker walker(json, size, root_nodes_, system_nodes_);
+        uint64_t        next_is_escaped = 0;
+        uint64_t        in_string       = 0;
+        bool            result          = true;
+
+        for (size_t block_begin = 0; result && (block_begin < size); block_begin += kBlockSize)
+        {
+            // The last partial block is padded with whitespace.
+            char        padded[kBlockSize];
+            const char* block = json + block_begin;
+            if (size - block_begin < kBlockSize)
+            {
+                std::memset(padded, ' ', kBlockSize);
+                std::memcpy(padded, block, size - block_begin);
+                block = padded;
+            }
+
+            BlockMasks masks;
+            Classify(block, masks);
+
+            // The string mask includes the opening quote of each string but not the closing one.
+            const uint64_t quote       = masks.quote & ~FindEscaped(masks.backslash, next_is_escaped);
+            const uint64_t string_mask = PrefixXor(quote) ^ in_string;
+            in_string                  = static_cast<uint64_t>(static_cast<int64_t>(string_mask) >> 63);
+
+            for (uint64_t tokens = (masks.structural & ~string_mask) | (quote & string_mask); tokens != 0; tokens &= tokens - 1)
+            {
+                if (!walker.Visit(block_begin + CountTrailingZeros(tokens)))
+                {
+                    result = false;
+                    break;
+                }
+            }
+        }
+
+        if (result && (in_string == 0) && walker.IsBalanced())
+        {
+            system_node_found_ = walker.IsSystemNodeFound();
+        }
+        else
+        {
+            root_nodes_.clear();
+            system_nodes_.clear();
+            result = false;
+        }
+
+        return result;
+    }
+
+    const SystemInfoNodeRange* SystemInfoScanner::FindRootNode(std::string_view key) const
+    {
+        return FindNode(root_nodes_, key);
+    }
+
+    const SystemInfoNodeRange* SystemInfoScanner::FindSystemNode(std::string_view key) const
+    {
+        return FindNode(GetSystemNodes(), key);
+    }
+
+    bool SystemInfoScanner::Validate(const char* json, size_t size)
+    {
+        // The JSON parser skips a UTF-8 byte order mark at the start of a document.
+        if ((size >= 3) && (std::memcmp(json, "\xef\xbb\xbf", 3) == 0))
+        {
+            json += 3;
+            size -= 3;
+        }
+
+        GrammarValidator validator(json, size);
+        return validator.Run();
+    }
+}  // namespace system_info_utils
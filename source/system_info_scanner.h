@@ -0,0 +1,99 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief System info scanner definition
+///
+/// The System Info Scanner finds the byte ranges of the top-level nodes of
+/// system info JSON text, such as 'system', 'driver', 'gpus' and 'processes',
+/// without parsing their values.
+//=============================================================================
+
+#ifndef SYSTEM_INFO_UTILS_SOURCE_SYSTEM_INFO_SCANNER_H_
+#define SYSTEM_INFO_UTILS_SOURCE_SYSTEM_INFO_SCANNER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace system_info_utils
+{
+    /// @brief The location of the value of an object member in JSON text.
+    struct SystemInfoNodeRange
+    {
+        std::string_view key;    ///< The member key as written in the text, without the quotes. Escape sequences are not decoded.
+        size_t           begin;  ///< The byte offset of the first character of the value.
+        size_t           end;    ///< The byte offset just past the last character of the value.
+    };
+
+    /// @brief Finds the members of the root object of JSON text, and of its 'system' object if it has one.
+    ///
+    /// The text is classified 64 bytes at a time in the style of simdjson: bit masks of the quotes,
+    /// backslashes and structural characters of a block are built with SSE2 where available, the
+    /// characters inside strings are masked out with a prefix XOR of the unescaped quotes, and only
+    /// the remaining structural characters are visited. No value is materialized.
+    ///
+    /// The scan only checks that strings are terminated and that containers are balanced. Values
+    /// are not validated, so text that scans successfully may still fail to parse; Validate checks
+    /// the full grammar.
+    class SystemInfoScanner
+    {
+    public:
+        /// @brief Constructor
+        SystemInfoScanner() = default;
+
+        /// @brief Scan JSON text, replacing the nodes of the previous scan.
+        /// @param [in] json The JSON text. Does not need to be null terminated, and must outlive the scan results.
+        /// @param [in] size The size of the JSON text in bytes.
+        /// @return true if the text is structurally complete, false otherwise. On failure no nodes are found.
+        bool Scan(const char* json, size_t size);
+
+        /// @brief Check if the root object has a 'system' member whose value is an object.
+        /// @return true if the document wraps the system info in a 'system' node, false otherwise.
+        bool IsSystemNodeFound() const
+        {
+            return system_node_found_;
+        }
+
+        /// @brief Get the members of the root object.
+        /// @return The members in document order. Empty if the root is not an object.
+        const std::vector<SystemInfoNodeRange>& GetRootNodes() const
+        {
+            return root_nodes_;
+        }
+
+        /// @brief Get the members of the system info, which are those of the 'system' node if there is one, or of the root object otherwise.
+        /// @return The members in document order.
+        const std::vector<SystemInfoNodeRange>& GetSystemNodes() const
+        {
+            return system_node_found_ ? system_nodes_ : root_nodes_;
+        }
+
+        /// @brief Find a member of the root object.
+        /// @param [in] key The member key.
+        /// @return The last member with the key, which is the one the JSON parser keeps, or nullptr if there is none.
+        const SystemInfoNodeRange* FindRootNode(std::string_view key) const;
+
+        /// @brief Find a member of the system info, in the 'system' node if there is one, or in the root object otherwise.
+        /// @param [in] key The member key.
+        /// @return The last member with the key, which is the one the JSON parser keeps, or nullptr if there is none.
+        const SystemInfoNodeRange* FindSystemNode(std::string_view key) const;
+
+        /// @brief Check that JSON text is a single valid value, surrounded by optional whitespace.
+        ///
+        /// The text is checked against the grammar the JSON parser accepts, including string escapes,
+        /// UTF-8 encoding and number range, without materializing any value.
+        /// @param [in] json The JSON text. Does not need to be null terminated.
+        /// @param [in] size The size of the JSON text in bytes.
+        /// @return true if the JSON parser would accept the text, false otherwise.
+        static bool Validate(const char* json, size_t size);
+
+    private:
+        std::vector<SystemInfoNodeRange> root_nodes_;                 ///< The members of the root object.
+        std::vector<SystemInfoNodeRange> system_nodes_;               ///< The members of the 'system' node.
+        bool                             system_node_found_ = false;  ///< True if the root object has a 'system' object.
+    };
+}  // namespace system_info_utils
+
+#endif
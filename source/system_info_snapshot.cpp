@@ -0,0 +1,125 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief System info snapshot implementation
+//=============================================================================
+
+#include "system_info_snapshot.h"
+
+#include <cstring>
+#include <utility>
+
+#include "definitions.h"
+#include "system_info_writer.h"
+
+namespace system_info_utils
+{
+    SystemInfoSnapshot::SystemInfoSnapshot()
+        : current_(std::make_shared<const SystemInfo>())
+        , version_(0)
+        , source_sections_(0)
+    {
+        SystemInfoWriter::Write(*current_, content_);
+    }
+
+    SystemInfoSnapshot::~SystemInfoSnapshot() = default;
+
+    std::shared_ptr<const SystemInfo> SystemInfoSnapshot::Get() const
+    {
+        // Not lock-free, but the internal lock is only held while the pointer and its reference count are copied.
+        return std::atomic_load_explicit(&current_, std::memory_order_acquire);
+    }
+
+    SystemInfoParseResult SystemInfoSnapshot::Update(const char* json, size_t size, bool& out_published, uint32_t sections)
+    {
+        std::lock_guard<std::mutex> lock(update_mutex_);
+
+        out_published = false;
+
+        // A refresher usually reads the same text again, so compare it before paying for a parse.
+        if ((sections == source_sections_) && (size == source_.size()) && (size == 0 || std::memcmp(json, source_.data(), size) == 0))
+        {
+            return SystemInfoParseResult{};
+        }
+
+        SystemInfo            system_info;
+        SystemInfoParseResult result = parse_context_.TryParse(json, size, system_info, sections);
+
+        if (result.IsSucceeded())
+        {
+            SYSTEM_INFO_TRY
+            {
+                source_.assign(json, size);
+                source_sections_ = sections;
+            }
+            SYSTEM_INFO_CATCH(...)
+            {
+                source_.clear();
+                source_sections_ = 0;
+            }
+
+            out_published = PublishLocked(system_info);
+        }
+
+        return result;
+    }
+
+    bool SystemInfoSnapshot::Refresh(SystemInfoCollector& collector, bool& out_published, uint32_t sections)
+    {
+        std::lock_guard<std::mutex> lock(update_mutex_);
+
+        out_published = false;
+
+        SystemInfo system_info;
+        if (!collector.Collect(system_info, sections))
+        {
+            return false;
+        }
+
+        out_published = PublishLocked(system_info);
+        return true;
+    }
+
+    bool SystemInfoSnapshot::Publish(SystemInfo&& system_info)
+    {
+        std::lock_guard<std::mutex> lock(update_mutex_);
+        return PublishLocked(system_info);
+    }
+
+    bool SystemInfoSnapshot::PublishLocked(SystemInfo& system_info)
+    {
+        // The writer emits every field in a fixed order, so equal text means equal content.
+        // If the text cannot be written the structure is published without comparing it.
+        const bool written = SystemInfoWriter::Write(system_info, buffer_);
+        if (written && buffer_ == content_)
+        {
+            return false;
+        }
+
+        std::shared_ptr<const SystemInfo> next;
+
+        SYSTEM_INFO_TRY
+        {
+            next = std::make_shared<const SystemInfo>(std::move(system_info));
+        }
+        SYSTEM_INFO_CATCH(...)
+        {
+            return false;
+        }
+
+        std::atomic_store_explicit(&current_, std::move(next), std::memory_order_release);
+        version_.fetch_add(1, std::memory_order_acq_rel);
+
+        if (written)
+        {
+            content_.swap(buffer_);
+        }
+        else
+        {
+            content_.clear();
+        }
+
+        return true;
+    }
+}  // namespace system_info_utils
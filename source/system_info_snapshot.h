@@ -0,0 +1,106 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief System info snapshot definition
+///
+/// The System Info Snapshot holds the current system info of a long-running
+/// process, so that many threads can read it while one thread refreshes it.
+//=============================================================================
+
+#ifndef SYSTEM_INFO_UTILS_SOURCE_SYSTEM_INFO_SNAPSHOT_H_
+#define SYSTEM_INFO_UTILS_SOURCE_SYSTEM_INFO_SNAPSHOT_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "system_info_collector.h"
+#include "system_info_reader.h"
+
+namespace system_info_utils
+{
+    /// @brief Publishes immutable system info structures to reader threads.
+    ///
+    /// Readers call Get, which atomically loads the current structure. The shared_ptr atomics are
+    /// not lock-free in common standard libraries, but the lock they take only covers the pointer
+    /// copy, so a read is brief and bounded and never waits for an update to be collected, parsed
+    /// or compared. A structure stays alive for as long as a reader holds it, even after a newer
+    /// one was published.
+    ///
+    /// Updates are made by a refresher thread of the caller through Update, Refresh or Publish.
+    /// Each update writes the new structure as JSON text with SystemInfoWriter, and it is published
+    /// only if the text differs from that of the current structure. Update also skips the parse
+    /// when the JSON text is identical to the text last parsed. Concurrent updates are serialized.
+    class SystemInfoSnapshot
+    {
+    public:
+        /// @brief Constructor, publishing an empty system info structure.
+        SystemInfoSnapshot();
+
+        /// @brief Destructor
+        ~SystemInfoSnapshot();
+
+        /// @brief delete copy constructor
+        SystemInfoSnapshot(const SystemInfoSnapshot&) = delete;
+
+        /// @brief delete assignment operator
+        SystemInfoSnapshot& operator=(const SystemInfoSnapshot&) = delete;
+
+        /// @brief Get the current system info. May be called from any thread.
+        /// @return The current system info structure. Never null.
+        std::shared_ptr<const SystemInfo> Get() const;
+
+        /// @brief Get the number of structures published after the initial empty one. May be called from any thread.
+        ///
+        /// Readers caching values derived from the system info can compare the version with the
+        /// one they last saw to check for a change without loading the structure.
+        /// @return The version of the current system info.
+        uint64_t GetVersion() const
+        {
+            return version_.load(std::memory_order_acquire);
+        }
+
+        /// @brief Parse system info JSON text and publish it if its content changed.
+        /// @param [in] json The system info JSON text. Does not need to be null terminated.
+        /// @param [in] size The size of the JSON text in bytes.
+        /// @param [out] out_published Set to true if a new structure was published, false otherwise.
+        /// @param [in] sections The SystemInfoSection flags selecting the sections to parse.
+        /// @return The parse result. On failure the current structure is kept.
+        SystemInfoParseResult Update(const char* json, size_t size, bool& out_published, uint32_t sections = kSystemInfoSectionAll);
+
+        /// @brief Collect the system info of the running system and publish it if its content changed.
+        ///
+        /// The collector must only be used by the thread calling Refresh.
+        /// @param [in, out] collector The collector. Its cached parts are kept between calls.
+        /// @param [out] out_published Set to true if a new structure was published, false otherwise.
+        /// @param [in] sections The SystemInfoSection flags selecting the sections to collect.
+        /// @return true if the system info was collected, false otherwise. On failure the current structure is kept.
+        bool Refresh(SystemInfoCollector& collector, bool& out_published, uint32_t sections = kSystemInfoSectionAll);
+
+        /// @brief Publish a system info structure if its content changed.
+        /// @param [in] system_info The system info structure. Moved from only if it is published.
+        /// @return true if the structure was published, false if its content equals the current one.
+        bool Publish(SystemInfo&& system_info);
+
+    private:
+        /// @brief Publish a structure if its content differs from the current one. The update mutex must be held.
+        /// @param [in] system_info The system info structure. Moved from only if it is published.
+        /// @return true if the structure was published, false otherwise.
+        bool PublishLocked(SystemInfo& system_info);
+
+        std::shared_ptr<const SystemInfo> current_;          ///< The current structure, only accessed atomically.
+        std::atomic<uint64_t>             version_;          ///< The number of structures published after the initial one.
+        std::mutex                        update_mutex_;     ///< Serializes the updates, guarding the members below.
+        SystemInfoParseContext            parse_context_;    ///< The context used to parse JSON text.
+        std::string                       content_;          ///< The current structure written as JSON text.
+        std::string                       buffer_;           ///< The new structure written as JSON text.
+        std::string                       source_;           ///< The JSON text last parsed successfully.
+        uint32_t                          source_sections_;  ///< The sections the JSON text was last parsed with.
+    };
+}  // namespace system_info_utils
+
+#endif
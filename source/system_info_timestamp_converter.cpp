@@ -0,0 +1,290 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Timestamp converter implementation
+//=============================================================================
+
+#include "system_info_timestamp_converter.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define SYSTEM_INFO_TIMESTAMP_SSE2
+#include <emmintrin.h>
+#if defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER)
+#define SYSTEM_INFO_TIMESTAMP_AVX2
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define SYSTEM_INFO_TIMESTAMP_NEON
+#include <arm_neon.h>
+#endif
+
+namespace
+{
+    using system_info_utils::TimestampClock;
+
+    constexpr uint64_t kNanosecondsPerSecond = 1000000000;  ///< The number of nanoseconds in a second.
+
+    /// @brief Compute ceil(numerator * 2^64 / denominator) for a numerator less than the denominator.
+    /// @param [in] numerator The numerator.
+    /// @param [in] denominator The denominator.
+    /// @return The fraction in units of 2^-64, rounded up.
+    uint64_t ComputeFraction(uint64_t numerator, uint64_t denominator)
+    {
+        // Binary long division, one quotient bit at a time. Only done once per clock.
+        uint64_t quotient  = 0;
+        uint64_t remainder = numerator;
+        for (int bit = 0; bit < 64; ++bit)
+        {
+            const bool carry = (remainder >> 63) != 0;
+            remainder <<= 1;
+            quotient <<= 1;
+            if (carry || (remainder >= denominator))
+            {
+                remainder -= denominator;
+                quotient |= 1;
+            }
+        }
+
+        return (remainder != 0) ? quotient + 1 : quotient;
+    }
+
+    /// @brief Convert timestamps one at a time.
+    /// @param [in] clock The clock.
+    /// @param [in] ticks The timestamps in ticks.
+    /// @param [out] out_nanoseconds The timestamps in nanoseconds.
+    /// @param [in] count The number of timestamps.
+    void ConvertScalar(const TimestampClock& clock, const uint64_t* ticks, uint64_t* out_nanoseconds, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            out_nanoseconds[i] = clock.ToNanoseconds(ticks[i]);
+        }
+    }
+
+    // The vector paths split each timestamp into 32-bit halves, since the instruction sets only multiply 32-bit lanes into
+    // 64-bit products. The integer part of the nanoseconds per tick is at most 10^9, so it always fits in 32 bits.
+
+#ifdef SYSTEM_INFO_TIMESTAMP_SSE2
+    /// @brief Convert timestamps two at a time, using SSE2.
+    /// @param [in] integer The whole nanoseconds per tick.
+    /// @param [in] fraction The fractional nanoseconds per tick, in units of 2^-64 ns.
+    /// @param [in] ticks The timestamps in ticks.
+    /// @param [out] out_nanoseconds The timestamps in nanoseconds.
+    /// @param [in] count The number of timestamps.
+    /// @return The number of timestamps converted, a multiple of 2.
+    size_t ConvertSse2(uint64_t integer, uint64_t fraction, const uint64_t* ticks, uint64_t* out_nanoseconds, size_t count)
+    {
+        const __m128i mask        = _mm_set1_epi64x(0xffffffff);
+        const __m128i integer_lo  = _mm_set1_epi64x(static_cast<int64_t>(integer));
+        const __m128i fraction_lo = _mm_set1_epi64x(static_cast<int64_t>(fraction & 0xffffffff));
+        const __m128i fraction_hi = _mm_set1_epi64x(static_cast<int64_t>(fraction >> 32));
+
+        const size_t end = count & ~static_cast<size_t>(1);
+        for (size_t i = 0; i < end; i += 2)
+        {
+            const __m128i value    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ticks + i));
+            const __m128i value_hi = _mm_srli_epi64(value, 32);
+
+            const __m128i whole = _mm_add_epi64(_mm_mul_epu32(value, integer_lo), _mm_slli_epi64(_mm_mul_epu32(value_hi, integer_lo), 32));
+
+            const __m128i lo_lo = _mm_mul_epu32(value, fraction_lo);
+            const __m128i lo_hi = _mm_mul_epu32(value, fraction_hi);
+            const __m128i hi_lo = _mm_mul_epu32(value_hi, fraction_lo);
+            const __m128i hi_hi = _mm_mul_epu32(value_hi, fraction_hi);
+            const __m128i mid   = _mm_add_epi64(_mm_add_epi64(_mm_srli_epi64(lo_lo, 32), _mm_and_si128(lo_hi, mask)), _mm_and_si128(hi_lo, mask));
+            const __m128i high =
+                _mm_add_epi64(_mm_add_epi64(hi_hi, _mm_srli_epi64(lo_hi, 32)), _mm_add_epi64(_mm_srli_epi64(hi_lo, 32), _mm_srli_epi64(mid, 32)));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out_nanoseconds + i), _mm_add_epi64(whole, high));
+        }
+
+        return end;
+    }
+#endif
+
+#ifdef SYSTEM_INFO_TIMESTAMP_AVX2
+#if defined(__GNUC__) || defined(__clang__)
+#define SYSTEM_INFO_TIMESTAMP_AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define SYSTEM_INFO_TIMESTAMP_AVX2_TARGET
+#endif
+
+    /// @brief Check if the CPU and the OS support AVX2.
+    /// @return true if AVX2 instructions can be used, false otherwise.
+    bool IsAvx2Supported()
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        // The first conversion may run in a static constructor, before the feature flags are initialized.
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+#else
+        int info[4] = {};
+        __cpuid(info, 0);
+        if (info[0] < 7)
+        {
+            return false;
+        }
+
+        // The OS must save the YMM registers, which requires OSXSAVE and AVX.
+        __cpuid(info, 1);
+        const bool osxsave = (info[2] & (1 << 27)) != 0;
+        const bool avx     = (info[2] & (1 << 28)) != 0;
+        if (!osxsave || !avx || ((_xgetbv(0) & 0x6) != 0x6))
+        {
+            return false;
+        }
+
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+#endif
+    }
+
+    /// @brief Convert timestamps four at a time, using AVX2.
+    /// @param [in] integer The whole nanoseconds per tick.
+    /// @param [in] fraction The fractional nanoseconds per tick, in units of 2^-64 ns.
+    /// @param [in] ticks The timestamps in ticks.
+    /// @param [out] out_nanoseconds The timestamps in nanoseconds.
+    /// @param [in] count The number of timestamps.
+    /// @return The number of timestamps converted, a multiple of 4.
+    SYSTEM_INFO_TIMESTAMP_AVX2_TARGET size_t ConvertAvx2(uint64_t integer, uint64_t fraction, const uint64_t* ticks, uint64_t* out_nanoseconds, size_t count)
+    {
+        const __m256i mask        = _mm256_set1_epi64x(0xffffffff);
+        const __m256i integer_lo  = _mm256_set1_epi64x(static_cast<int64_t>(integer));
+        const __m256i fraction_lo = _mm256_set1_epi64x(static_cast<int64_t>(fraction & 0xffffffff));
+        const __m256i fraction_hi = _mm256_set1_epi64x(static_cast<int64_t>(fraction >> 32));
+
+        const size_t end = count & ~static_cast<size_t>(3);
+        for (size_t i = 0; i < end; i += 4)
+        {
+            const __m256i value    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ticks + i));
+            const __m256i value_hi = _mm256_srli_epi64(value, 32);
+
+            const __m256i whole =
+                _mm256_add_epi64(_mm256_mul_epu32(value, integer_lo), _mm256_slli_epi64(_mm256_mul_epu32(value_hi, integer_lo), 32));
+
+            const __m256i lo_lo = _mm256_mul_epu32(value, fraction_lo);
+            const __m256i lo_hi = _mm256_mul_epu32(value, fraction_hi);
+            const __m256i hi_lo = _mm256_mul_epu32(value_hi, fraction_lo);
+            const __m256i hi_hi = _mm256_mul_epu32(value_hi, fraction_hi);
+            const __m256i mid =
+                _mm256_add_epi64(_mm256_add_epi64(_mm256_srli_epi64(lo_lo, 32), _mm256_and_si256(lo_hi, mask)), _mm256_and_si256(hi_lo, mask));
+            const __m256i high = _mm256_add_epi64(_mm256_add_epi64(hi_hi, _mm256_srli_epi64(lo_hi, 32)),
+                                                  _mm256_add_epi64(_mm256_srli_epi64(hi_lo, 32), _mm256_srli_epi64(mid, 32)));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out_nanoseconds + i), _mm256_add_epi64(whole, high));
+        }
+
+        return end;
+    }
+#endif
+
+#ifdef SYSTEM_INFO_TIMESTAMP_NEON
+    /// @brief Convert timestamps two at a time, using NEON.
+    /// @param [in] integer The whole nanoseconds per tick.
+    /// @param [in] fraction The fractional nanoseconds per tick, in units of 2^-64 ns.
+    /// @param [in] ticks The timestamps in ticks.
+    /// @param [out] out_nanoseconds The timestamps in nanoseconds.
+    /// @param [in] count The number of timestamps.
+    /// @return The number of timestamps converted, a multiple of 2.
+    size_t ConvertNeon(uint64_t integer, uint64_t fraction, const uint64_t* ticks, uint64_t* out_nanoseconds, size_t count)
+    {
+        const uint64x2_t mask        = vdupq_n_u64(0xffffffff);
+        const uint32x2_t integer_lo  = vdup_n_u32(static_cast<uint32_t>(integer));
+        const uint32x2_t fraction_lo = vdup_n_u32(static_cast<uint32_t>(fraction));
+        const uint32x2_t fraction_hi = vdup_n_u32(static_cast<uint32_t>(fraction >> 32));
+
+        const size_t end = count & ~static_cast<size_t>(1);
+        for (size_t i = 0; i < end; i += 2)
+        {
+            const uint64x2_t value    = vld1q_u64(ticks + i);
+            const uint32x2_t value_lo = vmovn_u64(value);
+            const uint32x2_t value_hi = vshrn_n_u64(value, 32);
+
+            const uint64x2_t whole = vaddq_u64(vmull_u32(value_lo, integer_lo), vshlq_n_u64(vmull_u32(value_hi, integer_lo), 32));
+
+            const uint64x2_t lo_lo = vmull_u32(value_lo, fraction_lo);
+            const uint64x2_t lo_hi = vmull_u32(value_lo, fraction_hi);
+            const uint64x2_t hi_lo = vmull_u32(value_hi, fraction_lo);
+            const uint64x2_t hi_hi = vmull_u32(value_hi, fraction_hi);
+            const uint64x2_t mid   = vaddq_u64(vaddq_u64(vshrq_n_u64(lo_lo, 32), vandq_u64(lo_hi, mask)), vandq_u64(hi_lo, mask));
+            const uint64x2_t high  = vaddq_u64(vaddq_u64(hi_hi, vshrq_n_u64(lo_hi, 32)), vaddq_u64(vshrq_n_u64(hi_lo, 32), vshrq_n_u64(mid, 32)));
+
+            vst1q_u64(out_nanoseconds + i, vaddq_u64(whole, high));
+        }
+
+        return end;
+    }
+#endif
+}  // namespace
+
+namespace system_info_utils
+{
+    TimestampClock::TimestampClock()
+        : frequency_(0)
+        , integer_(0)
+        , fraction_(0)
+    {
+    }
+
+    TimestampClock::TimestampClock(uint64_t frequency)
+        : frequency_(frequency)
+        , integer_(0)
+        , fraction_(0)
+    {
+        if (frequency != 0)
+        {
+            integer_  = kNanosecondsPerSecond / frequency;
+            fraction_ = ComputeFraction(kNanosecondsPerSecond % frequency, frequency);
+        }
+    }
+
+    void TimestampClock::ToNanoseconds(const uint64_t* ticks, uint64_t* out_nanoseconds, size_t count) const
+    {
+        size_t converted = 0;
+
+#if defined(SYSTEM_INFO_TIMESTAMP_AVX2)
+        static const bool kAvx2Supported = IsAvx2Supported();
+        if (kAvx2Supported)
+        {
+            converted = ConvertAvx2(integer_, fraction_, ticks, out_nanoseconds, count);
+        }
+        else
+        {
+            converted = ConvertSse2(integer_, fraction_, ticks, out_nanoseconds, count);
+        }
+#elif defined(SYSTEM_INFO_TIMESTAMP_SSE2)
+        converted = ConvertSse2(integer_, fraction_, ticks, out_nanoseconds, count);
+#elif defined(SYSTEM_INFO_TIMESTAMP_NEON)
+        converted = ConvertNeon(integer_, fraction_, ticks, out_nanoseconds, count);
+#endif
+
+        // The timestamps left over by the vector path.
+        ConvertScalar(*this, ticks + converted, out_nanoseconds + converted, count - converted);
+    }
+
+    TimestampConverter::TimestampConverter(const SystemInfo& system_info)
+    {
+        Reset(system_info);
+    }
+
+    void TimestampConverter::Reset(const SystemInfo& system_info)
+    {
+        gpu_clocks_.clear();
+        gpu_clocks_.reserve(system_info.gpus.size());
+        for (const GpuInfo& gpu : system_info.gpus)
+        {
+            gpu_clocks_.emplace_back(gpu.asic.gpu_counter_freq);
+        }
+
+        cpu_clocks_.clear();
+        cpu_clocks_.reserve(system_info.cpus.size());
+        for (const CpuInfo& cpu : system_info.cpus)
+        {
+            cpu_clocks_.emplace_back(cpu.timestamp_clock_frequency);
+        }
+    }
+}  // namespace system_info_utils
@@ -0,0 +1,174 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Timestamp converter definition
+///
+/// Converts raw GPU and CPU timestamps to nanoseconds using the clock frequencies
+/// reported in the system info, without a division per timestamp.
+//=============================================================================
+
+#ifndef SYSTEM_INFO_UTILS_SOURCE_SYSTEM_INFO_TIMESTAMP_CONVERTER_H_
+#define SYSTEM_INFO_UTILS_SOURCE_SYSTEM_INFO_TIMESTAMP_CONVERTER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+#include <intrin.h>  // for __umulh
+#endif
+
+#include "system_info_reader.h"
+
+namespace system_info_utils
+{
+    /// @brief Converts the ticks of one clock to nanoseconds.
+    ///
+    /// The number of nanoseconds per tick is stored as a 64-bit integer part and a 64-bit
+    /// binary fraction, rounded up. The result is never less than the exact number of
+    /// nanoseconds rounded down, and at most 1 ns more. It is exact for tick counts below
+    /// 2^64 / (frequency / gcd(frequency, 10^9)), which covers decades for common counter
+    /// frequencies, and for all tick counts when the frequency divides 10^9.
+    class TimestampClock
+    {
+    public:
+        /// @brief Constructor for a clock with an unknown frequency, converting every timestamp to 0.
+        TimestampClock();
+
+        /// @brief Constructor.
+        /// @param [in] frequency The clock frequency in ticks per second. 0 if unknown.
+        explicit TimestampClock(uint64_t frequency);
+
+        /// @brief Check if the clock frequency is known.
+        /// @return true if the frequency is not 0, false otherwise.
+        bool IsValid() const
+        {
+            return frequency_ != 0;
+        }
+
+        /// @brief Get the clock frequency.
+        /// @return The clock frequency in ticks per second.
+        uint64_t GetFrequency() const
+        {
+            return frequency_;
+        }
+
+        /// @brief Convert a timestamp to nanoseconds.
+        /// @param [in] ticks The timestamp in ticks.
+        /// @return The timestamp in nanoseconds, wrapping past 2^64 ns (about 584 years).
+        uint64_t ToNanoseconds(uint64_t ticks) const
+        {
+            return (ticks * integer_) + MultiplyHigh(ticks, fraction_);
+        }
+
+        /// @brief Convert timestamps to nanoseconds, using the widest vector instructions the CPU supports.
+        /// @param [in] ticks The timestamps in ticks.
+        /// @param [out] out_nanoseconds The timestamps in nanoseconds. May be the same array as ticks.
+        /// @param [in] count The number of timestamps.
+        void ToNanoseconds(const uint64_t* ticks, uint64_t* out_nanoseconds, size_t count) const;
+
+        /// @brief Get the high 64 bits of the 128-bit product of two numbers.
+        /// @param [in] a The first number.
+        /// @param [in] b The second number.
+        /// @return The high half of a * b.
+        static uint64_t MultiplyHigh(uint64_t a, uint64_t b)
+        {
+#if defined(__SIZEOF_INT128__)
+            return static_cast<uint64_t>((static_cast<unsigned __int128>(a) * b) >> 64);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+            return __umulh(a, b);
+#else
+            const uint64_t a_lo = a & 0xffffffffu;
+            const uint64_t a_hi = a >> 32;
+            const uint64_t b_lo = b & 0xffffffffu;
+            const uint64_t b_hi = b >> 32;
+            const uint64_t lo   = a_lo * b_lo;
+            const uint64_t mid0 = a_lo * b_hi;
+            const uint64_t mid1 = a_hi * b_lo;
+            const uint64_t mid  = (lo >> 32) + (mid0 & 0xffffffffu) + (mid1 & 0xffffffffu);
+            return (a_hi * b_hi) + (mid0 >> 32) + (mid1 >> 32) + (mid >> 32);
+#endif
+        }
+
+    private:
+        uint64_t frequency_;  ///< The clock frequency in ticks per second.
+        uint64_t integer_;    ///< The whole nanoseconds per tick.
+        uint64_t fraction_;   ///< The fractional nanoseconds per tick, in units of 2^-64 ns.
+    };
+
+    /// @brief Converts the timestamps of each GPU and CPU in a system info capture to nanoseconds.
+    ///
+    /// GPU timestamps use AsicInfo::gpu_counter_freq and CPU timestamps use
+    /// CpuInfo::timestamp_clock_frequency, both precomputed once when the converter is built.
+    class TimestampConverter
+    {
+    public:
+        /// @brief Constructor for a converter without any clocks.
+        TimestampConverter() = default;
+
+        /// @brief Constructor.
+        /// @param [in] system_info The system info the clock frequencies are taken from.
+        explicit TimestampConverter(const SystemInfo& system_info);
+
+        /// @brief Replace the clocks with those of another capture.
+        /// @param [in] system_info The system info the clock frequencies are taken from.
+        void Reset(const SystemInfo& system_info);
+
+        /// @brief Get the number of GPU clocks.
+        /// @return The number of GPUs in the system info.
+        size_t GetGpuCount() const
+        {
+            return gpu_clocks_.size();
+        }
+
+        /// @brief Get the number of CPU clocks.
+        /// @return The number of CPUs in the system info.
+        size_t GetCpuCount() const
+        {
+            return cpu_clocks_.size();
+        }
+
+        /// @brief Get the clock of a GPU.
+        /// @param [in] gpu The index of the GPU in SystemInfo::gpus.
+        /// @return The clock of the GPU.
+        const TimestampClock& GetGpuClock(size_t gpu) const
+        {
+            return gpu_clocks_[gpu];
+        }
+
+        /// @brief Get the clock of a CPU.
+        /// @param [in] cpu The index of the CPU in SystemInfo::cpus.
+        /// @return The clock of the CPU.
+        const TimestampClock& GetCpuClock(size_t cpu) const
+        {
+            return cpu_clocks_[cpu];
+        }
+
+        /// @brief Convert GPU timestamps to nanoseconds.
+        /// @param [in] gpu The index of the GPU in SystemInfo::gpus.
+        /// @param [in] ticks The timestamps in ticks.
+        /// @param [out] out_nanoseconds The timestamps in nanoseconds. May be the same array as ticks.
+        /// @param [in] count The number of timestamps.
+        void ConvertGpu(size_t gpu, const uint64_t* ticks, uint64_t* out_nanoseconds, size_t count) const
+        {
+            gpu_clocks_[gpu].ToNanoseconds(ticks, out_nanoseconds, count);
+        }
+
+        /// @brief Convert CPU timestamps to nanoseconds.
+        /// @param [in] cpu The index of the CPU in SystemInfo::cpus.
+        /// @param [in] ticks The timestamps in ticks.
+        /// @param [out] out_nanoseconds The timestamps in nanoseconds. May be the same array as ticks.
+        /// @param [in] count The number of timestamps.
+        void ConvertCpu(size_t cpu, const uint64_t* ticks, uint64_t* out_nanoseconds, size_t count) const
+        {
+            cpu_clocks_[cpu].ToNanoseconds(ticks, out_nanoseconds, count);
+        }
+
+    private:
+        std::vector<TimestampClock> gpu_clocks_;  ///< The clock of each GPU.
+        std::vector<TimestampClock> cpu_clocks_;  ///< The clock of each CPU.
+    };
+}  // namespace system_info_utils
+
+#endif
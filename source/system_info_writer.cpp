@@ -0,0 +1,919 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief System info writer implementation
+//=============================================================================
+
+#include "system_info_writer.h"
+
+#include <cassert>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string_view>
+#include <unordered_map>
+
+#include "definitions.h"
+#include "system_info_cache.h"
+
+namespace
+{
+    using system_info_utils::CachedRange;
+    using system_info_utils::CachedString;
+    using system_info_utils::CacheHeader;
+    using system_info_utils::CacheSection;
+
+    /// @brief Builds the cache string table, storing each distinct string once.
+    class CacheStringTable
+    {
+    public:
+        /// @brief Add a string to the table.
+        ///
+        /// @param [in] value The string. Must outlive the table.
+        /// @param [out] out_string The location of the string in the table.
+        /// @return True if the string was added, and false if the table is too large.
+        bool Add(std::string_view value, CachedString& out_string)
+        {
+            auto iter = strings_.find(value);
+            if (iter != strings_.end())
+            {
+                out_string = iter->second;
+                return true;
+            }
+
+            if ((data_.size() + value.size() + 1) > UINT32_MAX)
+            {
+                return false;
+            }
+
+            out_string.offset = static_cast<uint32_t>(data_.size());
+            out_string.size   = static_cast<uint32_t>(value.size());
+
+            data_.insert(data_.end(), value.begin(), value.end());
+            data_.push_back('\0');
+            strings_.emplace(value, out_string);
+
+            return true;
+        }
+
+        /// @brief Get the string table bytes.
+        ///
+        /// @return The string table.
+        const std::vector<char>& GetData() const
+        {
+            return data_;
+        }
+
+    private:
+        std::vector<char>                                  data_;     ///< The null terminated strings.
+        std::unordered_map<std::string_view, CachedString> strings_;  ///< The strings already in the table.
+    };
+
+    /// @brief Make a range of records.
+    ///
+    /// @param [in] first The index of the first record.
+    /// @param [in] end The index after the last record.
+    /// @param [out] out_range The range.
+    /// @return True if the range fits in the cache format, and false if it doesn't.
+    bool MakeRange(size_t first, size_t end, CachedRange& out_range)
+    {
+        if (end > UINT32_MAX)
+        {
+            return false;
+        }
+
+        out_range.first = static_cast<uint32_t>(first);
+        out_range.count = static_cast<uint32_t>(end - first);
+
+        return true;
+    }
+
+    /// @brief Round an offset up to the alignment of the cache arrays.
+    ///
+    /// @param [in] offset The offset in bytes.
+    /// @return The aligned offset.
+    size_t AlignOffset(size_t offset)
+    {
+        return (offset + alignof(uint64_t) - 1) & ~(alignof(uint64_t) - 1);
+    }
+
+    /// @brief Place an array in the cache file, after the previous arrays.
+    ///
+    /// @param [in] section The section the array is stored in.
+    /// @param [in] records The records of the array.
+    /// @param [in, out] header The header to record the location of the array in.
+    /// @param [in, out] offset The offset of the end of the previous array, updated to the end of this one.
+    template <typename T>
+    void PlaceSection(CacheSection section, const std::vector<T>& records, CacheHeader& header, size_t& offset)
+    {
+        offset = AlignOffset(offset);
+
+        header.sections[static_cast<uint32_t>(section)].offset = offset;
+        header.sections[static_cast<uint32_t>(section)].count  = records.size();
+
+        offset += records.size() * sizeof(T);
+    }
+
+    /// @brief Copy an array to its location in the cache file.
+    ///
+    /// @param [in] section The section the array is stored in.
+    /// @param [in] records The records of the array.
+    /// @param [in] header The header containing the location of the array.
+    /// @param [in, out] out_data The cache file data.
+    template <typename T>
+    void CopySection(CacheSection section, const std::vector<T>& records, const CacheHeader& header, std::vector<uint8_t>& out_data)
+    {
+        if (!records.empty())
+        {
+            std::memcpy(out_data.data() + header.sections[static_cast<uint32_t>(section)].offset, records.data(), records.size() * sizeof(T));
+        }
+    }
+
+    /// @brief Appends JSON text to a string, inserting the separators between members and elements.
+    class JsonTextWriter
+    {
+    public:
+        /// @brief Constructor.
+        ///
+        /// @param [in, out] out The string the JSON text is appended to.
+        explicit JsonTextWriter(std::string& out)
+            : out_(out)
+            , separator_(false)
+        {
+        }
+
+        /// @brief Write the beginning of an object.
+        void BeginObject()
+        {
+            Separate();
+            out_.push_back('{');
+            separator_ = false;
+        }
+
+        /// @brief Write the end of an object.
+        void EndObject()
+        {
+            out_.push_back('}');
+            separator_ = true;
+        }
+
+        /// @brief Write the beginning of an array.
+        void BeginArray()
+        {
+            Separate();
+            out_.push_back('[');
+            separator_ = false;
+        }
+
+        /// @brief Write the end of an array.
+        void EndArray()
+        {
+            out_.push_back(']');
+            separator_ = true;
+        }
+
+        /// @brief Write an object key.
+        ///
+        /// @param [in] key The key.
+        void Key(std::string_view key)
+        {
+            Separate();
+            AppendString(key);
+            out_.push_back(':');
+            separator_ = false;
+        }
+
+        /// @brief Write a string value.
+        ///
+        /// @param [in] value The string.
+        void String(std::string_view value)
+        {
+            Separate();
+            AppendString(value);
+            separator_ = true;
+        }
+
+        /// @brief Write an unsigned integer value.
+        ///
+        /// @param [in] value The number.
+        void Number(uint64_t value)
+        {
+            Separate();
+
+            char buffer[std::numeric_limits<uint64_t>::digits10 + 1];
+            auto end = std::to_chars(buffer, buffer + sizeof(buffer), value).ptr;
+            out_.append(buffer, static_cast<size_t>(end - buffer));
+            separator_ = true;
+        }
+
+        /// @brief Write a boolean value.
+        ///
+        /// @param [in] value The boolean.
+        void Boolean(bool value)
+        {
+            Separate();
+            out_.append(value ? "true" : "false");
+            separator_ = true;
+        }
+
+        /// @brief Write an object member with a string value.
+        ///
+        /// @param [in] key The key.
+        /// @param [in] value The string.
+        void Member(std::string_view key, std::string_view value)
+        {
+            Key(key);
+            String(value);
+        }
+
+        /// @brief Write an object member with an unsigned integer value.
+        ///
+        /// @param [in] key The key.
+        /// @param [in] value The number.
+        void Member(std::string_view key, uint64_t value)
+        {
+            Key(key);
+            Number(value);
+        }
+
+        /// @brief Write an object member with a boolean value.
+        ///
+        /// @param [in] key The key.
+        /// @param [in] value The boolean.
+        void Member(std::string_view key, bool value)
+        {
+            Key(key);
+            Boolean(value);
+        }
+
+    private:
+        /// @brief Write the separator before a member or element, unless it is the first of its container.
+        void Separate()
+        {
+            if (separator_)
+            {
+                out_.push_back(',');
+            }
+        }
+
+        /// @brief Write a quoted string, escaping the characters JSON requires to be escaped.
+        ///
+        /// @param [in] value The string. Other characters, including UTF-8 sequences, are copied as they are.
+        void AppendString(std::string_view value)
+        {
+            out_.push_back('"');
+
+            // Copy the runs of characters that need no escaping in one go.
+            size_t run_begin = 0;
+            for (size_t i = 0; i < value.size(); ++i)
+            {
+                const unsigned char c = static_cast<unsigned char>(value[i]);
+                if ((c >= 0x20) && (c != '"') && (c != '\\'))
+                {
+                    continue;
+                }
+
+                out_.append(value.data() + run_begin, i - run_begin);
+                run_begin = i + 1;
+
+                out_.push_back('\\');
+                switch (c)
+                {
+                case '"':
+                case '\\':
+                    out_.push_back(static_cast<char>(c));
+                    break;
+                case '\b':
+                    out_.push_back('b');
+                    break;
+                case '\f':
+                    out_.push_back('f');
+                    break;
+                case '\n':
+                    out_.push_back('n');
+                    break;
+                case '\r':
+                    out_.push_back('r');
+                    break;
+                case '\t':
+                    out_.push_back('t');
+                    break;
+                default:
+                {
+                    static constexpr char kHexDigits[] = "0123456789abcdef";
+
+                    const char escape[] = {'u', '0', '0', kHexDigits[c >> 4], kHexDigits[c & 0xf]};
+                    out_.append(escape, sizeof(escape));
+                    break;
+                }
+                }
+            }
+
+            out_.append(value.data() + run_begin, value.size() - run_begin);
+            out_.push_back('"');
+        }
+
+        std::string& out_;        ///< The JSON text.
+        bool         separator_;  ///< True if the next member or element needs a separator.
+    };
+
+    /// @brief Estimate the size of the JSON text of a system info structure.
+    ///
+    /// @param [in] system_info The system info structure.
+    /// @return The estimated size in bytes, so the text can usually be written without reallocating.
+    size_t EstimateJsonSize(const system_info_utils::SystemInfo& system_info)
+    {
+        // The fixed part of each element covers its keys and numbers.
+        size_t size = 1024 + system_info.driver.name.size() + system_info.driver.description.size() + system_info.driver.packaging_version.size() +
+                      system_info.driver.software_version.size() + system_info.devdriver.tag.size() + system_info.os.name.size() + system_info.os.desc.size() +
+                      system_info.os.hostname.size() + system_info.os.memory.type.size();
+
+        for (const system_info_utils::CpuInfo& cpu : system_info.cpus)
+        {
+            size += 256 + cpu.name.size() + cpu.cpu_id.size() + cpu.device_id.size() + cpu.architecture.size() + cpu.vendor_id.size() +
+                    cpu.virtualization.size();
+        }
+
+        for (const system_info_utils::GpuInfo& gpu : system_info.gpus)
+        {
+            size += 1024 + gpu.name.size() + gpu.memory.type.size() + (gpu.asic.cu_mask.Masks().size() * 11) + (gpu.memory.excluded_va_ranges.size() * 64);
+            for (const system_info_utils::HeapInfo& heap : gpu.memory.heaps)
+            {
+                size += 64 + heap.heap_type.size();
+            }
+        }
+
+        for (const system_info_utils::Process& process : system_info.processes)
+        {
+            size += 48 + process.name.size() + process.path.size();
+        }
+
+        for (const system_info_utils::ProcessView& process : system_info.process_table)
+        {
+            size += 48 + process.name.size() + process.path.size();
+        }
+
+        return size;
+    }
+
+    /// @brief Write a clock info object.
+    ///
+    /// @param [in] clock The clock info.
+    /// @param [in, out] writer The JSON writer.
+    void WriteClock(const system_info_utils::ClockInfo& clock, JsonTextWriter& writer)
+    {
+        writer.BeginObject();
+        writer.Member(kNodeStringMin, clock.min);
+        writer.Member(kNodeStringMax, clock.max);
+        writer.EndObject();
+    }
+
+    /// @brief Write the driver and DevDriver info.
+    ///
+    /// @param [in] system_info The system info structure.
+    /// @param [in, out] writer The JSON writer.
+    void WriteDriver(const system_info_utils::SystemInfo& system_info, JsonTextWriter& writer)
+    {
+        writer.Key(kNodeStringDevDriver);
+        writer.BeginObject();
+        writer.Key(kNodeStringVersion);
+        writer.BeginObject();
+        writer.Member(kNodeStringMajor, uint64_t{system_info.devdriver.major_version});
+        writer.EndObject();
+        writer.Member(kNodeStringTag, system_info.devdriver.tag);
+        writer.EndObject();
+
+        const system_info_utils::DriverInfo& driver = system_info.driver;
+        writer.Key(kNodeStringDriver);
+        writer.BeginObject();
+        writer.Member(kNodeStringName, driver.name);
+        writer.Member(kNodeStringDescription, driver.description);
+        writer.Member(kNodeStringDriverPackagingVersion, driver.packaging_version);
+        writer.Member(kNodeStringDriverSoftwareVersion, driver.software_version);
+        writer.Member(kNodeStringIsClosedSource, driver.is_closed_source);
+        writer.EndObject();
+    }
+
+    /// @brief Write the OS info.
+    ///
+    /// @param [in] os The OS info.
+    /// @param [in, out] writer The JSON writer.
+    void WriteOs(const system_info_utils::OsInfo& os, JsonTextWriter& writer)
+    {
+        writer.Key(kNodeStringOs);
+        writer.BeginObject();
+        writer.Member(kNodeStringName, os.name);
+        writer.Member(kNodeStringDescription, os.desc);
+        writer.Member(kNodeStringHostName, os.hostname);
+
+        writer.Key(kNodeStringMemory);
+        writer.BeginObject();
+        writer.Member(kNodeStringMemoryPhysical, os.memory.physical);
+        writer.Member(kNodeStringMemorySwap, os.memory.swap);
+        writer.Member(kNodeStringName, os.memory.type);
+        writer.EndObject();
+
+        // Both platform configurations are written, so the structure is preserved whichever platform it came from.
+        writer.Key(kNodeStringConfig);
+        writer.BeginObject();
+        writer.Key(kNodeStringLinux);
+        writer.BeginObject();
+        writer.Member(kNodeStringPowerDpmWritable, os.config.power_dpm_writable);
+        writer.Key(kNodeStringDrm);
+        writer.BeginObject();
+        writer.Member(kNodeStringMajor, uint64_t{os.config.drm_major_version});
+        writer.Member(kNodeStringMinor, uint64_t{os.config.drm_minor_version});
+        writer.EndObject();
+        writer.EndObject();
+
+        const system_info_utils::EtwSupportInfo& etw = os.config.etw_support_info;
+        writer.Key(kNodeStringWindows);
+        writer.BeginObject();
+        writer.Key(kNodeStringEtwSupport);
+        writer.BeginObject();
+        writer.Member(kNodeStringSupported, etw.is_supported);
+        writer.Member(kNodeStringHasPermission, etw.has_permission);
+        writer.Member(kNodeStringStatusCode, uint64_t{etw.status_code});
+        writer.Member(kNodeStringEtwRegistryOrUserGroup, etw.needs_rgp_registry_or_usergroup);
+        writer.EndObject();
+        writer.EndObject();
+        writer.EndObject();
+
+        writer.EndObject();
+    }
+
+    /// @brief Write the CPU list.
+    ///
+    /// @param [in] cpus The CPUs.
+    /// @param [in, out] writer The JSON writer.
+    void WriteCpus(const std::vector<system_info_utils::CpuInfo>& cpus, JsonTextWriter& writer)
+    {
+        writer.Key(kNodeStringCpus);
+        writer.BeginArray();
+        for (const system_info_utils::CpuInfo& cpu : cpus)
+        {
+            writer.BeginObject();
+            writer.Member(kNodeStringName, cpu.name);
+            writer.Member(kNodeStringArchitecture, cpu.architecture);
+            writer.Member(kNodeStringCpuId, cpu.cpu_id);
+            writer.Member(kNodeStringCpuDeviceId, cpu.device_id);
+            writer.Member(kNodeStringCpuVendorId, cpu.vendor_id);
+            writer.Member(kNodeStringVirtualization, cpu.virtualization);
+            writer.Member(kNodeStringCpuLogicalCoreCount, uint64_t{cpu.num_logical_cores});
+            writer.Member(kNodeStringCpuPhysicalCoreCount, uint64_t{cpu.num_physical_cores});
+            writer.Key(kNodeStringSpeed);
+            writer.BeginObject();
+            writer.Member(kNodeStringMax, uint64_t{cpu.max_clock_speed});
+            writer.EndObject();
+            writer.Member(kNodeStringCpuTimeClockFreq, cpu.timestamp_clock_frequency);
+            writer.EndObject();
+        }
+        writer.EndArray();
+    }
+
+    /// @brief Write the ASIC info of a GPU.
+    ///
+    /// @param [in] asic The ASIC info.
+    /// @param [in, out] writer The JSON writer.
+    void WriteAsic(const system_info_utils::AsicInfo& asic, JsonTextWriter& writer)
+    {
+        writer.Key(kNodeStringAsic);
+        writer.BeginObject();
+        writer.Member(kNodeStringAsicGpuIndex, uint64_t{asic.gpu_index});
+        writer.Member(kNodeStringAsicGpuCounterFrequency, asic.gpu_counter_freq);
+        writer.Member(kNodeStringAsicNumSe, uint64_t{asic.num_shader_engines});
+        writer.Member(kNodeStringAsicNumSaPerSe, uint64_t{asic.num_shader_arrays_per_engine});
+        writer.Member(kNodeStringAsicNumCus, uint64_t{asic.num_cus});
+
+        writer.Key(kNodeStringAsicCuMask);
+        writer.BeginArray();
+        for (const auto& shader_engine : asic.cu_mask)
+        {
+            writer.BeginArray();
+            for (uint32_t shader_array_mask : shader_engine)
+            {
+                writer.Number(shader_array_mask);
+            }
+            writer.EndArray();
+        }
+        writer.EndArray();
+
+        writer.Key(kNodeStringAsicEngineClockSpeed);
+        WriteClock(asic.engine_clock_hz, writer);
+
+        // The LUID is written as the hex digits of its bytes in memory order.
+        static constexpr char kHexDigits[] = "0123456789abcdef";
+
+        char luid[sizeof(asic.id_info.luid) * 2];
+        for (size_t i = 0; i < sizeof(asic.id_info.luid); ++i)
+        {
+            luid[i * 2]     = kHexDigits[asic.id_info.luid[i] >> 4];
+            luid[i * 2 + 1] = kHexDigits[asic.id_info.luid[i] & 0xf];
+        }
+
+        const system_info_utils::IdInfo& ids = asic.id_info;
+        writer.Key(kNodeStringAsicIds);
+        writer.BeginObject();
+        writer.Member(kNodeStringAsicGfxEngine, uint64_t{ids.gfx_engine});
+        writer.Member(kNodeStringAsicFamily, uint64_t{ids.family});
+        writer.Member(kNodeStringAsicERev, uint64_t{ids.e_rev});
+        writer.Member(kNodeStringAsicRevision, uint64_t{ids.revision});
+        writer.Member(kNodeStringDevice, uint64_t{ids.device});
+        writer.Member(kNodeStringAsicSubsystem, uint64_t{ids.subsystem});
+        writer.Member(kNodeStringAsicVendor, uint64_t{ids.vendor});
+        writer.Member(kNodeStringAsicLuid, std::string_view(luid, sizeof(luid)));
+        writer.EndObject();
+
+        writer.EndObject();
+    }
+
+    /// @brief Write the memory info of a GPU.
+    ///
+    /// @param [in] memory The memory info.
+    /// @param [in, out] writer The JSON writer.
+    void WriteGpuMemory(const system_info_utils::MemoryInfo& memory, JsonTextWriter& writer)
+    {
+        writer.Key(kNodeStringMemory);
+        writer.BeginObject();
+        writer.Member(kNodeStringType, memory.type);
+        writer.Member(kNodeStringMemoryOpsPerClock, uint64_t{memory.mem_ops_per_clock});
+        writer.Member(kNodeStringMemoryBusBitWidth, uint64_t{memory.bus_bit_width});
+        writer.Member(kNodeStringMemoryBandwith, memory.bandwidth);
+
+        writer.Key(kNodeStringMemoryClockSpeed);
+        WriteClock(memory.mem_clock_hz, writer);
+
+        // Heaps are keyed by the heap type.
+        writer.Key(kNodeStringHeaps);
+        writer.BeginObject();
+        for (const system_info_utils::HeapInfo& heap : memory.heaps)
+        {
+            writer.Key(heap.heap_type);
+            writer.BeginObject();
+            writer.Member(kNodeStringPhysicalAddress, heap.phys_addr);
+            writer.Member(kNodeStringSize, heap.size);
+            writer.EndObject();
+        }
+        writer.EndObject();
+
+        writer.Key(kNodeStringExcludedVaRanges);
+        writer.BeginArray();
+        for (const system_info_utils::ExcludedRangeInfo& range : memory.excluded_va_ranges)
+        {
+            writer.BeginObject();
+            writer.Member(kNodeStringBase, range.base);
+            writer.Member(kNodeStringSize, range.size);
+            writer.EndObject();
+        }
+        writer.EndArray();
+
+        writer.EndObject();
+    }
+
+    /// @brief Write the GPU list.
+    ///
+    /// @param [in] gpus The GPUs.
+    /// @param [in, out] writer The JSON writer.
+    void WriteGpus(const std::vector<system_info_utils::GpuInfo>& gpus, JsonTextWriter& writer)
+    {
+        writer.Key(kNodeStringGpus);
+        writer.BeginArray();
+        for (const system_info_utils::GpuInfo& gpu : gpus)
+        {
+            writer.BeginObject();
+            writer.Member(kNodeStringName, gpu.name);
+
+            writer.Key(kNodeStringPci);
+            writer.BeginObject();
+            writer.Member(kNodeStringPciBus, uint64_t{gpu.pci.bus});
+            writer.Member(kNodeStringDevice, uint64_t{gpu.pci.device});
+            writer.Member(kNodeStringPciFunction, uint64_t{gpu.pci.function});
+            writer.EndObject();
+
+            WriteAsic(gpu.asic, writer);
+            WriteGpuMemory(gpu.memory, writer);
+
+            writer.Key(kNodeStringBigSw);
+            writer.BeginObject();
+            writer.Member(kNodeStringMajor, uint64_t{gpu.big_sw.major});
+            writer.Member(kNodeStringMinor, uint64_t{gpu.big_sw.minor});
+            writer.Member(kNodeStringMisc, uint64_t{gpu.big_sw.misc});
+            writer.EndObject();
+
+            writer.EndObject();
+        }
+        writer.EndArray();
+    }
+
+    /// @brief Write a process.
+    ///
+    /// @param [in] name The process name.
+    /// @param [in] path The process filepath.
+    /// @param [in] id The process ID.
+    /// @param [in, out] writer The JSON writer.
+    void WriteProcess(std::string_view name, std::string_view path, uint32_t id, JsonTextWriter& writer)
+    {
+        writer.BeginObject();
+        writer.Member(kNodeStringName, name);
+        writer.Member(kNodeStringPath, path);
+        writer.Member(kNodeStringProcessId, uint64_t{id});
+        writer.EndObject();
+    }
+}  // namespace
+
+namespace system_info_utils
+{
+    bool SystemInfoWriter::Serialize(const SystemInfo& system_info, uint64_t key, std::vector<uint8_t>& out_data)
+    {
+        bool result = true;
+
+        SYSTEM_INFO_TRY
+        {
+            CacheStringTable strings;
+
+            std::vector<CachedSystemInfo>  systems(1);
+            std::vector<CachedCpuInfo>     cpus(system_info.cpus.size());
+            std::vector<CachedGpuInfo>     gpus(system_info.gpus.size());
+            std::vector<CachedHeapInfo>    heaps;
+            std::vector<ExcludedRangeInfo> excluded_va_ranges;
+            std::vector<CachedRange>       cu_mask_rows;
+            std::vector<uint32_t>          cu_mask_values;
+            std::vector<CachedProcess>     processes(system_info.processes.size() + system_info.process_table.size());
+
+            CachedSystemInfo& system = systems[0];
+            system.version           = system_info.version;
+
+            const DriverInfo& driver              = system_info.driver;
+            system.driver.packaging_version_major = driver.packaging_version_major;
+            system.driver.packaging_version_minor = driver.packaging_version_minor;
+            system.driver.is_closed_source        = driver.is_closed_source ? 1 : 0;
+            result &= strings.Add(driver.name, system.driver.name);
+            result &= strings.Add(driver.description, system.driver.description);
+            result &= strings.Add(driver.packaging_version, system.driver.packaging_version);
+            result &= strings.Add(driver.software_version, system.driver.software_version);
+
+            system.devdriver.major_version = system_info.devdriver.major_version;
+            result &= strings.Add(system_info.devdriver.tag, system.devdriver.tag);
+
+            const OsInfo& os                              = system_info.os;
+            system.os.memory_physical                     = os.memory.physical;
+            system.os.memory_swap                         = os.memory.swap;
+            system.os.power_dpm_writable                  = os.config.power_dpm_writable ? 1 : 0;
+            system.os.drm_major_version                   = os.config.drm_major_version;
+            system.os.drm_minor_version                   = os.config.drm_minor_version;
+            system.os.etw_is_supported                    = os.config.etw_support_info.is_supported ? 1 : 0;
+            system.os.etw_has_permission                  = os.config.etw_support_info.has_permission ? 1 : 0;
+            system.os.etw_status_code                     = os.config.etw_support_info.status_code;
+            system.os.etw_needs_rgp_registry_or_usergroup = os.config.etw_support_info.needs_rgp_registry_or_usergroup ? 1 : 0;
+            result &= strings.Add(os.name, system.os.name);
+            result &= strings.Add(os.desc, system.os.desc);
+            result &= strings.Add(os.hostname, system.os.hostname);
+            result &= strings.Add(os.memory.type, system.os.memory_type);
+
+            for (size_t i = 0; i < system_info.cpus.size(); ++i)
+            {
+                const CpuInfo& cpu                   = system_info.cpus[i];
+                CachedCpuInfo& cached_cpu            = cpus[i];
+                cached_cpu.num_physical_cores        = cpu.num_physical_cores;
+                cached_cpu.num_logical_cores         = cpu.num_logical_cores;
+                cached_cpu.max_clock_speed           = cpu.max_clock_speed;
+                cached_cpu.timestamp_clock_frequency = cpu.timestamp_clock_frequency;
+                result &= strings.Add(cpu.name, cached_cpu.name);
+                result &= strings.Add(cpu.cpu_id, cached_cpu.cpu_id);
+                result &= strings.Add(cpu.device_id, cached_cpu.device_id);
+                result &= strings.Add(cpu.architecture, cached_cpu.architecture);
+                result &= strings.Add(cpu.vendor_id, cached_cpu.vendor_id);
+                result &= strings.Add(cpu.virtualization, cached_cpu.virtualization);
+            }
+
+            for (size_t i = 0; i < system_info.gpus.size(); ++i)
+            {
+                const GpuInfo& gpu                      = system_info.gpus[i];
+                CachedGpuInfo& cached_gpu               = gpus[i];
+                cached_gpu.pci                          = gpu.pci;
+                cached_gpu.gpu_index                    = gpu.asic.gpu_index;
+                cached_gpu.gpu_counter_freq             = gpu.asic.gpu_counter_freq;
+                cached_gpu.engine_clock_hz              = gpu.asic.engine_clock_hz;
+                cached_gpu.num_shader_engines           = gpu.asic.num_shader_engines;
+                cached_gpu.num_shader_arrays_per_engine = gpu.asic.num_shader_arrays_per_engine;
+                cached_gpu.num_cus                      = gpu.asic.num_cus;
+                cached_gpu.id_info                      = gpu.asic.id_info;
+                cached_gpu.mem_ops_per_clock            = gpu.memory.mem_ops_per_clock;
+                cached_gpu.bus_bit_width                = gpu.memory.bus_bit_width;
+                cached_gpu.bandwidth                    = gpu.memory.bandwidth;
+                cached_gpu.mem_clock_hz                 = gpu.memory.mem_clock_hz;
+                cached_gpu.big_sw                       = gpu.big_sw;
+                result &= strings.Add(gpu.name, cached_gpu.name);
+                result &= strings.Add(gpu.memory.type, cached_gpu.memory_type);
+
+                const size_t cu_mask_rows_begin = cu_mask_rows.size();
+                for (const auto& row : gpu.asic.cu_mask)
+                {
+                    CachedRange cached_row = {};
+                    result &= MakeRange(cu_mask_values.size(), cu_mask_values.size() + row.size(), cached_row);
+                    cu_mask_values.insert(cu_mask_values.end(), row.begin(), row.end());
+                    cu_mask_rows.push_back(cached_row);
+                }
+                result &= MakeRange(cu_mask_rows_begin, cu_mask_rows.size(), cached_gpu.cu_mask);
+
+                const size_t heaps_begin = heaps.size();
+                for (const HeapInfo& heap : gpu.memory.heaps)
+                {
+                    CachedHeapInfo cached_heap = {};
+                    cached_heap.phys_addr      = heap.phys_addr;
+                    cached_heap.size           = heap.size;
+                    result &= strings.Add(heap.heap_type, cached_heap.heap_type);
+                    heaps.push_back(cached_heap);
+                }
+                result &= MakeRange(heaps_begin, heaps.size(), cached_gpu.heaps);
+
+                const size_t excluded_va_ranges_begin = excluded_va_ranges.size();
+                excluded_va_ranges.insert(excluded_va_ranges.end(), gpu.memory.excluded_va_ranges.begin(), gpu.memory.excluded_va_ranges.end());
+                result &= MakeRange(excluded_va_ranges_begin, excluded_va_ranges.size(), cached_gpu.excluded_va_ranges);
+            }
+
+            for (size_t i = 0; i < system_info.processes.size(); ++i)
+            {
+                const Process& process        = system_info.processes[i];
+                CachedProcess& cached_process = processes[i];
+                cached_process.id             = process.id;
+                result &= strings.Add(process.name, cached_process.name);
+                result &= strings.Add(process.path, cached_process.path);
+            }
+
+            // The cache stores a single process list, with the processes of the table after the others.
+            for (size_t i = 0; i < system_info.process_table.size(); ++i)
+            {
+                const ProcessView process        = system_info.process_table[i];
+                CachedProcess&    cached_process = processes[system_info.processes.size() + i];
+                cached_process.id                = process.id;
+                result &= strings.Add(process.name, cached_process.name);
+                result &= strings.Add(process.path, cached_process.path);
+            }
+
+            if (result)
+            {
+                CacheHeader header = {};
+                header.magic       = kSystemInfoCacheMagic;
+                header.version     = kSystemInfoCacheVersion;
+                header.key         = key;
+
+                size_t offset = sizeof(CacheHeader);
+                PlaceSection(CacheSection::kSystem, systems, header, offset);
+                PlaceSection(CacheSection::kCpus, cpus, header, offset);
+                PlaceSection(CacheSection::kGpus, gpus, header, offset);
+                PlaceSection(CacheSection::kHeaps, heaps, header, offset);
+                PlaceSection(CacheSection::kExcludedVaRanges, excluded_va_ranges, header, offset);
+                PlaceSection(CacheSection::kCuMaskRows, cu_mask_rows, header, offset);
+                PlaceSection(CacheSection::kCuMaskValues, cu_mask_values, header, offset);
+                PlaceSection(CacheSection::kProcesses, processes, header, offset);
+                PlaceSection(CacheSection::kStrings, strings.GetData(), header, offset);
+                header.size = offset;
+
+                out_data.assign(offset, 0);
+                std::memcpy(out_data.data(), &header, sizeof(header));
+                CopySection(CacheSection::kSystem, systems, header, out_data);
+                CopySection(CacheSection::kCpus, cpus, header, out_data);
+                CopySection(CacheSection::kGpus, gpus, header, out_data);
+                CopySection(CacheSection::kHeaps, heaps, header, out_data);
+                CopySection(CacheSection::kExcludedVaRanges, excluded_va_ranges, header, out_data);
+                CopySection(CacheSection::kCuMaskRows, cu_mask_rows, header, out_data);
+                CopySection(CacheSection::kCuMaskValues, cu_mask_values, header, out_data);
+                CopySection(CacheSection::kProcesses, processes, header, out_data);
+                CopySection(CacheSection::kStrings, strings.GetData(), header, out_data);
+            }
+        }
+        SYSTEM_INFO_CATCH(...)
+        {
+            // There was a failure in serializing the system info.
+            result = false;
+        }
+
+        return result;
+    }
+
+    bool SystemInfoWriter::Serialize(const SystemInfo& system_info, uint64_t key, const std::string& path)
+    {
+        std::vector<uint8_t> data;
+
+        bool result = Serialize(system_info, key, data);
+        if (result)
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+            result = file.good();
+        }
+
+        return result;
+    }
+
+    bool SystemInfoWriter::Write(const SystemInfo& system_info, std::string& out_json)
+    {
+        bool result = true;
+
+        SYSTEM_INFO_TRY
+        {
+            out_json.clear();
+            out_json.reserve(EstimateJsonSize(system_info));
+
+            JsonTextWriter writer(out_json);
+            writer.BeginObject();
+
+            // Version 1 is identified by a plain version number, and later versions by a version object.
+            const bool is_version_1 = system_info.version.major < 2;
+            writer.Key(kNodeStringVersion);
+            if (is_version_1)
+            {
+                writer.Number(1);
+            }
+            else
+            {
+                writer.BeginObject();
+                writer.Member(kNodeStringMajor, uint64_t{system_info.version.major});
+                writer.Member(kNodeStringMinor, uint64_t{system_info.version.minor});
+                writer.Member(kNodeStringPatch, uint64_t{system_info.version.patch});
+                writer.Member(kNodeStringBuild, uint64_t{system_info.version.build});
+                writer.EndObject();
+            }
+
+            WriteDriver(system_info, writer);
+            WriteOs(system_info.os, writer);
+            WriteCpus(system_info.cpus, writer);
+            WriteGpus(system_info.gpus, writer);
+
+            // Version 1 does not include the process list.
+            if (!is_version_1)
+            {
+                writer.Key(kNodeStringProcesses);
+                writer.BeginArray();
+                for (const Process& process : system_info.processes)
+                {
+                    WriteProcess(process.name, process.path, process.id, writer);
+                }
+                for (const ProcessView& process : system_info.process_table)
+                {
+                    WriteProcess(process.name, process.path, process.id, writer);
+                }
+                writer.EndArray();
+            }
+
+            writer.EndObject();
+        }
+        SYSTEM_INFO_CATCH(...)
+        {
+            // There was a failure in writing the system info.
+            out_json.clear();
+            result = false;
+        }
+
+        return result;
+    }
+
+#ifdef SYSTEM_INFO_ENABLE_RDF
+#ifdef RDF_CXX_BINDINGS
+    bool SystemInfoWriter::Write(const SystemInfo& system_info, rdf::ChunkFileWriter& writer, std::string& buffer)
+    {
+        bool result = Write(system_info, buffer);
+
+        if (result)
+        {
+            SYSTEM_INFO_TRY
+            {
+                writer.WriteChunk(
+                    kSystemInfoChunkIdentifier, 0, nullptr, static_cast<int64_t>(buffer.size()), buffer.data(), rdfCompressionNone, kSystemInfoChunkVersion);
+            }
+            SYSTEM_INFO_CATCH(...)
+            {
+                // The RDF bindings report write failures as exceptions.
+                result = false;
+            }
+        }
+
+        return result;
+    }
+#endif
+    bool SystemInfoWriter::Write(const SystemInfo& system_info, rdfChunkFileWriter* writer, std::string& buffer)
+    {
+        assert(writer != nullptr);
+
+        bool result = Write(system_info, buffer);
+
+        if (result)
+        {
+            rdfChunkCreateInfo info = {};
+            std::memcpy(info.identifier, kSystemInfoChunkIdentifier, std::strlen(kSystemInfoChunkIdentifier));
+            info.headerSize  = 0;
+            info.pHeader     = nullptr;
+            info.compression = rdfCompressionNone;
+            info.version     = kSystemInfoChunkVersion;
+
+            int64_t index = 0;
+            result        = rdfChunkFileWriterWriteChunk(writer, &info, static_cast<int64_t>(buffer.size()), buffer.data(), &index) == rdfResultOk;
+        }
+
+        return result;
+    }
+#endif
+}  // namespace system_info_utils
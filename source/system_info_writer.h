@@ -0,0 +1,73 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief System info writer definition
+//=============================================================================
+
+#ifndef SYSTEM_INFO_UTILS_SOURCE_SYSTEM_INFO_WRITER_H_
+#define SYSTEM_INFO_UTILS_SOURCE_SYSTEM_INFO_WRITER_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "system_info_reader.h"
+
+namespace system_info_utils
+{
+    /// @brief Writes system info structures.
+    class SystemInfoWriter
+    {
+    public:
+        /// @brief Default constructor
+        SystemInfoWriter() = delete;
+
+        /// @brief Default destructor
+        ~SystemInfoWriter() = delete;
+
+        /// @brief Serializes system info to the binary cache format read by SystemInfoCache.
+        /// @param [in] system_info The system info structure.
+        /// @param [in] key The key of the source the system info was parsed from. See SystemInfoCache::ComputeKey.
+        /// @param [in, out] out_data The serialized cache. Its previous contents are replaced.
+        /// @return true if successfully serialized, false if the system info is too large for the format
+        static bool Serialize(const SystemInfo& system_info, uint64_t key, std::vector<uint8_t>& out_data);
+
+        /// @brief Serializes system info to a binary cache file.
+        /// @param [in] system_info The system info structure.
+        /// @param [in] key The key of the source the system info was parsed from. See SystemInfoCache::ComputeKey.
+        /// @param [in] path The path of the cache file to write.
+        /// @return true if successfully written, false otherwise
+        static bool Serialize(const SystemInfo& system_info, uint64_t key, const std::string& path);
+
+        /// @brief Writes system info as the JSON text of a System Info chunk, without a 'system' node around it.
+        ///
+        /// Version 1 system info is written with a version number and no process list. Later versions are
+        /// written with a version object and the process list, followed by the processes of the process table.
+        /// The text is written directly, without building a JSON DOM.
+        ///
+        /// @param [in] system_info The system info structure.
+        /// @param [in, out] out_json The JSON text. Its previous contents are replaced, keeping its capacity.
+        /// @return true if successfully written, false otherwise
+        static bool Write(const SystemInfo& system_info, std::string& out_json);
+
+#ifdef SYSTEM_INFO_ENABLE_RDF
+#ifdef RDF_CXX_BINDINGS
+        /// @brief Writes system info as a System Info chunk to an RDF file.
+        /// @param [in] system_info The system info structure.
+        /// @param [in] writer The RDF chunk file writer.
+        /// @param [in, out] buffer The buffer the JSON text is written into. Reusing it avoids an allocation per chunk.
+        /// @return true if successfully written, false otherwise
+        static bool Write(const SystemInfo& system_info, rdf::ChunkFileWriter& writer, std::string& buffer);
+#endif
+        /// @brief Writes system info as a System Info chunk to an RDF file.
+        /// @param [in] system_info The system info structure.
+        /// @param [in] writer The RDF chunk file writer.
+        /// @param [in, out] buffer The buffer the JSON text is written into. Reusing it avoids an allocation per chunk.
+        /// @return true if successfully written, false otherwise
+        static bool Write(const SystemInfo& system_info, rdfChunkFileWriter* writer, std::string& buffer);
+#endif
+    };
+}  // namespace system_info_utils
+
+#endif
@@ -0,0 +1,134 @@
+//=============================================================================
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief System info reader regression tests
+///
+/// Usage: system_info_test
+///   Returns a non-zero exit code if any check fails.
+//=============================================================================
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "system_info_reader.h"
+#include "system_info_writer.h"
+
+namespace
+{
+    int failure_count = 0;  ///< The number of failed checks.
+
+    /// @brief Record the outcome of a check.
+    /// @param [in] passed True if the check passed.
+    /// @param [in] name The name of the check.
+    void Check(bool passed, const char* name)
+    {
+        if (!passed)
+        {
+            printf("FAILED: %s\n", name);
+            ++failure_count;
+        }
+    }
+
+    /// @brief Build a System Info chunk with 3 GPUs and 2 processes, wrapped in a 'system' node.
+    /// @return The System Info JSON text.
+    std::string MakeSystemInfoJson()
+    {
+        system_info_utils::SystemInfo system_info;
+        system_info.version.major = 2;
+        system_info.gpus.resize(3);
+        system_info.processes.resize(2);
+        system_info.processes[0].name = "a.exe";
+        system_info.processes[0].id   = 1;
+        system_info.processes[1].name = "b.exe";
+        system_info.processes[1].id   = 2;
+
+        std::string json;
+        system_info_utils::SystemInfoWriter::Write(system_info, json);
+        return "{\"system\": " + json + "}";
+    }
+
+    /// @brief Check that a section-filtered parse rejects malformed JSON in a section it skips, like a full parse.
+    void TestFilteredParseRejectsSkippedSyntaxError()
+    {
+        using system_info_utils::SystemInfoReader;
+
+        std::string  json     = MakeSystemInfoJson();
+        const size_t position = json.find("\"processes\":[");
+        Check(position != std::string::npos, "filtered parse: processes found");
+        json.insert(position + 13, "{\"name\": tru}, ");
+
+        system_info_utils::SystemInfo            full_info;
+        system_info_utils::SystemInfoParseResult full = SystemInfoReader::TryParse(json.data(), json.size(), full_info);
+
+        system_info_utils::SystemInfo            filtered_info;
+        system_info_utils::SystemInfoParseResult filtered = SystemInfoReader::TryParse(
+            json.data(), json.size(), filtered_info, system_info_utils::kSystemInfoSectionDriver | system_info_utils::kSystemInfoSectionGpus);
+
+        Check(full.error == system_info_utils::SystemInfoParseError::kSyntax, "filtered parse: full parse fails");
+        Check(filtered.error == full.error, "filtered parse: same error");
+        Check(filtered.offset == full.offset, "filtered parse: same offset");
+        Check(filtered.pointer == full.pointer, "filtered parse: same pointer");
+        Check(filtered.pointer == "/system/processes/0/name", "filtered parse: pointer");
+
+        // Valid JSON in a skipped section is still skipped.
+        json = MakeSystemInfoJson();
+
+        system_info_utils::SystemInfo valid_info;
+        filtered = SystemInfoReader::TryParse(
+            json.data(), json.size(), valid_info, system_info_utils::kSystemInfoSectionDriver | system_info_utils::kSystemInfoSectionGpus);
+        Check(filtered.IsSucceeded() && (valid_info.gpus.size() == 3) && valid_info.processes.empty(), "filtered parse: valid text");
+
+        system_info_utils::SystemInfo all_info;
+        full = SystemInfoReader::TryParse(json.data(), json.size(), all_info);
+        Check(full.IsSucceeded() && (all_info.gpus.size() == 3) && (all_info.processes.size() == 2), "full parse: valid text");
+    }
+
+    /// @brief Check that a repeated key keeps only the last member, like the DOM based parser.
+    void TestRepeatedKeys()
+    {
+        using system_info_utils::SystemInfoReader;
+
+        const std::string cpus = "{\"system\":{\"version\":2,\"cpus\":[{\"name\":\"a\"}],\"cpus\":[{\"name\":\"b\"},{\"name\":\"c\"}]}}";
+
+        system_info_utils::SystemInfo cpus_info;
+        Check(SystemInfoReader::Parse(cpus, cpus_info), "repeated keys: lists parsed");
+        Check((cpus_info.cpus.size() == 2) && (cpus_info.cpus[0].name == "b") && (cpus_info.cpus[1].name == "c"), "repeated keys: last list kept");
+
+        const std::string driver = "{\"system\":{\"version\":2,\"driver\":{\"name\":5},\"driver\":{\"name\":\"ok\"}}}";
+
+        system_info_utils::SystemInfo driver_info;
+        Check(SystemInfoReader::Parse(driver, driver_info), "repeated keys: invalid member replaced");
+        Check(driver_info.driver.name == "ok", "repeated keys: last member kept");
+    }
+
+    /// @brief Check which text the string overload returns for the 'system' node.
+    void TestSystemNodeText()
+    {
+        using system_info_utils::SystemInfoReader;
+
+        Check(SystemInfoReader::Parse(std::string("{\"system\": {\"a\": 1}}")) == "{\"a\": 1}", "system node: valid");
+        Check(SystemInfoReader::Parse(std::string("{\"a\": 1}")) == "{\"a\": 1}", "system node: unwrapped");
+        Check(SystemInfoReader::Parse(std::string("{\"system\": {\"a\": tru}}")).empty(), "system node: invalid value");
+        Check(SystemInfoReader::Parse(std::string("{\"system\": {\"a\": 1}} x")).empty(), "system node: trailing text");
+        Check(SystemInfoReader::Parse(std::string("{\"system\": {\"a\": 1}}{}")).empty(), "system node: trailing value");
+        Check(SystemInfoReader::Parse(std::string("")).empty(), "system node: empty");
+        Check(SystemInfoReader::Parse(std::string(" \n\t")).empty(), "system node: whitespace");
+        Check(SystemInfoReader::Parse(std::string("{\"system\": {\"a\": 1}, \"system\": {\"b\": 2}}")) == "{\"b\": 2}", "system node: last of repeated keys");
+    }
+}  // namespace
+
+int main()
+{
+    TestFilteredParseRejectsSkippedSyntaxError();
+    TestRepeatedKeys();
+    TestSystemNodeText();
+
+    if (failure_count == 0)
+    {
+        printf("All checks passed\n");
+    }
+
+    return (failure_count == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
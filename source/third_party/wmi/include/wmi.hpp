@@ -8,11 +8,19 @@
 #ifndef WMI_HPP
 #define WMI_HPP
 
+#include <future>
+#include <map>
+#include <memory>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include <wmiexception.hpp>
 #include <wmiresult.hpp>
+#include <wmiwhere.hpp>
+
+struct IWbemLocator;
+struct IWbemServices;
 
 namespace Wmi
 {
@@ -32,6 +40,65 @@ namespace Wmi
 	   return WmiClass::getWmiPath();
 	}
 
+	//SFINAE test
+	//select all columns if wmi class does not implement getWmiColumns
+	template <class WmiClass>
+	std::string CallGetWmiColumns(...)
+	{
+		return "*";
+	}
+
+	template <class WmiClass>
+	typename std::enable_if<std::is_function<decltype(WmiClass::getWmiColumns)>::value, std::string>::type
+	CallGetWmiColumns(int /* required, otherwise we get an ambiguitiy error... */)
+	{
+	   return WmiClass::getWmiColumns();
+	}
+
+	//A connection to WMI which is reused across queries.
+	//COM is initialized for the lifetime of the session, and one
+	//IWbemServices is kept per namespace path. A session must only be
+	//used on the thread that created it.
+	class Session
+	{
+
+	public:
+		Session();
+
+		~Session();
+
+		Session(const Session&) = delete;
+
+		Session& operator=(const Session&) = delete;
+
+		void query(const std::string& q, const std::string& p, WmiResult &out);
+
+		//Selects the columns of a class, optionally filtered by a WQL condition.
+		//A property that doesn't exist on this version of Windows makes the query
+		//invalid, in that case all columns are selected instead.
+		//The result replaces the content of out.
+		void queryClass(const std::string& className, const std::string& columns, const std::string& where, const std::string& p, WmiResult &out);
+
+		//Drops all cached connections, they are reopened on the next query
+		void disconnect();
+
+		//The session used by the free query functions on the calling thread
+		static Session& getDefault();
+
+		//Destroys the default session of the calling thread, if there is one
+		static void releaseDefault();
+
+	private:
+		IWbemServices* getServices(const std::string& path);
+
+		void disconnect(const std::string& path);
+
+		IWbemLocator *pLocator;
+
+		std::map<std::string, IWbemServices*> services;
+
+	}; //end class Session
+
 	void query(const std::string& q, const std::string& p, WmiResult &out);
 
 	inline WmiResult query(const std::string& q, const std::string& p)
@@ -41,12 +108,34 @@ namespace Wmi
 		return result;
 	}
 
+	//Runs the query on a new thread with its own COM apartment and session.
+	//Independent queries can be started together and joined through their futures,
+	//errors are rethrown by get().
+	std::future<WmiResult> queryAsync(const std::string& q, const std::string& p);
+
+	void queryClass(const std::string& className, const std::string& columns, const std::string& where, const std::string& p, WmiResult &out);
+
+	std::future<WmiResult> queryClassAsync(const std::string& className, const std::string& columns, const std::string& where, const std::string& p);
+
 	template <class WmiClass>
-	inline void retrieveWmi(WmiClass &out)
+	inline void setAllProperties(const WmiResult &result, std::vector<WmiClass> &out)
+	{
+		out.clear();
+		out.reserve(result.size());
+		for(std::size_t index = 0; index < result.size(); ++index)
+		{
+			WmiClass temp;
+			temp.setProperties(result, index);
+			out.push_back(std::move(temp));
+		}
+	}
+
+	//Selects only the columns listed by getWmiColumns, if the class implements it
+	template <class WmiClass>
+	inline void retrieveWmi(WmiClass &out, const Where &where = Where())
 	{
 		WmiResult result;
-		const std::string q = std::string("Select * From ") + WmiClass::getWmiClassName();
-		query(q, CallGetWmiPath<WmiClass>(0), result);
+		queryClass(WmiClass::getWmiClassName(), CallGetWmiColumns<WmiClass>(0), where.str(), CallGetWmiPath<WmiClass>(0), result);
 		out.setProperties(result, 0);
 	}
 
@@ -60,10 +149,10 @@ namespace Wmi
 	}
 
 	template <class WmiClass>
-	inline WmiClass retrieveWmi()
+	inline WmiClass retrieveWmi(const Where &where = Where())
 	{
 		WmiClass temp;
-		retrieveWmi(temp);
+		retrieveWmi(temp, where);
 		return temp;
 	}
 
@@ -75,20 +164,13 @@ namespace Wmi
 		return temp;
 	}
 
+	//Selects only the columns listed by getWmiColumns, if the class implements it
 	template <class WmiClass>
-	inline void retrieveAllWmi(std::vector<WmiClass> &out)
+	inline void retrieveAllWmi(std::vector<WmiClass> &out, const Where &where = Where())
 	{
 		WmiResult result;
-		const std::string q = std::string("Select * From ") + WmiClass::getWmiClassName();
-		query(q, CallGetWmiPath<WmiClass>(0), result);
-
-		out.clear();
-		for(std::size_t index = 0; index < result.size(); ++index)
-		{
-			WmiClass temp;
-			temp.setProperties(result, index);
-			out.push_back(std::move(temp));
-		}
+		queryClass(WmiClass::getWmiClassName(), CallGetWmiColumns<WmiClass>(0), where.str(), CallGetWmiPath<WmiClass>(0), result);
+		setAllProperties(result, out);
 	}
 
 	template <class WmiClass>
@@ -97,21 +179,14 @@ namespace Wmi
 		WmiResult result;
 		const std::string q = std::string("Select ") + columns + std::string(" From ") + WmiClass::getWmiClassName();
 		query(q, CallGetWmiPath<WmiClass>(0), result);
-
-		out.clear();
-		for(std::size_t index = 0; index < result.size(); ++index)
-		{
-			WmiClass temp;
-			temp.setProperties(result, index);
-			out.push_back(std::move(temp));
-		}
+		setAllProperties(result, out);
 	}
 
 	template <class WmiClass>
-	inline std::vector<WmiClass> retrieveAllWmi()
+	inline std::vector<WmiClass> retrieveAllWmi(const Where &where = Where())
 	{
 		std::vector<WmiClass> ret;
-		retrieveAllWmi(ret);
+		retrieveAllWmi(ret, where);
 
 		return ret;
 	}
@@ -125,6 +200,55 @@ namespace Wmi
 		return ret;
 	}
 
+	template <class WmiClass>
+	inline std::future<WmiClass> retrieveWmiAsync(const Where &where = Where())
+	{
+		//The properties are set on the thread which calls get()
+		return std::async(std::launch::deferred, [](std::future<WmiResult> &&result)
+		{
+			WmiClass temp;
+			temp.setProperties(result.get(), 0);
+			return temp;
+		}, queryClassAsync(WmiClass::getWmiClassName(), CallGetWmiColumns<WmiClass>(0), where.str(), CallGetWmiPath<WmiClass>(0)));
+	}
+
+	template <class WmiClass>
+	inline std::future<WmiClass> retrieveWmiAsync(std::string columns)
+	{
+		const std::string q = std::string("Select ") + columns + std::string(" From ") + WmiClass::getWmiClassName();
+
+		return std::async(std::launch::deferred, [](std::future<WmiResult> &&result)
+		{
+			WmiClass temp;
+			temp.setProperties(result.get(), 0);
+			return temp;
+		}, queryAsync(q, CallGetWmiPath<WmiClass>(0)));
+	}
+
+	template <class WmiClass>
+	inline std::future<std::vector<WmiClass>> retrieveAllWmiAsync(const Where &where = Where())
+	{
+		return std::async(std::launch::deferred, [](std::future<WmiResult> &&result)
+		{
+			std::vector<WmiClass> ret;
+			setAllProperties(result.get(), ret);
+			return ret;
+		}, queryClassAsync(WmiClass::getWmiClassName(), CallGetWmiColumns<WmiClass>(0), where.str(), CallGetWmiPath<WmiClass>(0)));
+	}
+
+	template <class WmiClass>
+	inline std::future<std::vector<WmiClass>> retrieveAllWmiAsync(std::string columns)
+	{
+		const std::string q = std::string("Select ") + columns + std::string(" From ") + WmiClass::getWmiClassName();
+
+		return std::async(std::launch::deferred, [](std::future<WmiResult> &&result)
+		{
+			std::vector<WmiClass> ret;
+			setAllProperties(result.get(), ret);
+			return ret;
+		}, queryAsync(q, CallGetWmiPath<WmiClass>(0)));
+	}
+
 }; //end namespace Wmi
 
 #endif //WMI_HPP
\ No newline at end of file
@@ -43,6 +43,11 @@ namespace Wmi
             return "Win32_ComputerSystemProduct";
         }
 
+        static std::string getWmiColumns()
+        {
+            return "Caption,Description,IdentifyingNumber,Name,UUID,Vendor,Version";
+        }
+
         std::string Caption;
         std::string Description;
         std::string IdentifyingNumber;
@@ -80,7 +85,7 @@ namespace Wmi
             result.extract(index, "Caption", (*this).Caption);
             result.extract(index, "ConfiguredClockSpeed", (*this).ConfiguredClockSpeed);
             result.extract(index, "ConfiguredVoltage", (*this).ConfiguredVoltage);
-            result.extract(index, "CreationClass", (*this).CreationClassName);
+            result.extract(index, "CreationClassName", (*this).CreationClassName);
             result.extract(index, "DataWidth", (*this).DataWidth);
             result.extract(index, "Description", (*this).Description);
             result.extract(index, "FormFactor", (*this).FormFactor);
@@ -111,6 +116,13 @@ namespace Wmi
             return "Win32_PhysicalMemory";
         }
 
+        static std::string getWmiColumns()
+        {
+            return "Attributes,BankLabel,Capacity,Caption,ConfiguredClockSpeed,ConfiguredVoltage,CreationClassName,"
+                   "DataWidth,Description,FormFactor,HotSwappable,InterleaveDataDepth,InterleavePosition,Manufacturer,"
+                   "MaxVoltage,MemoryType,MinVoltage,Model,Name,SMBIOSMemoryType";
+        }
+
         uint32_t    Attributes;
         std::string BankLabel;
         uint64_t    Capacity;
@@ -169,6 +181,11 @@ namespace Wmi
             return "Win32_SMBIOSMemory";
         }
 
+        static std::string getWmiColumns()
+        {
+            return "Name,Description,DeviceID,SystemName,PNPDeviceID";
+        }
+
         uint16_t    Access;
         uint16_t    Availability;
         uint64_t    BlockSize;
@@ -335,6 +352,21 @@ namespace Wmi
             return "Win32_ComputerSystem";
         }
 
+        static std::string getWmiColumns()
+        {
+            return "AdminPasswordStatus,AutomaticManagedPagefile,AutomaticResetBootOption,AutomaticResetCapability,"
+                   "BootOptionOnLimit,BootOptionOnWatchDog,BootROMSupported,BootupState,Caption,ChassisBootupState,"
+                   "CreationClassName,CurrentTimeZone,DaylightInEffect,Description,DNSHostName,Domain,DomainRole,"
+                   "EnableDaylightSavingsTime,FrontPanelResetStatus,InfraredSupported,InitialLoadInfo,InstallDate,"
+                   "KeyboardPasswordStatus,LastLoadInfo,Manufacturer,Model,Name,NameFormat,NetworkServerModeEnabled,"
+                   "NumberOfLogicalProcessors,NumberOfProcessors,OEMLogoBitmap,OEMStringArray,PartOfDomain,"
+                   "PauseAfterReset,PCSystemType,PowerManagementCapabilities,PowerManagementSupported,"
+                   "PowerOnPasswordStatus,PowerState,PowerSupplyState,PrimaryOwnerContact,PrimaryOwnerName,"
+                   "ResetCapability,ResetCount,ResetLimit,Roles,Status,SupportContactDescription,SystemStartupDelay,"
+                   "SystemStartupOptions,SystemStartupSetting,SystemType,ThermalState,TotalPhysicalMemory,UserName,"
+                   "WakeUpType,Workgroup";
+        }
+
         int                      AdminPasswordStatus;
         bool                     AutomaticManagedPagefile;
         bool                     AutomaticResetBootOption;
@@ -465,6 +497,15 @@ namespace Wmi
             return "Win32_ParallelPort";
         }
 
+        static std::string getWmiColumns()
+        {
+            return "Availability,Capabilities,CapabilityDescriptions,Caption,ConfigManagerErrorCode,"
+                   "ConfigManagerUserConfig,CreationClassName,Description,DeviceID,DMASupport,ErrorCleared,"
+                   "ErrorDescription,InstallDate,LastErrorCode,MaxNumberControlled,Name,OSAutoDiscovered,PNPDeviceID,"
+                   "PowerManagementCapabilities,PowerManagementSupported,ProtocolSupported,Status,StatusInfo,"
+                   "SystemCreationClassName,SystemName,TimeOfLastReset";
+        }
+
         int         Availability;
         std::string Capabilities;
         std::string CapabilityDescriptions;
@@ -554,6 +595,13 @@ namespace Wmi
             return "Win32_PhysicalMedia";
         }
 
+        static std::string getWmiColumns()
+        {
+            return "Caption,Description,InstallDate,Name,Status,CreationClassName,Manufacturer,Model,SKU,SerialNumber,"
+                   "Tag,Version,PartNumber,OtherIdentifyingInfo,PoweredOn,Replaceable,HotSwappable,Capacity,MediaType,"
+                   "MediaDescription,WriteProtectOn,CleanerMedia";
+        }
+
         std::string Caption;
         std::string Description;
         std::string InstallDate;
@@ -710,6 +758,19 @@ namespace Wmi
             return "Win32_Processor";
         }
 
+        static std::string getWmiColumns()
+        {
+            return "AddressWidth,Architecture,AssetTag,Availability,Caption,Characteristics,ConfigManagerErrorCode,"
+                   "ConfigManagerUserConfig,CpuStatus,CreationClassName,CurrentClockSpeed,CurrentVoltage,DataWidth,"
+                   "Description,DeviceID,ErrorCleared,ErrorDescription,ExtClock,Family,InstallDate,L2CacheSize,"
+                   "L2CacheSpeed,L3CacheSize,L3CacheSpeed,LastErrorCode,Level,LoadPercentage,Manufacturer,MaxClockSpeed,"
+                   "Name,NumberOfCores,NumberOfEnabledCore,NumberOfLogicalProcessors,OtherFamilyDescription,PartNumber,"
+                   "PNPDeviceID,PowerManagementCapabilities,PowerManagementSupported,ProcessorId,ProcessorType,Revision,"
+                   "SecondLevelAddressTranslationExtensions,SerialNumber,SocketDesignation,Status,StatusInfo,Stepping,"
+                   "SystemCreationClassName,SystemName,ThreadCount,UniqueId,UpgradeMethod,Version,"
+                   "VirtualizationFirmwareEnabled,VMMonitorModeExtensions,VoltageCaps";
+        }
+
         int         AddressWidth;
         int         Architecture;
         std::string AssetTag;
@@ -835,6 +896,13 @@ namespace Wmi
             return "Win32_Service";
         }
 
+        static std::string getWmiColumns()
+        {
+            return "AcceptPause,AcceptStop,Caption,CheckPoint,CreationClassName,Description,DesktopInteract,DisplayName,"
+                   "ErrorControl,ExitCode,InstallDate,Name,PathName,ProcessId,ServiceSpecificExitCode,ServiceType,"
+                   "Started,StartMode,StartName,State,Status,SystemCreationClassName,SystemName,TagId,WaitHint";
+        }
+
         bool        AcceptPause;
         bool        AcceptStop;
         std::string Caption;
@@ -972,6 +1040,19 @@ namespace Wmi
             return "Win32_SerialPort";
         }
 
+        static std::string getWmiColumns()
+        {
+            return "Availability,Binary,Capabilities,CapabilityDescriptions,Caption,ConfigManagerErrorCode,"
+                   "ConfigManagerUserConfig,CreationClassName,Description,DeviceID,ErrorCleared,ErrorDescription,"
+                   "InstallDate,LastErrorCode,MaxBaudRate,MaximumInputBufferSize,MaximumOutputBufferSize,"
+                   "MaxNumberControlled,Name,OSAutoDiscovered,PNPDeviceID,PowerManagementCapabilities,"
+                   "PowerManagementSupported,ProtocolSupported,ProviderType,SettableBaudRate,SettableDataBits,"
+                   "SettableFlowControl,SettableParity,SettableParityCheck,SettableRLSD,SettableStopBits,Status,"
+                   "StatusInfo,Supports16BitMode,SupportsDTRDSR,SupportsElapsedTimeouts,SupportsIntTimeouts,"
+                   "SupportsParityCheck,SupportsRLSD,SupportsRTSCTS,SupportsSpecialCharacters,SupportsXOnXOff,"
+                   "SupportsXOnXOffSet,SystemCreationClassName,SystemName,TimeOfLastReset";
+        }
+
         int         Availability;
         bool        Binary;
         std::string Capabilities;
@@ -1111,6 +1192,24 @@ namespace Wmi
         {
             return "SoftwareLicensingService";
         }
+
+        static std::string getWmiColumns()
+        {
+            return "ClientMachineID,DiscoveredKeyManagementServiceMachineIpAddress,"
+                   "DiscoveredKeyManagementServiceMachineName,DiscoveredKeyManagementServiceMachinePort,"
+                   "IsKeyManagementServiceMachine,KeyManagementServiceCurrentCount,KeyManagementServiceDnsPublishing,"
+                   "KeyManagementServiceFailedRequests,KeyManagementServiceHostCaching,"
+                   "KeyManagementServiceLicensedRequests,KeyManagementServiceListeningPort,"
+                   "KeyManagementServiceLookupDomain,KeyManagementServiceLowPriority,KeyManagementServiceMachine,"
+                   "KeyManagementServiceNonGenuineGraceRequests,KeyManagementServiceNotificationRequests,"
+                   "KeyManagementServiceOOBGraceRequests,KeyManagementServiceOOTGraceRequests,KeyManagementServicePort,"
+                   "KeyManagementServiceProductKeyID,KeyManagementServiceTotalRequests,"
+                   "KeyManagementServiceUnlicensedRequests,OA2xBiosMarkerMinorVersion,OA2xBiosMarkerStatus,"
+                   "OA3xOriginalProductKey,OA3xOriginalProductKeyDescription,OA3xOriginalProductKeyPkPn,"
+                   "PolicyCacheRefreshRequired,RemainingWindowsReArmCount,RequiredClientCount,"
+                   "TokenActivationAdditionalInfo,TokenActivationCertificateThumbprint,TokenActivationGrantNumber,"
+                   "TokenActivationILID,TokenActivationILVID,Version,VLActivationInterval,VLRenewalInterval";
+        }
         std::string ClientMachineID;
         std::string DiscoveredKeyManagementServiceMachineIpAddress;
         std::string DiscoveredKeyManagementServiceMachineName;
@@ -1245,6 +1344,16 @@ namespace Wmi
             return "Win32_LogicalDisk";
         }
 
+        static std::string getWmiColumns()
+        {
+            return "Access,Availability,BlockSize,Caption,Compressed,ConfigManagerErrorCode,ConfigManagerUserConfig,"
+                   "CreationClassName,Description,DeviceID,DriveType,ErrorCleared,ErrorDescription,ErrorMethodology,"
+                   "FileSystem,FreeSpace,InstallDate,LastErrorCode,MaximumComponentLength,MediaType,Name,NumberOfBlocks,"
+                   "PNPDeviceID,PowerManagementCapabilities,PowerManagementSupported,ProviderName,Purpose,QuotasDisabled,"
+                   "QuotasIncomplete,QuotasRebuilding,Size,StatusInfo,SupportsDiskQuotas,SupportsFileBasedCompression,"
+                   "SystemCreationClassName,SystemName,VolumeDirty,VolumeName,VolumeSerialNumber";
+        }
+
         int         Access;
         int         Availability;
         std::string BlockSize;
@@ -1412,6 +1521,20 @@ namespace Wmi
         {
             return "Win32_OperatingSystem";
         }
+
+        static std::string getWmiColumns()
+        {
+            return "BootDevice,BuildNumber,BuildType,Caption,CodeSet,CountryCode,CreationClassName,CSCreationClassName,"
+                   "CSName,CurrentTimeZone,DataExecutionPrevention_32BitApplications,DataExecutionPrevention_Available,"
+                   "DataExecutionPrevention_Drivers,DataExecutionPrevention_SupportPolicy,Debug,Description,Distributed,"
+                   "EncryptionLevel,ForegroundApplicationBoost,FreePhysicalMemory,FreeSpaceInPagingFiles,"
+                   "FreeVirtualMemory,InstallDate,LastBootUpTime,LocalDateTime,Locale,Manufacturer,MaxNumberOfProcesses,"
+                   "MaxProcessMemorySize,MUILanguages,Name,NumberOfProcesses,NumberOfUsers,OperatingSystemSKU,"
+                   "Organization,OSArchitecture,OSLanguage,OSProductSuite,OSType,PortableOperatingSystem,Primary,"
+                   "ProductType,RegisteredUser,SerialNumber,ServicePackMajorVersion,ServicePackMinorVersion,"
+                   "SizeStoredInPagingFiles,Status,SuiteMask,SystemDevice,SystemDirectory,SystemDrive,"
+                   "TotalVirtualMemorySize,TotalVisibleMemorySize,Version,WindowsDirectory";
+        }
         std::string BootDevice;
         std::string BuildNumber;
         std::string BuildType;
@@ -1605,6 +1728,21 @@ namespace Wmi
             return "Win32_VideoController";
         }
 
+        static std::string getWmiColumns()
+        {
+            return "AcceleratorCapabilities,AdapterCompatibility,AdapterDACType,AdapterRAM,Availability,"
+                   "CapabilityDescriptions,Caption,ColorTableEntries,ConfigManagerErrorCode,ConfigManagerUserConfig,"
+                   "CreationClassName,CurrentBitsPerPixel,CurrentHorizontalResolution,CurrentNumberOfColors,"
+                   "CurrentNumberOfColumns,CurrentNumberOfRows,CurrentRefreshRate,CurrentScanMode,"
+                   "CurrentVerticalResolution,Description,DeviceID,DeviceSpecificPens,DitherType,DriverDate,"
+                   "DriverVersion,ErrorCleared,ErrorDescription,ICMIntent,ICMMethod,InfFilename,InfSection,InstallDate,"
+                   "InstalledDisplayDrivers,LastErrorCode,MaxMemorySupported,MaxNumberControlled,MaxRefreshRate,"
+                   "MinRefreshRate,Monochrome,Name,NumberOfColorPlanes,NumberOfVideoPages,PNPDeviceID,"
+                   "PowerManagementCapabilities,PowerManagementSupported,ProtocolSupported,ReservedSystemPaletteEntries,"
+                   "SpecificationVersion,Status,StatusInfo,SystemCreationClassName,SystemName,SystemPaletteEntries,"
+                   "TimeOfLastReset,VideoArchitecture,VideoMemoryType,VideoMode,VideoModeDescription,VideoProcessor";
+        }
+
         std::string   AcceleratorCapabilities;
         std::string   AdapterCompatibility;
         std::string   AdapterDACType;
@@ -1740,6 +1878,14 @@ namespace Wmi
             return "Win32_BaseBoard";
         }
 
+        static std::string getWmiColumns()
+        {
+            return "Caption,ConfigOptions,CreationClassName,Depth,Description,Height,HostingBoard,HotSwappable,"
+                   "InstallDate,Manufacturer,Model,Name,OtherIdentifyingInfo,PoweredOn,Product,Removable,Replaceable,"
+                   "RequirementsDescription,RequiresDaughterBoard,SerialNumber,SKU,SlotLayout,SpecialRequirements,Status,"
+                   "Tag,Version,Weight,Width";
+        }
+
         std::string Caption;
         std::string ConfigOptions;
         std::string CreationClassName;
@@ -1797,6 +1943,12 @@ namespace Wmi
         {
             return "UWF_Filter";
         }
+
+        static std::string getWmiColumns()
+        {
+            return "Id,CurrentEnabled,NextEnabled,HORMEnabled,ShutdownPending";
+        }
+
         static std::string getWmiPath()
         {
             return "standardcimv2\\embedded";
@@ -1837,6 +1989,12 @@ namespace Wmi
         {
             return "AntiVirusProduct";
         }
+
+        static std::string getWmiColumns()
+        {
+            return "DisplayName,InstanceGuid,PathToSignedProductExe,PathToSignedReportingExe,ProductState,Timestamp";
+        }
+
         static std::string getWmiPath()
         {
             return "securitycenter2";
@@ -8,48 +8,103 @@
 #ifndef WMIRESULT_HPP
 #define WMIRESULT_HPP
 
-#include <map>
+#include <cstdint>
 #include <string>
 #include <vector>
 
 namespace Wmi
 {
 
+	//Stores the rows of a query result by column.
+	//Each column has a case insensitive name and one typed cell per row.
+	//Strings are stored as UTF-8 in a single buffer, and array elements
+	//in shared per-type buffers, so building a result does not allocate
+	//per property.
 	class WmiResult
 	{
-	
+
 	public:
+		enum class Type : std::uint8_t
+		{
+			Missing,		//The row has no such property
+			Null,
+			Bool,
+			Int,
+			UInt,
+			Real,
+			String,
+			BoolArray,
+			IntArray,
+			UIntArray,
+			RealArray,
+			StringArray
+		};
+
+		static const std::size_t npos = static_cast<std::size_t>(-1);
+
 		WmiResult() :
-			result()
+			columns(),
+			rowCount(0),
+			columnHint(0),
+			arrayIndex(0),
+			arrayColumn(0),
+			text(),
+			textRanges(),
+			ints(),
+			uints(),
+			reals()
 		{}
 
-		void set(std::size_t index, std::wstring name, const std::wstring &value);
+		//Removes all rows and columns
+		void clear();
 
-		std::vector<std::map<std::wstring,std::wstring> >::iterator begin()
-		{
-			return result.begin();
-		}
+		//Adds an empty row and returns its index
+		std::size_t addRow();
 
-		std::vector<std::map<std::wstring,std::wstring> >::iterator end()
-		{
-			return result.end();
-		}
+		//Returns the index of the column with the given name, adding it if it doesn't exist
+		std::size_t addColumn(const wchar_t *name);
+
+		void setNull(std::size_t index, std::size_t column);
+		void setBool(std::size_t index, std::size_t column, bool value);
+		void setInt(std::size_t index, std::size_t column, std::int64_t value);
+		void setUInt(std::size_t index, std::size_t column, std::uint64_t value);
+		void setReal(std::size_t index, std::size_t column, double value);
+		void setString(std::size_t index, std::size_t column, const wchar_t *value, std::size_t length);
+
+		//Array values are built by starting the array and then appending its elements,
+		//the appended values must match the element type of the array
+		void beginArray(std::size_t index, std::size_t column, Type type);
+		void appendBool(bool value);
+		void appendInt(std::int64_t value);
+		void appendUInt(std::uint64_t value);
+		void appendReal(double value);
+		void appendString(const wchar_t *value, std::size_t length);
+
+		//Stores a value as text, which is converted when it is extracted
+		void set(std::size_t index, const std::wstring &name, const std::wstring &value);
 
-		std::vector<std::map<std::wstring,std::wstring> >::const_iterator cbegin() const
+		std::size_t size() const
 		{
-			return result.cbegin();
+			return rowCount;
 		}
 
-		std::vector<std::map<std::wstring,std::wstring> >::const_iterator cend() const
+		std::size_t columnCount() const
 		{
-			return result.cend();
+			return columns.size();
 		}
 
-		std::size_t size() const
+		//The lower case name of a column
+		const std::string& columnName(std::size_t column) const
 		{
-			return result.size();
+			return columns[column].name;
 		}
 
+		//Returns the index of the column with the given name (case insensitive), or npos
+		std::size_t findColumn(const std::string &name) const;
+
+		//Returns the type of a cell, or Type::Missing if the row or column doesn't exist
+		Type type(std::size_t index, const std::string &name) const;
+
 		bool extract(std::size_t index, const std::string &name, std::wstring &out) const;
 		bool extract(std::size_t index, const std::string &name, std::string &out) const;
 		bool extract(std::size_t index, const std::string &name, int &out) const;
@@ -69,10 +124,85 @@ namespace Wmi
 		bool extract(std::size_t index, const std::string &name, std::vector<uint8_t> &out) const;
 
 	private:
-		std::vector<std::map<std::wstring,std::wstring> > result;
+		struct TextRange
+		{
+			std::uint32_t offset;
+			std::uint32_t length;
+		};
+
+		struct Cell
+		{
+			Type type;
+			union
+			{
+				bool boolValue;
+				std::int64_t intValue;
+				std::uint64_t uintValue;
+				double realValue;
+				TextRange textValue;
+				TextRange arrayValue;	//first element and element count in the buffer of the array type
+			};
+		};
+
+		struct Column
+		{
+			std::string name;
+			std::vector<Cell> cells;
+		};
+
+		Cell& cell(std::size_t index, std::size_t column);
+
+		const Cell* find(std::size_t index, const std::string &name) const;
+
+		TextRange addText(const wchar_t *value, std::size_t length);
+
+		//Returns element i of an array cell as a scalar cell
+		Cell element(const Cell &array, std::size_t i) const;
+
+		bool convert(const Cell &value, std::wstring &out) const;
+		bool convert(const Cell &value, std::string &out) const;
+		bool convert(const Cell &value, bool &out) const;
+
+		template <class T>
+		bool convert(const Cell &value, T &out) const;
+
+		//Formats an array cell as text, e.g. [1,2] or ["a","b"]
+		bool convertArray(const Cell &value, std::wstring &out) const;
+		bool convertArray(const Cell &value, std::string &out) const;
+
+		template <class T>
+		bool convertArray(const Cell &value, T &out) const;
+
+		template <class T>
+		bool extractScalar(std::size_t index, const std::string &name, T &out) const;
+
+		template <class T>
+		bool extractArray(std::size_t index, const std::string &name, std::vector<T> &out) const;
+
+		std::vector<Column> columns;
+
+		std::size_t rowCount;
+
+		//The column after the one most recently added, rows usually repeat the same column order
+		std::size_t columnHint;
+
+		//The cell of the array currently being built
+		std::size_t arrayIndex;
+
+		std::size_t arrayColumn;
+
+		std::string text;
+
+		std::vector<TextRange> textRanges;
+
+		std::vector<std::int64_t> ints;
+
+		std::vector<std::uint64_t> uints;
+
+		std::vector<double> reals;
 
 	}; //end class WmiResult
 
 }; //end namespace Wmi
 
-#endif //WMIRESULT_HPP
\ No newline at end of file
+#endif //WMIRESULT_HPP
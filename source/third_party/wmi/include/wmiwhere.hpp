@@ -0,0 +1,140 @@
+/**
+  *
+  * WMI
+  *
+ **/
+
+#ifndef WMIWHERE_HPP
+#define WMIWHERE_HPP
+
+#include <string>
+#include <type_traits>
+
+namespace Wmi
+{
+
+	//A WQL WHERE condition.
+	//Conditions are built from Property comparisons and combined with &&, || and !.
+	//An empty condition matches all objects.
+	class Where
+	{
+
+	public:
+		Where() :
+			condition()
+		{}
+
+		//Uses the text as WQL condition without any escaping
+		explicit Where(const std::string &str_condition) :
+			condition(str_condition)
+		{}
+
+		bool empty() const
+		{
+			return condition.empty();
+		}
+
+		const std::string& str() const
+		{
+			return condition;
+		}
+
+	private:
+		std::string condition;
+
+	}; //end class Where
+
+	inline Where operator&&(const Where &a, const Where &b)
+	{
+		if(a.empty())return b;
+		if(b.empty())return a;
+		return Where("(" + a.str() + ") AND (" + b.str() + ")");
+	}
+
+	inline Where operator||(const Where &a, const Where &b)
+	{
+		if(a.empty() || b.empty())return Where();
+		return Where("(" + a.str() + ") OR (" + b.str() + ")");
+	}
+
+	inline Where operator!(const Where &a)
+	{
+		return Where("NOT (" + a.str() + ")");
+	}
+
+	//A property of a WMI class which is compared with a typed value.
+	//Strings are quoted and escaped, bools are written as TRUE or FALSE.
+	class Property
+	{
+
+	public:
+		explicit Property(const std::string &str_name) :
+			name(str_name)
+		{}
+
+		template <class T> Where operator==(const T &value) const { return compare("=", value); }
+		template <class T> Where operator!=(const T &value) const { return compare("<>", value); }
+		template <class T> Where operator<(const T &value) const { return compare("<", value); }
+		template <class T> Where operator<=(const T &value) const { return compare("<=", value); }
+		template <class T> Where operator>(const T &value) const { return compare(">", value); }
+		template <class T> Where operator>=(const T &value) const { return compare(">=", value); }
+
+		//Matches a pattern with the WQL wildcards % and _
+		Where like(const std::string &pattern) const
+		{
+			return Where(name + " LIKE " + format(pattern));
+		}
+
+		Where isNull() const
+		{
+			return Where(name + " IS NULL");
+		}
+
+		Where isNotNull() const
+		{
+			return Where(name + " IS NOT NULL");
+		}
+
+	private:
+		template <class T>
+		Where compare(const char *op, const T &value) const
+		{
+			return Where(name + " " + op + " " + format(value));
+		}
+
+		static std::string format(const std::string &value)
+		{
+			std::string ret = "'";
+			for(char c : value)
+			{
+				if(c == '\\' || c == '\'')ret.push_back('\\');
+				ret.push_back(c);
+			}
+			ret.push_back('\'');
+
+			return ret;
+		}
+
+		static std::string format(const char *value)
+		{
+			return format(std::string(value));
+		}
+
+		static std::string format(bool value)
+		{
+			return value ? "TRUE" : "FALSE";
+		}
+
+		template <class T>
+		static typename std::enable_if<std::is_arithmetic<T>::value, std::string>::type format(T value)
+		{
+			return std::to_string(value);
+		}
+
+		std::string name;
+
+	}; //end class Property
+
+}; //end namespace Wmi
+
+#endif //WMIWHERE_HPP
@@ -39,7 +39,7 @@ int main(int /*argc*/, char */*args*/[])
 		cout<<"Machine Id:"<<liscense.ClientMachineID<<" Kmsid:"<<liscense.KeyManagementServiceProductKeyID<<std::endl;
 		cout<<"Installed services:"<<endl;
 
-		// gets all rows and all columns
+		// gets all rows and the columns Win32_Service reads (see getWmiColumns)
 		for(const Win32_Service &service : retrieveAllWmi<Win32_Service>())
 		{
 			cout<<service.Caption<<" started:"<<service.Started<<" state:"<<service.State<<  endl;
@@ -51,6 +51,17 @@ int main(int /*argc*/, char */*args*/[])
 			cout<<service.Caption<<" started:"<<service.Started<<" state:"<<service.State<<  endl;
 		}
 
+		// gets only the rows matching a typed condition
+		for(const Win32_Service &service : retrieveAllWmi<Win32_Service>(Property("State") == "Running" && Property("StartMode") == "Auto"))
+		{
+			cout<<service.Caption<<" process:"<<service.ProcessId<<endl;
+		}
+
+		//Independent classes can be queried in parallel, each on its own thread
+		std::future<Win32_ComputerSystem> asyncComputer = retrieveWmiAsync<Win32_ComputerSystem>();
+		std::future<std::vector<Win32_Service>> asyncServices = retrieveAllWmiAsync<Win32_Service>("Caption,Started,State");
+		cout<<"Computername: "<<asyncComputer.get().Name<<" Services: "<<asyncServices.get().size()<<endl;
+
 		//Example for using a class that has a non default root (securitycenter2)
 		//This can be accombplished by implementing getWmiPath in the wmi class
 		cout << "Antivirus installed:" << endl;
@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <comdef.h>
 #include <functional>
+#include <thread>
 #include <wbemcli.h>
 #include <windows.h>
 
@@ -16,25 +17,9 @@
 using std::function;
 using std::string;
 using std::wstring;
-using std::wstringstream;
 
 using namespace Wmi;
 
-wstring escape(wstring str)
-{
-	size_t start_pos = 0;
-	const wstring from = L"\"";
-	const wstring to = L"\\\"";
-
-    while((start_pos = str.find(from, start_pos)) != string::npos)
-	{
-        str.replace(start_pos, from.length(), to);
-        start_pos += to.length();
-    }
-
-    return str;
-}
-
 IWbemLocator* createWbemLocator()
 {
 	IWbemLocator *pLocator = nullptr;
@@ -152,113 +137,144 @@ void foreachObject(IEnumWbemClassObject *pClassObject, function<bool(IWbemClassO
 	}
 }
 
-wstring convertVariant(const VARIANT &value)
+//Appends the elements of a one dimensional SafeArray of T to the array being built
+template <class T, class Fn>
+void appendArray(SAFEARRAY *array, Fn fn)
 {
-	bool handled = true;
-	std::wstringstream ss;
+	long lLower, lUpper;
+	SafeArrayGetLBound(array, 1, &lLower);
+	SafeArrayGetUBound(array, 1, &lUpper);
 
+	T *data = nullptr;
+	HRESULT hr = SafeArrayAccessData(array, (void**)&data);
+	if(FAILED(hr))
+	{
+		throw WmiException("Could not access SafeArray data", hr);
+	}
+
+	for(long i = 0; i <= lUpper - lLower; ++i)
+	{
+		fn(data[i]);
+	}
+
+	SafeArrayUnaccessData(array);
+}
+
+void setVariant(WmiResult &out, std::size_t index, std::size_t column, const VARIANT &value)
+{
 	switch(value.vt)
 	{
 		case VT_EMPTY:
+		case VT_VOID:
+		case VT_BYREF:	//for local use only
+			out.setString(index, column, L"", 0);
 			break;
 		case VT_NULL:
-			ss<<"NULL";
+			out.setNull(index, column);
+			break;
+		case VT_I1:
+			out.setInt(index, column, value.cVal);
 			break;
 		case VT_I2:
-			ss<<value.iVal;
+			out.setInt(index, column, value.iVal);
 			break;
 		case VT_I4:
-			ss<<value.lVal;
-			break;
-		case VT_R4:
-			ss<<value.fltVal;
-			break;
-		case VT_R8:
-			ss<<value.dblVal;
+			out.setInt(index, column, value.lVal);
 			break;
-		case VT_BSTR:
-			ss<<value.bstrVal;
-			break;
-		case VT_BOOL:
-			ss<<(value.boolVal ? "true" : "false");
-			break;
-		case VT_DECIMAL:
-			ss<<value.pdecVal;
+		case VT_I8:
+			out.setInt(index, column, value.llVal);
 			break;
-		case VT_I1:
-			ss<<value.cVal;
+		case VT_INT:
+			out.setInt(index, column, value.intVal);
 			break;
 		case VT_UI1:
-			ss<<value.bVal;
+			out.setUInt(index, column, value.bVal);
 			break;
 		case VT_UI2:
-			ss<<value.uiVal;
+			out.setUInt(index, column, value.uiVal);
 			break;
 		case VT_UI4:
-			ss<<value.ulVal;
-			break;
-		case VT_I8:
-			ss<<value.llVal;
+			out.setUInt(index, column, value.ulVal);
 			break;
 		case VT_UI8:
-			ss<<value.ullVal;
-			break;
-		case VT_INT:
-			ss<<value.intVal;
+			out.setUInt(index, column, value.ullVal);
 			break;
 		case VT_UINT:
-			ss<<value.uintVal;
+			out.setUInt(index, column, value.uintVal);
 			break;
-		case VT_VOID:
+		case VT_R4:
+			out.setReal(index, column, value.fltVal);
 			break;
-		case VT_ARRAY|VT_BSTR:
+		case VT_R8:
+			out.setReal(index, column, value.dblVal);
+			break;
+		case VT_DECIMAL:
 		{
-			long lLower, lUpper;
-			SafeArrayGetLBound(value.parray, 1, &lLower);
-			SafeArrayGetUBound(value.parray, 1, &lUpper);
-
-			ss<<"[";
-			for(long i = lLower; i <= lUpper; ++i)
+			double temp;
+			HRESULT hr = VarR8FromDec(&value.decVal, &temp);
+			if(FAILED(hr))
 			{
-				BSTR inner;
-				HRESULT hr = SafeArrayGetElement(value.parray, &i, &inner);
-
-				if(!FAILED(hr))
-				{
-					ss<<"\""<<escape(inner)<<"\"";
-				}
-
-				if(i != lUpper)ss<<",";
+				throw WmiException("Could not convert VT_DECIMAL", hr);
 			}
-			ss<<"]";
-
+			out.setReal(index, column, temp);
 			break;
 		}
+		case VT_BOOL:
+			out.setBool(index, column, value.boolVal != VARIANT_FALSE);
+			break;
+		case VT_BSTR:
+			//CIM 64 bit integers are also passed as strings, they are parsed when extracted
+			out.setString(index, column, value.bstrVal, SysStringLen(value.bstrVal));
+			break;
+		case VT_ARRAY|VT_BSTR:
+			out.beginArray(index, column, WmiResult::Type::StringArray);
+			appendArray<BSTR>(value.parray, [&out](BSTR inner){ out.appendString(inner, SysStringLen(inner)); });
+			break;
+		case VT_ARRAY|VT_BOOL:
+			out.beginArray(index, column, WmiResult::Type::BoolArray);
+			appendArray<VARIANT_BOOL>(value.parray, [&out](VARIANT_BOOL inner){ out.appendBool(inner != VARIANT_FALSE); });
+			break;
+		case VT_ARRAY|VT_I1:
+			out.beginArray(index, column, WmiResult::Type::IntArray);
+			appendArray<CHAR>(value.parray, [&out](CHAR inner){ out.appendInt(inner); });
+			break;
+		case VT_ARRAY|VT_I2:
+			out.beginArray(index, column, WmiResult::Type::IntArray);
+			appendArray<SHORT>(value.parray, [&out](SHORT inner){ out.appendInt(inner); });
+			break;
 		case VT_ARRAY|VT_I4:
-		{
-			long lLower, lUpper;
-			SafeArrayGetLBound(value.parray, 1, &lLower);
-			SafeArrayGetUBound(value.parray, 1, &lUpper);
-
-			ss<<"[";
-			for(long i = lLower; i <= lUpper; ++i)
-			{
-				ULONG inner;
-				HRESULT hr = SafeArrayGetElement(value.parray, &i, &inner);
-
-				if(!FAILED(hr))
-				{
-					ss<<inner;
-				}
-
-				if(i != lUpper)ss<<",";
-			}
-			ss<<"]";
-
+			out.beginArray(index, column, WmiResult::Type::IntArray);
+			appendArray<LONG>(value.parray, [&out](LONG inner){ out.appendInt(inner); });
 			break;
-		}
-		
-		
+		case VT_ARRAY|VT_I8:
+			out.beginArray(index, column, WmiResult::Type::IntArray);
+			appendArray<LONGLONG>(value.parray, [&out](LONGLONG inner){ out.appendInt(inner); });
+			break;
+		case VT_ARRAY|VT_UI1:
+			out.beginArray(index, column, WmiResult::Type::UIntArray);
+			appendArray<BYTE>(value.parray, [&out](BYTE inner){ out.appendUInt(inner); });
+			break;
+		case VT_ARRAY|VT_UI2:
+			out.beginArray(index, column, WmiResult::Type::UIntArray);
+			appendArray<USHORT>(value.parray, [&out](USHORT inner){ out.appendUInt(inner); });
+			break;
+		case VT_ARRAY|VT_UI4:
+			out.beginArray(index, column, WmiResult::Type::UIntArray);
+			appendArray<ULONG>(value.parray, [&out](ULONG inner){ out.appendUInt(inner); });
+			break;
+		case VT_ARRAY|VT_UI8:
+			out.beginArray(index, column, WmiResult::Type::UIntArray);
+			appendArray<ULONGLONG>(value.parray, [&out](ULONGLONG inner){ out.appendUInt(inner); });
+			break;
+		case VT_ARRAY|VT_R4:
+			out.beginArray(index, column, WmiResult::Type::RealArray);
+			appendArray<float>(value.parray, [&out](float inner){ out.appendReal(inner); });
+			break;
+		case VT_ARRAY|VT_R8:
+			out.beginArray(index, column, WmiResult::Type::RealArray);
+			appendArray<double>(value.parray, [&out](double inner){ out.appendReal(inner); });
+			break;
+
 		case VT_CY:				throw WmiException("Data type not yet supported: VT_CY", value.vt);
 		case VT_DATE:			throw WmiException("Data type not yet supported: VT_DATE", value.vt);
 		case VT_DISPATCH:		throw WmiException("Data type not yet supported: VT_DISPATCH", value.vt);
@@ -275,91 +291,67 @@ wstring convertVariant(const VARIANT &value)
 		case VT_UINT_PTR:		throw WmiException("Data type not yet supported: VT_UINT_PTR", value.vt);
 		case VT_LPSTR:			throw WmiException("Data type not yet supported: VT_LPSTR", value.vt);
 		case VT_LPWSTR:			throw WmiException("Data type not yet supported: VT_LPWSTR", value.vt);
-		case VT_BYREF:
-			//for local use only
-			break;
-		default:
-			handled = false;
-			break;
+		default:				throw WmiException("Unknown data type", value.vt);
 	}
-	
-	if(!handled)
-	{
-		throw WmiException("Unknown data type", value.vt);
-	}
-
-	return ss.str();
 }
 
-void foreachProperty(IWbemClassObject *object, function<bool(const wstring&, const std::wstring&)> fn)
+//Adds a row with all non system properties of the object
+void addObject(IWbemClassObject *object, WmiResult &out)
 {
-	SAFEARRAY *psaNames = nullptr;
-    HRESULT hr = object->GetNames(nullptr, WBEM_FLAG_ALWAYS | WBEM_FLAG_NONSYSTEM_ONLY, nullptr, &psaNames);
+	HRESULT hr = object->BeginEnumeration(WBEM_FLAG_NONSYSTEM_ONLY);
 
-    if(FAILED(hr))
-    {
+	if(FAILED(hr))
+	{
 		switch(hr)
 		{
-			case (HRESULT)WBEM_E_FAILED:			throw WmiException("Could not get properties: WBEM_E_FAILED", hr);
 			case (HRESULT)WBEM_E_INVALID_PARAMETER:	throw WmiException("Could not get properties: WBEM_E_INVALID_PARAMETER", hr);
-			case (HRESULT)WBEM_E_OUT_OF_MEMORY:		throw WmiException("Could not get properties: WBEM_E_OUT_OF_MEMORY", hr);
 			default:								throw WmiException("Could not get properties: WBEM_E_FAILED", hr);
 		}
-    }
+	}
 
-	long lLower, lUpper; 
-	BSTR propName = nullptr;
-	SafeArrayGetLBound(psaNames, 1, &lLower);
-	SafeArrayGetUBound(psaNames, 1, &lUpper);
+	const std::size_t index = out.addRow();
 
-	for(long i = lLower; i <= lUpper; ++i) 
+	while(true)
 	{
-		hr = SafeArrayGetElement(psaNames, &i, &propName);
-
-		if(FAILED(hr))
-		{
-			switch(hr)
-			{
-				case DISP_E_BADINDEX:	throw WmiException("Could not get name from SafeArray: DISP_E_BADINDEX", hr);
-				case E_INVALIDARG:		throw WmiException("Could not get name from SafeArray: E_INVALIDARG", hr);
-				case E_OUTOFMEMORY:		throw WmiException("Could not get name from SafeArray: E_OUTOFMEMORY", hr);
-				default:				throw WmiException("Could not get name from SafeArray: Unknown Error", hr);
-			}
-		}
-
+		BSTR propName = nullptr;
 		VARIANT value;
 		VariantInit(&value);
-		hr = object->Get(propName, 0, &value, nullptr, nullptr);
-		
+		hr = object->Next(0, &propName, &value, nullptr, nullptr);
+
+		if(hr == WBEM_S_NO_MORE_DATA)break;
+
 		if(FAILED(hr))
 		{
+			object->EndEnumeration();
 			switch(hr)
 			{
 				case (HRESULT)WBEM_E_FAILED:			throw WmiException("Could not get property: WBEM_E_FAILED", hr);
 				case (HRESULT)WBEM_E_INVALID_PARAMETER:	throw WmiException("Could not get property: WBEM_E_INVALID_PARAMETER", hr);
-				case (HRESULT)WBEM_E_NOT_FOUND:			throw WmiException("Could not get property: WBEM_E_NOT_FOUND", hr);
 				case (HRESULT)WBEM_E_OUT_OF_MEMORY:		throw WmiException("Could not get property: WBEM_E_OUT_OF_MEMORY", hr);
 				default:								throw WmiException("Could not get property: Unknown Error", hr);
 			}
 		}
-		
-		bool cont;
+
 		try {
-			cont = fn(propName, convertVariant(value));
+			setVariant(out, index, out.addColumn(propName), value);
 		} catch (const WmiException &e) {
 			wstring temp(propName);
+			VariantClear(&value);
+			SysFreeString(propName);
+			object->EndEnumeration();
 			throw WmiException(string("Can't convert parameter: ") + string(temp.begin(), temp.end()) + ": " + e.errorMessage, e.errorCode);
 		}
 
 		VariantClear(&value);
 		SysFreeString(propName);
-		if(!cont)break;
 	}
 
-    SafeArrayDestroy(psaNames);
+	object->EndEnumeration();
 }
 
-void Wmi::query(const string& q, const string& p, WmiResult &out)
+Session::Session() :
+	pLocator(nullptr),
+	services()
 {
 	HRESULT hr = CoInitialize(nullptr);
 	if (FAILED(hr))
@@ -367,10 +359,6 @@ void Wmi::query(const string& q, const string& p, WmiResult &out)
 		throw WmiException("The COM library is already initialized on this thread", hr);
 	}
 
-	IWbemLocator *pLocator;
-	IWbemServices *pServices;
-	IEnumWbemClassObject *pClassObject;
-
 	//Create the WBEM locator
 	try {
 		pLocator = createWbemLocator();
@@ -378,49 +366,168 @@ void Wmi::query(const string& q, const string& p, WmiResult &out)
 		CoUninitialize();
 		throw;
 	}
+}
 
-	//Open connection to computer
-	try {
-		pServices = connect(pLocator, p);
-	} catch (const WmiException &) {
-		pLocator->Release(); 
-		CoUninitialize();
-		throw;
+Session::~Session()
+{
+	disconnect();
+	pLocator->Release();
+	CoUninitialize();
+}
+
+void Session::disconnect()
+{
+	for(auto &entry : services)
+	{
+		entry.second->Release();
+	}
+	services.clear();
+}
+
+void Session::disconnect(const string &path)
+{
+	auto found = services.find(path);
+	if(found != services.end())
+	{
+		found->second->Release();
+		services.erase(found);
+	}
+}
+
+IWbemServices* Session::getServices(const string &path)
+{
+	auto found = services.find(path);
+	if(found != services.end())
+	{
+		return found->second;
 	}
 
+	//Open connection to computer
+	IWbemServices *pServices = connect(pLocator, path);
+	services[path] = pServices;
+
+	return pServices;
+}
+
+void Session::query(const string& q, const string& p, WmiResult &out)
+{
+	IWbemServices *pServices = getServices(p);
+	IEnumWbemClassObject *pClassObject;
+
 	//Execute the query
 	try {
 		pClassObject = execute(pServices, q);
-	} catch (const WmiException &) {
-		pServices->Release();
-		pLocator->Release(); 
-		CoUninitialize();
+	} catch (const WmiException &e) {
+		//Reconnect on the next query if the connection was lost
+		if(e.errorCode == (HRESULT)WBEM_E_TRANSPORT_FAILURE || e.errorCode == RPC_E_DISCONNECTED)
+		{
+			disconnect(p);
+		}
 		throw;
 	}
 
 	try {
-		std::size_t index = 0;
-		
-		foreachObject(pClassObject, [&out,&index](IWbemClassObject *object)
+		foreachObject(pClassObject, [&out](IWbemClassObject *object)
 		{
-			foreachProperty(object, [&out,index](const wstring &name, const std::wstring &value)
-			{
-				out.set(index,name, value);
-				return true;
-			});
-			index++;
+			addObject(object, out);
 			return true;
 		});
 	} catch (const WmiException &) {
-		pServices->Release();
-		pLocator->Release(); 
-		CoUninitialize();
+		pClassObject->Release();
 		throw;
 	}
 	
 	pClassObject->Release();
+}
 
-	pServices->Release();
-	pLocator->Release(); 
-	CoUninitialize();
+namespace
+{
+	thread_local std::unique_ptr<Session> defaultSession;
+}
+
+Session& Session::getDefault()
+{
+	if(!defaultSession)
+	{
+		defaultSession.reset(new Session());
+	}
+
+	return *defaultSession;
+}
+
+void Session::releaseDefault()
+{
+	defaultSession.reset();
+}
+
+void Wmi::query(const string& q, const string& p, WmiResult &out)
+{
+	Session::getDefault().query(q, p, out);
+}
+
+void Session::queryClass(const string& className, const string& columns, const string& where, const string& p, WmiResult &out)
+{
+	string q = string("Select ") + columns + string(" From ") + className;
+	if(!where.empty())q += string(" Where ") + where;
+
+	out.clear();
+
+	try {
+		query(q, p, out);
+	} catch (const WmiException &e) {
+		if(columns == "*" || e.errorCode != (HRESULT)WBEM_E_INVALID_QUERY)throw;
+
+		//Retry with all columns, an invalid condition fails again
+		queryClass(className, "*", where, p, out);
+	}
+}
+
+void Wmi::queryClass(const string& className, const string& columns, const string& where, const string& p, WmiResult &out)
+{
+	Session::getDefault().queryClass(className, columns, where, p, out);
+}
+
+namespace
+{
+	std::future<WmiResult> runAsync(function<void(Session&, WmiResult&)> fn)
+	{
+		std::promise<WmiResult> promise;
+		std::future<WmiResult> future = promise.get_future();
+
+		std::thread([fn](std::promise<WmiResult> &&result)
+		{
+			try {
+				WmiResult out;
+
+				//The session is destroyed before the result is published, so the
+				//thread holds no COM state once the future is ready
+				{
+					Session session;
+					fn(session, out);
+				}
+
+				result.set_value(std::move(out));
+			} catch (...) {
+				result.set_exception(std::current_exception());
+			}
+		}, std::move(promise)).detach();
+
+		return future;
+	}
+}
+
+std::future<WmiResult> Wmi::queryAsync(const string& q, const string& p)
+{
+	return runAsync([q, p](Session &session, WmiResult &out)
+	{
+		session.query(q, p, out);
+	});
+}
+
+std::future<WmiResult> Wmi::queryClassAsync(const string& className, const string& columns, const string& where, const string& p)
+{
+	return runAsync([className, columns, where, p](Session &session, WmiResult &out)
+	{
+		session.queryClass(className, columns, where, p, out);
+	});
 }
@@ -5,285 +5,638 @@
   *
  **/
 
-#include <algorithm>
-#include <codecvt>
-#include <locale>
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+#include <type_traits>
 
 #include <wmiresult.hpp>
 
-using std::codecvt_utf8;
+using std::int64_t;
+using std::size_t;
 using std::string;
-using std::transform;
+using std::uint32_t;
+using std::uint64_t;
 using std::vector;
 using std::wstring;
-using std::wstring_convert;
 
 using namespace Wmi;
 
-wstring unescape(wstring str)
+namespace
 {
-	size_t start_pos = 0;
-	const wstring from = L"\\\"";
-	const wstring to = L"\"";
+	char toLower(char c)
+	{
+		return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+	}
 
-    while((start_pos = str.find(from, start_pos)) != string::npos)
+	wchar_t toLower(wchar_t c)
 	{
-        str.replace(start_pos, from.length(), to);
-        start_pos += to.length();
-    }
+		return (c >= L'A' && c <= L'Z') ? static_cast<wchar_t>(c - L'A' + L'a') : c;
+	}
 
-    return str;
-}
+	//Compares a lower case column name with a property name
+	bool equalsName(const string &column, const wchar_t *name)
+	{
+		size_t i = 0;
+		for(; i < column.length(); ++i)
+		{
+			if(name[i] == L'\0' || column[i] != static_cast<char>(toLower(name[i])))return false;
+		}
 
-bool tokenize(const wstring &str, vector<wstring> &out)
-{
-	size_t start_pos = str.find(L"[");
+		return name[i] == L'\0';
+	}
+
+	bool equalsName(const string &column, const string &name)
+	{
+		if(column.length() != name.length())return false;
 
-	if(start_pos == string::npos)return false;
+		for(size_t i = 0; i < column.length(); ++i)
+		{
+			if(column[i] != toLower(name[i]))return false;
+		}
+
+		return true;
+	}
 
-	do
+	//Appends UTF-16 (Windows) or UTF-32 text to a UTF-8 string
+	void appendUtf8(string &out, const wchar_t *value, size_t length)
 	{
-		start_pos++;
-		size_t end_pos = start_pos;
-		size_t temp_pos = start_pos;
+		for(size_t i = 0; i < length; ++i)
+		{
+			uint32_t c = static_cast<uint32_t>(value[i]);
+
+			//Combine surrogate pairs
+			if(sizeof(wchar_t) == 2 && c >= 0xD800 && c <= 0xDBFF && i + 1 < length)
+			{
+				const uint32_t low = static_cast<uint32_t>(value[i + 1]);
+				if(low >= 0xDC00 && low <= 0xDFFF)
+				{
+					c = 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+					++i;
+				}
+			}
+
+			if(c < 0x80)
+			{
+				out.push_back(static_cast<char>(c));
+			}
+			else if(c < 0x800)
+			{
+				out.push_back(static_cast<char>(0xC0 | (c >> 6)));
+				out.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+			}
+			else if(c < 0x10000)
+			{
+				out.push_back(static_cast<char>(0xE0 | (c >> 12)));
+				out.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
+				out.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+			}
+			else
+			{
+				out.push_back(static_cast<char>(0xF0 | (c >> 18)));
+				out.push_back(static_cast<char>(0x80 | ((c >> 12) & 0x3F)));
+				out.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
+				out.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+			}
+		}
+	}
+
+	wstring fromUtf8(const string &str)
+	{
+		wstring out;
+		out.reserve(str.length());
 
-		while(end_pos != start_pos && temp_pos != string::npos && temp_pos == end_pos)
+		for(size_t i = 0; i < str.length();)
 		{
-			end_pos = str.find(L"\"", temp_pos+2);
-			temp_pos = str.find(L"\\\"", temp_pos);
+			const unsigned char lead = static_cast<unsigned char>(str[i++]);
+			uint32_t c;
+			size_t count;
+
+			if(lead < 0x80)				{ c = lead;			count = 0; }
+			else if((lead & 0xE0) == 0xC0)	{ c = lead & 0x1F;	count = 1; }
+			else if((lead & 0xF0) == 0xE0)	{ c = lead & 0x0F;	count = 2; }
+			else						{ c = lead & 0x07;	count = 3; }
+
+			for(size_t j = 0; j < count && i < str.length(); ++j, ++i)
+			{
+				c = (c << 6) | (static_cast<unsigned char>(str[i]) & 0x3F);
+			}
+
+			if(sizeof(wchar_t) == 2 && c >= 0x10000)
+			{
+				c -= 0x10000;
+				out.push_back(static_cast<wchar_t>(0xD800 + (c >> 10)));
+				out.push_back(static_cast<wchar_t>(0xDC00 + (c & 0x3FF)));
+			}
+			else
+			{
+				out.push_back(static_cast<wchar_t>(c));
+			}
 		}
 
-		temp_pos = str.find(L",", end_pos);
-		if(temp_pos == string::npos)temp_pos = str.find(L"]", end_pos);
-		end_pos = temp_pos;
+		return out;
+	}
+
+	bool isArray(WmiResult::Type type)
+	{
+		return type >= WmiResult::Type::BoolArray;
+	}
+
+	//Parses text with the same rules as strtol/strtoul, the whole text must be a number
+	template <class T>
+	bool parseInteger(const string &text, T &out)
+	{
+		char *test;
 
-		wstring token = str.substr(str[start_pos] == L'\"' ? start_pos+1 : start_pos, str[start_pos] == L'\"' ? (end_pos - start_pos - 2) : (end_pos - start_pos));
-		out.push_back(unescape(token));
+		if(std::is_signed<T>::value)out = static_cast<T>(std::strtol(text.c_str(), &test, 0));
+		else if(sizeof(T) == sizeof(uint64_t))out = static_cast<T>(std::strtoull(text.c_str(), &test, 0));
+		else out = static_cast<T>(std::strtoul(text.c_str(), &test, 0));
 
-		start_pos = end_pos;
-		end_pos = start_pos;
-		temp_pos = start_pos;
+		return (test == text.c_str() + text.length());
 	}
-	while(start_pos != string::npos && start_pos+1 != str.length());
+}
 
-	return true;
+void WmiResult::clear()
+{
+	columns.clear();
+	rowCount = 0;
+	columnHint = 0;
+	arrayIndex = 0;
+	arrayColumn = 0;
+	text.clear();
+	textRanges.clear();
+	ints.clear();
+	uints.clear();
+	reals.clear();
 }
 
-void WmiResult::set(std::size_t index, wstring name, const wstring &value)
+size_t WmiResult::addRow()
 {
-	while(index >= result.size())result.emplace_back();
+	for(Column &column : columns)
+	{
+		column.cells.push_back(Cell());
+	}
 
-	transform(name.begin(), name.end(), name.begin(), ::tolower);
-	result[index][name] = value;
+	columnHint = 0;
+	return rowCount++;
 }
 
-bool WmiResult::extract(std::size_t index, const string &name, wstring &out) const
+size_t WmiResult::addColumn(const wchar_t *name)
 {
-	if(index >= result.size())return false;
+	if(columnHint < columns.size() && equalsName(columns[columnHint].name, name))
+	{
+		return columnHint++;
+	}
 
-	wstring key(name.cbegin(), name.cend());
-	transform(key.begin(), key.end(), key.begin(), ::tolower);
+	for(size_t i = 0; i < columns.size(); ++i)
+	{
+		if(equalsName(columns[i].name, name))
+		{
+			columnHint = i + 1;
+			return i;
+		}
+	}
 
-	auto found = result[index].find(key);
-	if(found == result[index].cend())return false;
-	
-	out = found->second;
-	return true;
+	Column column;
+	for(const wchar_t *c = name; *c != L'\0'; ++c)
+	{
+		column.name.push_back(static_cast<char>(toLower(*c)));
+	}
+	column.cells.resize(rowCount);
+
+	columns.push_back(std::move(column));
+	columnHint = columns.size();
+	return columns.size() - 1;
 }
 
-bool WmiResult::extract(std::size_t index, const string &name, string &out) const
+WmiResult::Cell& WmiResult::cell(size_t index, size_t column)
 {
-	wstring temp;
-	if(!extract(index, name, temp))return false;
+	return columns[column].cells[index];
+}
 
-	wstring_convert<codecvt_utf8<wchar_t>> myconv;
-	out = myconv.to_bytes(temp);
-	return true;
+void WmiResult::setNull(size_t index, size_t column)
+{
+	cell(index, column).type = Type::Null;
 }
 
-bool WmiResult::extract(std::size_t index, const string &name, int &out) const
+void WmiResult::setBool(size_t index, size_t column, bool value)
 {
-	string temp;
-	if(!extract(index, name, temp))return false;
-	
-	char *test;
-	out = strtol(temp.c_str(), &test, 0);
-	return (test == temp.c_str() + temp.length());
+	Cell &c = cell(index, column);
+	c.type = Type::Bool;
+	c.boolValue = value;
 }
 
-bool WmiResult::extract(std::size_t index, const string &name, bool &out) const
+void WmiResult::setInt(size_t index, size_t column, int64_t value)
 {
-	string temp;
-	if(!extract(index, name, temp))return false;
+	Cell &c = cell(index, column);
+	c.type = Type::Int;
+	c.intValue = value;
+}
 
-	transform(temp.begin(), temp.end(), temp.begin(), ::tolower);
-	if(temp == "true" || temp == "1")out = true;
-	else if(temp == "false" || temp == "0")out = false;
-	else return false;
-	
-	return true;
+void WmiResult::setUInt(size_t index, size_t column, uint64_t value)
+{
+	Cell &c = cell(index, column);
+	c.type = Type::UInt;
+	c.uintValue = value;
 }
 
-bool WmiResult::extract(std::size_t index, const string &name, uint64_t &out) const
+void WmiResult::setReal(size_t index, size_t column, double value)
 {
-	string temp;
-	if(!extract(index, name, temp))return false;
-	
-	char *test;
-	out = strtoull(temp.c_str(), &test, 0);
-	return (test == temp.c_str() + temp.length());
+	Cell &c = cell(index, column);
+	c.type = Type::Real;
+	c.realValue = value;
 }
 
-bool WmiResult::extract(std::size_t index, const string &name, uint32_t &out) const
+void WmiResult::setString(size_t index, size_t column, const wchar_t *value, size_t length)
 {
-	string temp;
-	if(!extract(index, name, temp))return false;
-	
-	char *test;
-	out = (uint32_t)std::strtoul(temp.c_str(), &test, 0);
-	return (test == temp.c_str() + temp.length());
+	const TextRange range = addText(value, length);
+
+	Cell &c = cell(index, column);
+	c.type = Type::String;
+	c.textValue = range;
 }
 
-bool WmiResult::extract(std::size_t index, const string &name, uint16_t &out) const
+void WmiResult::beginArray(size_t index, size_t column, Type type)
 {
-	string temp;
-	if(!extract(index, name, temp))return false;
-	
-	char *test;
-	out = (uint16_t)std::strtoul(temp.c_str(), &test, 0);
-	return (test == temp.c_str() + temp.length());
+	size_t first = 0;
+	switch(type)
+	{
+		case Type::BoolArray:
+		case Type::IntArray:	first = ints.size();		break;
+		case Type::UIntArray:	first = uints.size();		break;
+		case Type::RealArray:	first = reals.size();		break;
+		case Type::StringArray:	first = textRanges.size();	break;
+		default:				return;
+	}
+
+	arrayIndex = index;
+	arrayColumn = column;
+
+	Cell &c = cell(index, column);
+	c.type = type;
+	c.arrayValue.offset = static_cast<uint32_t>(first);
+	c.arrayValue.length = 0;
 }
 
-bool WmiResult::extract(std::size_t index, const string &name, uint8_t &out) const
+void WmiResult::appendBool(bool value)
 {
-	string temp;
-	if(!extract(index, name, temp))return false;
-	
-	char *test;
-	out = (uint8_t)std::strtoul(temp.c_str(), &test, 0);
-	return (test == temp.c_str() + temp.length());
+	ints.push_back(value ? 1 : 0);
+	cell(arrayIndex, arrayColumn).arrayValue.length++;
 }
 
-bool WmiResult::extract(std::size_t index, const string &name, vector<wstring> &out) const
+void WmiResult::appendInt(int64_t value)
 {
-	wstring temp;
-	if(!extract(index, name, temp))return false;
+	ints.push_back(value);
+	cell(arrayIndex, arrayColumn).arrayValue.length++;
+}
 
-	if(!tokenize(temp, out))return false;
+void WmiResult::appendUInt(uint64_t value)
+{
+	uints.push_back(value);
+	cell(arrayIndex, arrayColumn).arrayValue.length++;
+}
 
-	return true;
+void WmiResult::appendReal(double value)
+{
+	reals.push_back(value);
+	cell(arrayIndex, arrayColumn).arrayValue.length++;
+}
+
+void WmiResult::appendString(const wchar_t *value, size_t length)
+{
+	textRanges.push_back(addText(value, length));
+	cell(arrayIndex, arrayColumn).arrayValue.length++;
 }
 
-bool WmiResult::extract(std::size_t index, const string &name, vector<string> &out) const
+void WmiResult::set(size_t index, const wstring &name, const wstring &value)
 {
-	vector<wstring> tokens;
-	if(!extract(index, name, tokens))return false;
+	const size_t column = addColumn(name.c_str());
+	while(index >= rowCount)addRow();
+
+	setString(index, column, value.c_str(), value.length());
+}
 
-	out.resize(tokens.size());
-	for(std::size_t i = 0; i < tokens.size(); ++i)
+size_t WmiResult::findColumn(const string &name) const
+{
+	for(size_t i = 0; i < columns.size(); ++i)
 	{
-		wstring_convert<codecvt_utf8<wchar_t>> myconv;
-		const wstring &temp = tokens[i];
-		out[i] = myconv.to_bytes(temp);
+		if(equalsName(columns[i].name, name))return i;
 	}
 
-	return true;
+	return npos;
 }
 
-bool WmiResult::extract(std::size_t index, const string &name, vector<int> &out) const
+WmiResult::Type WmiResult::type(size_t index, const string &name) const
 {
-	vector<string> tokens;
-	if(!extract(index, name, tokens))return false;
+	const Cell *value = find(index, name);
+	return (value == nullptr) ? Type::Missing : value->type;
+}
 
-	out.resize(tokens.size());
-	for(std::size_t i = 0; i < tokens.size(); ++i)
-	{
-		char *test;
-		out[i] = strtol(tokens[i].c_str(), &test, 0);
-		return (test == tokens[i].c_str() + tokens[i].length());
-	}
+const WmiResult::Cell* WmiResult::find(size_t index, const string &name) const
+{
+	if(index >= rowCount)return nullptr;
 
-	return true;
+	const size_t column = findColumn(name);
+	if(column == npos)return nullptr;
+
+	const Cell &value = columns[column].cells[index];
+	return (value.type == Type::Missing) ? nullptr : &value;
+}
+
+WmiResult::TextRange WmiResult::addText(const wchar_t *value, size_t length)
+{
+	TextRange range;
+	range.offset = static_cast<uint32_t>(text.length());
+	appendUtf8(text, value, length);
+	range.length = static_cast<uint32_t>(text.length() - range.offset);
+
+	return range;
 }
 
-bool WmiResult::extract(std::size_t index, const string &name, vector<bool> &out) const
+WmiResult::Cell WmiResult::element(const Cell &array, size_t i) const
 {
-	vector<string> tokens;
-	if(!extract(index, name, tokens))return false;
+	const size_t position = array.arrayValue.offset + i;
+	Cell value;
 
-	out.resize(tokens.size());
-	for(std::size_t i = 0; i < tokens.size(); ++i)
+	switch(array.type)
 	{
-		string temp = tokens[i];
-		transform(temp.begin(), temp.end(), temp.begin(), ::tolower);
-		if(temp == "true" || temp == "1")out[i] = true;
-		else if(temp == "false" || temp == "0")out[i] = false;
-		else return false;
+		case Type::BoolArray:
+			value.type = Type::Bool;
+			value.boolValue = (ints[position] != 0);
+			break;
+		case Type::IntArray:
+			value.type = Type::Int;
+			value.intValue = ints[position];
+			break;
+		case Type::UIntArray:
+			value.type = Type::UInt;
+			value.uintValue = uints[position];
+			break;
+		case Type::RealArray:
+			value.type = Type::Real;
+			value.realValue = reals[position];
+			break;
+		case Type::StringArray:
+			value.type = Type::String;
+			value.textValue = textRanges[position];
+			break;
+		default:
+			value.type = Type::Missing;
+			break;
 	}
 
-	return true;
+	return value;
 }
 
-bool WmiResult::extract(std::size_t index, const string &name, vector<uint64_t> &out) const
+bool WmiResult::convert(const Cell &value, string &out) const
 {
-	vector<string> tokens;
-	if(!extract(index, name, tokens))return false;
-
-	out.resize(tokens.size());
-	for(std::size_t i = 0; i < tokens.size(); ++i)
+	switch(value.type)
 	{
-		char *test;
-		out[i] = strtoull(tokens[i].c_str(), &test, 0);
-		if(test != tokens[i].c_str() + tokens[i].length()) return false;
+		case Type::Null:
+			out = "NULL";
+			return true;
+		case Type::Bool:
+			out = value.boolValue ? "true" : "false";
+			return true;
+		case Type::Int:
+			out = std::to_string(value.intValue);
+			return true;
+		case Type::UInt:
+			out = std::to_string(value.uintValue);
+			return true;
+		case Type::Real:
+		{
+			std::ostringstream ss;
+			ss<<value.realValue;
+			out = ss.str();
+			return true;
+		}
+		case Type::String:
+			out.assign(text, value.textValue.offset, value.textValue.length);
+			return true;
+		default:
+			return false;
 	}
+}
 
+bool WmiResult::convert(const Cell &value, wstring &out) const
+{
+	string temp;
+	if(!convert(value, temp))return false;
+
+	out = fromUtf8(temp);
 	return true;
 }
 
-bool WmiResult::extract(std::size_t index, const string &name, vector<uint32_t> &out) const
+bool WmiResult::convert(const Cell &value, bool &out) const
 {
-	vector<string> tokens;
-	if(!extract(index, name, tokens))return false;
-
-	out.resize(tokens.size());
-	for(std::size_t i = 0; i < tokens.size(); ++i)
+	switch(value.type)
 	{
-		char *test;
-		out[i] = (uint32_t)strtoul(tokens[i].c_str(), &test, 0);
-		if (test != tokens[i].c_str() + tokens[i].length()) return false;
-	}
+		case Type::Bool:
+			out = value.boolValue;
+			return true;
+		case Type::Int:
+			if(value.intValue != 0 && value.intValue != 1)return false;
+			out = (value.intValue == 1);
+			return true;
+		case Type::UInt:
+			if(value.uintValue > 1)return false;
+			out = (value.uintValue == 1);
+			return true;
+		case Type::String:
+		{
+			string temp;
+			convert(value, temp);
+			for(char &c : temp)c = toLower(c);
 
-	return true;
+			if(temp == "true" || temp == "1")out = true;
+			else if(temp == "false" || temp == "0")out = false;
+			else return false;
+
+			return true;
+		}
+		default:
+			return false;
+	}
 }
 
-bool WmiResult::extract(std::size_t index, const string &name, vector<uint16_t> &out) const
+template <class T>
+bool WmiResult::convert(const Cell &value, T &out) const
 {
-	vector<string> tokens;
-	if(!extract(index, name, tokens))return false;
+	switch(value.type)
+	{
+		case Type::Int:
+			out = static_cast<T>(value.intValue);
+			return true;
+		case Type::UInt:
+			out = static_cast<T>(value.uintValue);
+			return true;
+		case Type::Real:
+			out = static_cast<T>(value.realValue);
+			return (std::floor(value.realValue) == value.realValue);
+		case Type::String:
+		{
+			string temp;
+			convert(value, temp);
+			return parseInteger(temp, out);
+		}
+		default:
+			//Values like NULL or true never parsed as numbers
+			out = 0;
+			return false;
+	}
+}
 
-	out.resize(tokens.size());
-	for(std::size_t i = 0; i < tokens.size(); ++i)
+bool WmiResult::convertArray(const Cell &value, string &out) const
+{
+	out = "[";
+	for(size_t i = 0; i < value.arrayValue.length; ++i)
 	{
-		char *test;
-		out[i] = (uint16_t)strtoul(tokens[i].c_str(), &test, 0);
-		if (test != tokens[i].c_str() + tokens[i].length()) return false;
+		const Cell inner = element(value, i);
+
+		string temp;
+		convert(inner, temp);
+
+		if(inner.type == Type::String)
+		{
+			out.push_back('\"');
+			for(char c : temp)
+			{
+				if(c == '\"')out.push_back('\\');
+				out.push_back(c);
+			}
+			out.push_back('\"');
+		}
+		else
+		{
+			out += temp;
+		}
+
+		if(i + 1 != value.arrayValue.length)out.push_back(',');
 	}
+	out.push_back(']');
 
 	return true;
 }
 
-bool WmiResult::extract(std::size_t index, const string &name, vector<uint8_t> &out) const
+bool WmiResult::convertArray(const Cell &value, wstring &out) const
+{
+	string temp;
+	convertArray(value, temp);
+
+	out = fromUtf8(temp);
+	return true;
+}
+
+template <class T>
+bool WmiResult::convertArray(const Cell &/*value*/, T &/*out*/) const
+{
+	return false;
+}
+
+template <class T>
+bool WmiResult::extractScalar(size_t index, const string &name, T &out) const
+{
+	const Cell *value = find(index, name);
+	if(value == nullptr)return false;
+
+	if(isArray(value->type))return convertArray(*value, out);
+	return convert(*value, out);
+}
+
+template <class T>
+bool WmiResult::extractArray(size_t index, const string &name, vector<T> &out) const
 {
-	vector<string> tokens;
-	if(!extract(index, name, tokens))return false;
+	const Cell *value = find(index, name);
+	if(value == nullptr || !isArray(value->type))return false;
 
-	out.resize(tokens.size());
-	for(std::size_t i = 0; i < tokens.size(); ++i)
+	out.resize(value->arrayValue.length);
+	for(size_t i = 0; i < out.size(); ++i)
 	{
-		char *test;
-		out[i] = (uint8_t)strtoul(tokens[i].c_str(), &test, 0);
-		if (test != tokens[i].c_str() + tokens[i].length()) return false;
+		T temp;
+		if(!convert(element(*value, i), temp))return false;
+		out[i] = temp;
 	}
 
 	return true;
 }
+
+bool WmiResult::extract(size_t index, const string &name, wstring &out) const
+{
+	return extractScalar(index, name, out);
+}
+
+bool WmiResult::extract(size_t index, const string &name, string &out) const
+{
+	return extractScalar(index, name, out);
+}
+
+bool WmiResult::extract(size_t index, const string &name, int &out) const
+{
+	return extractScalar(index, name, out);
+}
+
+bool WmiResult::extract(size_t index, const string &name, bool &out) const
+{
+	return extractScalar(index, name, out);
+}
+
+bool WmiResult::extract(size_t index, const string &name, uint64_t &out) const
+{
+	return extractScalar(index, name, out);
+}
+
+bool WmiResult::extract(size_t index, const string &name, uint32_t &out) const
+{
+	return extractScalar(index, name, out);
+}
+
+bool WmiResult::extract(size_t index, const string &name, uint16_t &out) const
+{
+	return extractScalar(index, name, out);
+}
+
+bool WmiResult::extract(size_t index, const string &name, uint8_t &out) const
+{
+	return extractScalar(index, name, out);
+}
+
+bool WmiResult::extract(size_t index, const string &name, vector<wstring> &out) const
+{
+	return extractArray(index, name, out);
+}
+
+bool WmiResult::extract(size_t index, const string &name, vector<string> &out) const
+{
+	return extractArray(index, name, out);
+}
+
+bool WmiResult::extract(size_t index, const string &name, vector<int> &out) const
+{
+	return extractArray(index, name, out);
+}
+
+bool WmiResult::extract(size_t index, const string &name, vector<bool> &out) const
+{
+	return extractArray(index, name, out);
+}
+
+bool WmiResult::extract(size_t index, const string &name, vector<uint64_t> &out) const
+{
+	return extractArray(index, name, out);
+}
+
+bool WmiResult::extract(size_t index, const string &name, vector<uint32_t> &out) const
+{
+	return extractArray(index, name, out);
+}
+
+bool WmiResult::extract(size_t index, const string &name, vector<uint16_t> &out) const
+{
+	return extractArray(index, name, out);
+}
+
+bool WmiResult::extract(size_t index, const string &name, vector<uint8_t> &out) const
+{
+	return extractArray(index, name, out);
+}